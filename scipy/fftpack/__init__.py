@@ -17,7 +17,12 @@ for k in ['fft', 'ifft', 'fftn', 'ifftn', 'fft2', 'ifft2']:
 del k, register_func
 
 from realtransforms import *
-__all__.extend(['dct', 'idct'])
+__all__.extend(['dct', 'idct', 'dst', 'idst', 'dctn', 'idctn',
+                'dstn', 'idstn'])
+
+from wisdom import *
+__all__.extend(['fft_autotune', 'save_wisdom', 'load_wisdom',
+                'forget_wisdom'])
 
 from numpy.testing import Tester
 test = Tester().test
@@ -4,7 +4,7 @@ Discrete Fourier Transforms - basic.py
 # Created by Pearu Peterson, August,September 2002
 
 __all__ = ['fft','ifft','fftn','ifftn','rfft','irfft',
-           'fft2','ifft2']
+           'fft2','ifft2','rfftn','irfftn']
 
 from numpy import zeros, swapaxes
 import numpy
@@ -17,6 +17,8 @@ atexit.register(_fftpack.destroy_drfft_cache)
 atexit.register(_fftpack.destroy_cfft_cache)
 atexit.register(_fftpack.destroy_cfftnd_cache)
 atexit.register(_fftpack.destroy_rfft_cache)
+atexit.register(_fftpack.destroy_drfftnd_cache)
+atexit.register(_fftpack.destroy_rfftnd_cache)
 del atexit
 
 def istype(arr, typeclass):
@@ -80,6 +82,20 @@ def _fake_cfftnd(x, shape, *a, **kw):
     else:
         return _fftpack.zfftnd(x, shape, *a, **kw).astype(numpy.complex64)
 
+def _fake_rfftnd(x, y, shape, *a, **kw):
+    if numpy.all(map(_is_safe_size, shape)):
+        return _fftpack.rfftnd(x, y, shape, *a, **kw)
+    else:
+        y = numpy.empty(y.shape, numpy.complex128)
+        return _fftpack.drfftnd(x, y, shape, *a, **kw).astype(numpy.complex64)
+
+def _fake_irfftnd(y, x, shape, *a, **kw):
+    if numpy.all(map(_is_safe_size, shape)):
+        return _fftpack.irfftnd(y, x, shape, *a, **kw)
+    else:
+        x = numpy.empty(x.shape, numpy.float64)
+        return _fftpack.dirfftnd(y, x, shape, *a, **kw).astype(numpy.float32)
+
 _DTYPE_TO_FFT = {
 #        numpy.dtype(numpy.float32): _fftpack.crfft,
         numpy.dtype(numpy.float32): _fake_crfft,
@@ -104,6 +120,18 @@ _DTYPE_TO_FFTN = {
         numpy.dtype(numpy.float64): _fftpack.zfftnd,
 }
 
+_DTYPE_TO_RFFTN = {
+#        numpy.dtype(numpy.float32): _fftpack.rfftnd,
+        numpy.dtype(numpy.float32): _fake_rfftnd,
+        numpy.dtype(numpy.float64): _fftpack.drfftnd,
+}
+
+_DTYPE_TO_IRFFTN = {
+#        numpy.dtype(numpy.complex64): _fftpack.irfftnd,
+        numpy.dtype(numpy.complex64): _fake_irfftnd,
+        numpy.dtype(numpy.complex128): _fftpack.dirfftnd,
+}
+
 def _asfarray(x):
     """Like numpy asfarray, except that it does not modify x dtype if x is
     already an array with a float dtype, and do not cast complex types to
@@ -521,3 +549,154 @@ def ifft2(x, shape=None, axes=(-2,-1), overwrite_x=0):
 
     """
     return ifftn(x,shape,axes,overwrite_x)
+
+
+def _rfftn_axes(x, s, axes):
+    """ Internal auxiliary function for rfftn, irfftn.
+
+    Returns x transposed so that the transform axes come last (in the
+    given order), together with the permutation that undoes it.
+    """
+    if axes is None:
+        if s is None:
+            axes = range(x.ndim)
+        else:
+            axes = range(x.ndim - len(s), x.ndim)
+    axes = [a % x.ndim for a in axes]
+    if len(set(axes)) != len(axes):
+        raise ValueError("repeated axes are not supported")
+    if s is not None and len(s) != len(axes):
+        raise ValueError("when given, axes and shape arguments "\
+                         "have to be of the same length")
+    perm = [i for i in range(x.ndim) if i not in axes] + axes
+    return x.transpose(perm), numpy.argsort(perm), len(axes)
+
+def rfftn(x, shape=None, axes=None):
+    """
+    Multi-dimensional discrete Fourier transform of a real sequence.
+
+    A real FFT is done along the last of `axes` and complex FFTs along the
+    remaining ones.  Only the non-negative frequencies of the last axis are
+    returned, so for a real transform of length n that axis has length
+    ``n/2 + 1``; the other half follows from ``y[..., -j] ==
+    y[..., j].conjugate()``.  This needs roughly half the time and memory
+    of ``fftn`` on real input.
+
+    Parameters
+    ----------
+    x : array_like, real-valued
+        The data to transform.
+    shape : sequence of ints, optional
+        Shape of the transform.  If ``shape[i] > x.shape[axes[i]]`` the
+        i-th axis is padded with zeros, if it is smaller the axis is
+        truncated.  Default is the shape of `x` along `axes`.
+    axes : sequence of ints, optional
+        Axes over which to compute the transform.  Default is the last
+        ``len(shape)`` axes, or all axes if `shape` is not given.
+
+    Returns
+    -------
+    y : complex ndarray
+        ``fftn(x, shape, axes)`` with the last transformed axis cut to
+        ``shape[-1]/2 + 1`` entries.
+
+    See Also
+    --------
+    irfftn, fftn, rfft
+
+    """
+    tmp = _asfarray(x)
+    if not numpy.isrealobj(tmp):
+        raise TypeError("1st argument must be real sequence")
+
+    try:
+        work_function = _DTYPE_TO_RFFTN[tmp.dtype]
+    except KeyError:
+        raise ValueError("type %s is not supported" % tmp.dtype)
+
+    tmp, iperm, naxes = _rfftn_axes(tmp, shape, axes)
+    nb = tmp.ndim - naxes
+    if shape is None:
+        shape = tmp.shape[nb:]
+    shape = [int(n) for n in shape]
+
+    for i in range(naxes):
+        tmp = _fix_shape(tmp, shape[i], nb + i)[0]
+
+    hshape = tmp.shape[:-1] + (shape[-1]//2 + 1,)
+    if tmp.dtype == numpy.float32:
+        y = numpy.empty(hshape, numpy.complex64)
+    else:
+        y = numpy.empty(hshape, numpy.complex128)
+
+    y = work_function(tmp, y, [1]*nb + shape)
+    return y.transpose(iperm)
+
+def irfftn(x, shape=None, axes=None, overwrite_x=0):
+    """
+    Inverse of `rfftn`.
+
+    Parameters
+    ----------
+    x : array_like
+        Half spectrum as returned by `rfftn`.
+    shape : sequence of ints, optional
+        Shape of the real output along `axes`.  The half-spectrum axis is
+        padded or truncated to ``shape[-1]/2 + 1`` entries, the other axes
+        to ``shape[i]``.  Default is the shape of `x` along `axes`, with
+        ``2*(m-1)`` for the last axis of length m; pass `shape` to get an
+        odd length back.
+    axes : sequence of ints, optional
+        Axes over which to compute the inverse transform.  See `rfftn`.
+    overwrite_x : bool, optional
+        If True the contents of x can be destroyed. (default=False)
+
+    Returns
+    -------
+    y : real ndarray
+        ``irfftn(rfftn(y, s), s) == y`` within numerical accuracy.
+
+    See Also
+    --------
+    rfftn, ifftn, irfft
+
+    """
+    tmp = _asfarray(x)
+    if numpy.isrealobj(tmp):
+        if tmp.dtype == numpy.float32:
+            tmp = tmp.astype(numpy.complex64)
+        else:
+            tmp = tmp.astype(numpy.complex128)
+        overwrite_x = 1
+
+    try:
+        work_function = _DTYPE_TO_IRFFTN[tmp.dtype]
+    except KeyError:
+        raise ValueError("type %s is not supported" % tmp.dtype)
+
+    overwrite_x = overwrite_x or _datacopied(tmp, x)
+
+    tmp, iperm, naxes = _rfftn_axes(tmp, shape, axes)
+    nb = tmp.ndim - naxes
+    if shape is None:
+        shape = list(tmp.shape[nb:])
+        shape[-1] = 2*(shape[-1] - 1)
+    shape = [int(n) for n in shape]
+    if shape[-1] < 1:
+        raise ValueError("invalid number of data points (%d) specified"
+                         % shape[-1])
+
+    for i in range(naxes - 1):
+        tmp, copy_made = _fix_shape(tmp, shape[i], nb + i)
+        overwrite_x = overwrite_x or copy_made
+    tmp, copy_made = _fix_shape(tmp, shape[-1]//2 + 1, tmp.ndim - 1)
+    overwrite_x = overwrite_x or copy_made
+
+    rshape = tmp.shape[:-1] + (shape[-1],)
+    if tmp.dtype == numpy.complex64:
+        y = numpy.empty(rshape, numpy.float32)
+    else:
+        y = numpy.empty(rshape, numpy.float64)
+
+    y = work_function(tmp, y, [1]*nb + shape, overwrite_y=overwrite_x)
+    return y.transpose(iperm)
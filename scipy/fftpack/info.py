@@ -13,6 +13,7 @@ Modules
    helper - TODO
    pseudo_diffs - Differential and pseudo-differential operators
    realtransforms - Real spectrum tranforms (DCT, DST, MDCT)
+   wisdom - Autotuning of transform algorithms
 
 Functions
 =========
@@ -29,11 +30,19 @@ Fast Fourier Transforms (FFTs)
    ifft2 - Two dimensional inverse FFT
    fftn - n-dimensional FFT
    ifftn - n-dimensional inverse FFT
+   rfftn - n-dimensional FFT of strictly real-valued sequence
+   irfftn - Inverse of rfftn
    rfft - FFT of strictly real-valued sequence
    irfft - Inverse of rfft
    rfftfreq - DFT sample frequencies (specific to rfft and irfft)
    dct - Discrete cosine transform
    idct - Inverse discrete cosine transform
+   dctn - n-dimensional discrete cosine transform
+   idctn - n-dimensional inverse discrete cosine transform
+   dst - Discrete sine transform
+   idst - Inverse discrete sine transform
+   dstn - n-dimensional discrete sine transform
+   idstn - n-dimensional inverse discrete sine transform
 
 Differential and pseudo-differential operators
 ----------------------------------------------
@@ -52,10 +61,21 @@ Differential and pseudo-differential operators
    cc_diff - cosh/cosh pseudo-derivative of periodic sequences
    shift - Shift periodic sequences
 
+Autotuning
+----------
+
+.. autosummary::
+   :toctree: generated/
+
+   fft_autotune - Time new transform sizes and keep the faster algorithm
+   save_wisdom - Save the algorithm choices to a file
+   load_wisdom - Load algorithm choices saved by save_wisdom
+   forget_wisdom - Drop all algorithm choices
+
 """
 
 __all__ = ['fft','ifft','fftn','ifftn','rfft','irfft',
-           'fft2','ifft2',
+           'fft2','ifft2','rfftn','irfftn',
            'diff',
            'tilbert','itilbert','hilbert','ihilbert',
            'sc_diff','cs_diff','cc_diff','ss_diff',
@@ -1,5 +1,8 @@
 """
 Differential and pseudo-differential operators.
+
+All operators act along the last axis, so the rows of a 2-d array are
+transformed together.
 """
 # Created by Pearu Peterson, September 2002
 
@@ -8,7 +11,7 @@ __all__ = ['diff',
            'cs_diff','cc_diff','sc_diff','ss_diff',
            'shift']
 
-from numpy import pi, asarray, sin, cos, sinh, cosh, tanh, iscomplexobj
+from numpy import pi, asarray, iscomplexobj
 import convolve
 
 from scipy.fftpack.basic import _datacopied
@@ -17,10 +20,25 @@ import atexit
 atexit.register(convolve.destroy_convolve_cache)
 del atexit
 
+# Operator codes of the kernel bank in src/convolve.c
+_DIFF, _TILBERT, _ITILBERT, _HILBERT, _CS_DIFF, _SC_DIFF, _SS_DIFF, \
+       _CC_DIFF, _SHIFT = range(9)
+
+def _kernel_convolve(tmp, x, op, a=0, b=0):
+    """ Apply the pseudo-differential operator op along the last axis of
+    tmp = asarray(x).
+
+    The spectrum of the operator is looked up in (or added to) the kernel
+    bank of the convolve module, and all rows are transformed in one call.
+    The memory used by the bank is bounded, see
+    convolve.set_kernel_bank_size.
+    """
+    overwrite_x = _datacopied(tmp, x)
+    return convolve.kernel_convolve(tmp, op, n=tmp.shape[-1], a=a, b=b,
+                                    overwrite_x=overwrite_x)
+
 
-_cache = {}
-def diff(x,order=1,period=None,
-            _cache = _cache):
+def diff(x,order=1,period=None):
     """ diff(x, order=1, period=2*pi) -> y
 
     Return k-th derivative (or integral) of a periodic sequence x.
@@ -53,27 +71,10 @@ def diff(x,order=1,period=None,
         c = 2*pi/period
     else:
         c = 1.0
-    n = len(x)
-    omega = _cache.get((n,order,c))
-    if omega is None:
-        if len(_cache)>20:
-            while _cache: _cache.popitem()
-        def kernel(k,order=order,c=c):
-            if k:
-                return pow(c*k,order)
-            return 0
-        omega = convolve.init_convolution_kernel(n,kernel,d=order,
-                                                 zero_nyquist=1)
-        _cache[(n,order,c)] = omega
-    overwrite_x = _datacopied(tmp, x)
-    return convolve.convolve(tmp,omega,swap_real_imag=order%2,
-                             overwrite_x=overwrite_x)
-del _cache
+    return _kernel_convolve(tmp, x, _DIFF, order, c)
 
 
-_cache = {}
-def tilbert(x,h,period=None,
-            _cache = _cache):
+def tilbert(x,h,period=None):
     """ tilbert(x, h, period=2*pi) -> y
 
     Return h-Tilbert transform of a periodic sequence x.
@@ -104,24 +105,10 @@ def tilbert(x,h,period=None,
                1j*tilbert(tmp.imag,h,period)
     if period is not None:
         h = h*2*pi/period
-    n = len(x)
-    omega = _cache.get((n,h))
-    if omega is None:
-        if len(_cache)>20:
-            while _cache: _cache.popitem()
-        def kernel(k,h=h):
-            if k: return 1.0/tanh(h*k)
-            return 0
-        omega = convolve.init_convolution_kernel(n,kernel,d=1)
-        _cache[(n,h)] = omega
-    overwrite_x = _datacopied(tmp, x)
-    return convolve.convolve(tmp,omega,swap_real_imag=1,overwrite_x=overwrite_x)
-del _cache
+    return _kernel_convolve(tmp, x, _TILBERT, h)
 
 
-_cache = {}
-def itilbert(x,h,period=None,
-            _cache = _cache):
+def itilbert(x,h,period=None):
     """ itilbert(x, h, period=2*pi) -> y
 
     Return inverse h-Tilbert transform of a periodic sequence x.
@@ -140,24 +127,10 @@ def itilbert(x,h,period=None,
                1j*itilbert(tmp.imag,h,period)
     if period is not None:
         h = h*2*pi/period
-    n = len(x)
-    omega = _cache.get((n,h))
-    if omega is None:
-        if len(_cache)>20:
-            while _cache: _cache.popitem()
-        def kernel(k,h=h):
-            if k: return -tanh(h*k)
-            return 0
-        omega = convolve.init_convolution_kernel(n,kernel,d=1)
-        _cache[(n,h)] = omega
-    overwrite_x = _datacopied(tmp, x)
-    return convolve.convolve(tmp,omega,swap_real_imag=1,overwrite_x=overwrite_x)
-del _cache
+    return _kernel_convolve(tmp, x, _ITILBERT, h)
 
 
-_cache = {}
-def hilbert(x,
-            _cache=_cache):
+def hilbert(x):
     """ hilbert(x) -> y
 
     Return Hilbert transform of a periodic sequence x.
@@ -176,20 +149,7 @@ def hilbert(x,
     tmp = asarray(x)
     if iscomplexobj(tmp):
         return hilbert(tmp.real)+1j*hilbert(tmp.imag)
-    n = len(x)
-    omega = _cache.get(n)
-    if omega is None:
-        if len(_cache)>20:
-            while _cache: _cache.popitem()
-        def kernel(k):
-            if k>0: return 1.0
-            elif k<0: return -1.0
-            return 0.0
-        omega = convolve.init_convolution_kernel(n,kernel,d=1)
-        _cache[n] = omega
-    overwrite_x = _datacopied(tmp, x)
-    return convolve.convolve(tmp,omega,swap_real_imag=1,overwrite_x=overwrite_x)
-del _cache
+    return _kernel_convolve(tmp, x, _HILBERT)
 
 
 def ihilbert(x):
@@ -206,9 +166,7 @@ def ihilbert(x):
     return -hilbert(x)
 
 
-_cache = {}
-def cs_diff(x, a, b, period=None,
-            _cache = _cache):
+def cs_diff(x, a, b, period=None):
     """ cs_diff(x, a, b, period=2*pi) -> y
 
     Return (a,b)-cosh/sinh pseudo-derivative of a periodic sequence x.
@@ -236,24 +194,10 @@ def cs_diff(x, a, b, period=None,
     if period is not None:
         a = a*2*pi/period
         b = b*2*pi/period
-    n = len(x)
-    omega = _cache.get((n,a,b))
-    if omega is None:
-        if len(_cache)>20:
-            while _cache: _cache.popitem()
-        def kernel(k,a=a,b=b):
-            if k: return -cosh(a*k)/sinh(b*k)
-            return 0
-        omega = convolve.init_convolution_kernel(n,kernel,d=1)
-        _cache[(n,a,b)] = omega
-    overwrite_x = _datacopied(tmp, x)
-    return convolve.convolve(tmp,omega,swap_real_imag=1,overwrite_x=overwrite_x)
-del _cache
+    return _kernel_convolve(tmp, x, _CS_DIFF, a, b)
 
 
-_cache = {}
-def sc_diff(x, a, b, period=None,
-            _cache = _cache):
+def sc_diff(x, a, b, period=None):
     """
     Return (a,b)-sinh/cosh pseudo-derivative of a periodic sequence x.
 
@@ -286,24 +230,10 @@ def sc_diff(x, a, b, period=None,
     if period is not None:
         a = a*2*pi/period
         b = b*2*pi/period
-    n = len(x)
-    omega = _cache.get((n,a,b))
-    if omega is None:
-        if len(_cache)>20:
-            while _cache: _cache.popitem()
-        def kernel(k,a=a,b=b):
-            if k: return sinh(a*k)/cosh(b*k)
-            return 0
-        omega = convolve.init_convolution_kernel(n,kernel,d=1)
-        _cache[(n,a,b)] = omega
-    overwrite_x = _datacopied(tmp, x)
-    return convolve.convolve(tmp,omega,swap_real_imag=1,overwrite_x=overwrite_x)
-del _cache
+    return _kernel_convolve(tmp, x, _SC_DIFF, a, b)
 
 
-_cache = {}
-def ss_diff(x, a, b, period=None,
-            _cache = _cache):
+def ss_diff(x, a, b, period=None):
     """ ss_diff(x, a, b, period=2*pi) -> y
 
     Return (a,b)-sinh/sinh pseudo-derivative of a periodic sequence x.
@@ -331,24 +261,10 @@ def ss_diff(x, a, b, period=None,
     if period is not None:
         a = a*2*pi/period
         b = b*2*pi/period
-    n = len(x)
-    omega = _cache.get((n,a,b))
-    if omega is None:
-        if len(_cache)>20:
-            while _cache: _cache.popitem()
-        def kernel(k,a=a,b=b):
-            if k: return sinh(a*k)/sinh(b*k)
-            return float(a)/b
-        omega = convolve.init_convolution_kernel(n,kernel)
-        _cache[(n,a,b)] = omega
-    overwrite_x = _datacopied(tmp, x)
-    return convolve.convolve(tmp,omega,overwrite_x=overwrite_x)
-del _cache
+    return _kernel_convolve(tmp, x, _SS_DIFF, a, b)
 
 
-_cache = {}
-def cc_diff(x, a, b, period=None,
-            _cache = _cache):
+def cc_diff(x, a, b, period=None):
     """ cc_diff(x, a, b, period=2*pi) -> y
 
     Return (a,b)-cosh/cosh pseudo-derivative of a periodic sequence x.
@@ -377,22 +293,9 @@ def cc_diff(x, a, b, period=None,
     if period is not None:
         a = a*2*pi/period
         b = b*2*pi/period
-    n = len(x)
-    omega = _cache.get((n,a,b))
-    if omega is None:
-        if len(_cache)>20:
-            while _cache: _cache.popitem()
-        def kernel(k,a=a,b=b):
-            return cosh(a*k)/cosh(b*k)
-        omega = convolve.init_convolution_kernel(n,kernel)
-        _cache[(n,a,b)] = omega
-    overwrite_x = _datacopied(tmp, x)
-    return convolve.convolve(tmp,omega,overwrite_x=overwrite_x)
-del _cache
+    return _kernel_convolve(tmp, x, _CC_DIFF, a, b)
 
-_cache = {}
-def shift(x, a, period=None,
-          _cache = _cache):
+def shift(x, a, period=None):
     """ shift(x, a, period=2*pi) -> y
 
     Shift periodic sequence x by a: y(u) = x(u+a).
@@ -411,22 +314,5 @@ def shift(x, a, period=None,
         return shift(tmp.real,a,period)+1j*shift(tmp.imag,a,period)
     if period is not None:
         a = a*2*pi/period
-    n = len(x)
-    omega = _cache.get((n,a))
-    if omega is None:
-        if len(_cache)>20:
-            while _cache: _cache.popitem()
-        def kernel_real(k,a=a): return cos(a*k)
-        def kernel_imag(k,a=a): return sin(a*k)
-        omega_real = convolve.init_convolution_kernel(n,kernel_real,d=0,
-                                                      zero_nyquist=0)
-        omega_imag = convolve.init_convolution_kernel(n,kernel_imag,d=1,
-                                                      zero_nyquist=0)
-        _cache[(n,a)] = omega_real,omega_imag
-    else:
-        omega_real,omega_imag = omega
-    overwrite_x = _datacopied(tmp, x)
-    return convolve.convolve_z(tmp,omega_real,omega_imag,
-                               overwrite_x=overwrite_x)
+    return _kernel_convolve(tmp, x, _SHIFT, a)
 
-del _cache
@@ -2,17 +2,40 @@
 Real spectrum tranforms (DCT, DST, MDCT)
 """
 
-__all__ = ['dct', 'idct']
+__all__ = ['dct', 'idct', 'dst', 'idst', 'dctn', 'idctn', 'dstn', 'idstn']
 
 import numpy as np
 from scipy.fftpack import _fftpack
-from scipy.fftpack.basic import _datacopied
+from scipy.fftpack.basic import _datacopied, _fix_shape
 
 import atexit
 atexit.register(_fftpack.destroy_ddct1_cache)
 atexit.register(_fftpack.destroy_ddct2_cache)
+atexit.register(_fftpack.destroy_ddct4_cache)
 atexit.register(_fftpack.destroy_dct1_cache)
 atexit.register(_fftpack.destroy_dct2_cache)
+atexit.register(_fftpack.destroy_dct4_cache)
+atexit.register(_fftpack.destroy_ddst1_cache)
+atexit.register(_fftpack.destroy_ddst2_cache)
+atexit.register(_fftpack.destroy_dst1_cache)
+atexit.register(_fftpack.destroy_dst2_cache)
+
+# Inverse/forward type table
+_TP = {1:1, 2:3, 3:2, 4:4}
+
+_DCT = {
+    np.dtype(np.float64): {1: _fftpack.ddct1, 2: _fftpack.ddct2,
+                           3: _fftpack.ddct3, 4: _fftpack.ddct4},
+    np.dtype(np.float32): {1: _fftpack.dct1, 2: _fftpack.dct2,
+                           3: _fftpack.dct3, 4: _fftpack.dct4},
+}
+
+_DST = {
+    np.dtype(np.float64): {1: _fftpack.ddst1, 2: _fftpack.ddst2,
+                           3: _fftpack.ddst3, 4: _fftpack.ddst4},
+    np.dtype(np.float32): {1: _fftpack.dst1, 2: _fftpack.dst2,
+                           3: _fftpack.dst3, 4: _fftpack.dst4},
+}
 
 def dct(x, type=2, n=None, axis=-1, norm=None, overwrite_x=0):
     """
@@ -22,7 +45,7 @@ def dct(x, type=2, n=None, axis=-1, norm=None, overwrite_x=0):
     ----------
     x : array_like
         The input array.
-    type : {1, 2, 3}, optional
+    type : {1, 2, 3, 4}, optional
         Type of the DCT (see Notes). Default type is 2.
     n : int, optional
         Length of the transform.
@@ -47,7 +70,7 @@ def dct(x, type=2, n=None, axis=-1, norm=None, overwrite_x=0):
     For a single dimension array ``x``, ``dct(x, norm='ortho')`` is equal to
     MATLAB ``dct(x)``.
 
-    There are theoretically 8 types of the DCT, only the first 3 types are
+    There are theoretically 8 types of the DCT, only the first 4 types are
     implemented in scipy. 'The' DCT generally refers to DCT type 2, and 'the'
     Inverse DCT generally refers to DCT type 3.
 
@@ -60,8 +83,14 @@ def dct(x, type=2, n=None, axis=-1, norm=None, overwrite_x=0):
       y[k] = x[0] + (-1)**k x[N-1] + 2 * sum x[n]*cos(pi*k*n/(N-1))
                                          n=1
 
-    Only None is supported as normalization mode for DCT-I. Note also that the
-    DCT-I is only supported for input size > 1
+    If ``norm='ortho'``, ``x[0]`` and ``x[N-1]`` are multiplied by
+    ``sqrt(2)`` before the transform and ``y[k]`` is multiplied by a
+    scaling factor `f`::
+
+      f = sqrt(1/(4*(N-1))) if k = 0 or k = N-1,
+      f = sqrt(1/(2*(N-1))) otherwise.
+
+    Note that the DCT-I is only supported for input size > 1.
 
     type II
     ~~~~~~~
@@ -101,6 +130,21 @@ def dct(x, type=2, n=None, axis=-1, norm=None, overwrite_x=0):
     to a factor `2N`. The orthonormalized DCT-III is exactly the inverse of
     the orthonormalized DCT-II.
 
+    type IV
+    ~~~~~~~
+
+    There are several definitions of the DCT-IV; we use the following
+    (for ``norm=None``)::
+
+                N-1
+      y[k] = 2* sum x[n]*cos(pi*(2k+1)*(2n+1)/(4*N)), 0 <= k < N.
+                n=0
+
+    If ``norm='ortho'``, ``y[k]`` is multiplied by ``sqrt(1/(2*N))``.
+
+    The (unnormalized) DCT-IV is its own inverse, up to a factor `2N`. It is
+    computed with a complex FFT of size N/2 (size 2N if N is odd).
+
     References
     ----------
 
@@ -111,9 +155,6 @@ def dct(x, type=2, n=None, axis=-1, norm=None, overwrite_x=0):
     pp. 27-34, http://dx.doi.org/10.1109/TASSP.1980.1163351 (1980).
 
     """
-    if type == 1 and norm is not None:
-        raise NotImplementedError(
-              "Orthonormalization not yet supported for DCT-I")
     return _dct(x, type, n, axis, normalize=norm, overwrite_x=overwrite_x)
 
 def idct(x, type=2, n=None, axis=-1, norm=None, overwrite_x=0):
@@ -124,7 +165,7 @@ def idct(x, type=2, n=None, axis=-1, norm=None, overwrite_x=0):
     ----------
     x : array_like
         The input array.
-    type : {1, 2, 3}, optional
+    type : {1, 2, 3, 4}, optional
         Type of the DCT (see Notes). Default type is 2.
     n : int, optional
         Length of the transform.
@@ -152,65 +193,234 @@ def idct(x, type=2, n=None, axis=-1, norm=None, overwrite_x=0):
     'The' IDCT is the IDCT of type 2, which is the same as DCT of type 3.
 
     IDCT of type 1 is the DCT of type 1, IDCT of type 2 is the DCT of type 3,
-    and IDCT of type 3 is the DCT of type 2. For the definition of these types,
-    see `dct`.
+    IDCT of type 3 is the DCT of type 2 and IDCT of type 4 is the DCT of
+    type 4. For the definition of these types, see `dct`.
 
     """
-    if type == 1 and norm is not None:
-        raise NotImplementedError(
-              "Orthonormalization not yet supported for IDCT-I")
-    # Inverse/forward type table
-    _TP = {1:1, 2:3, 3:2}
+    if not type in _TP:
+        raise ValueError("Type %d not understood" % type)
     return _dct(x, _TP[type], n, axis, normalize=norm, overwrite_x=overwrite_x)
 
-def _dct(x, type, n=None, axis=-1, overwrite_x=0, normalize=None):
+def dst(x, type=2, n=None, axis=-1, norm=None, overwrite_x=0):
     """
-    Return Discrete Cosine Transform of arbitrary type sequence x.
+    Return the Discrete Sine Transform of arbitrary type sequence x.
 
     Parameters
     ----------
-    x : array-like
-        input array.
+    x : array_like
+        The input array.
+    type : {1, 2, 3, 4}, optional
+        Type of the DST (see Notes). Default type is 2.
     n : int, optional
         Length of the transform.
     axis : int, optional
-        Axis along which the dct is computed. (default=-1)
+        Axis over which to compute the transform.
+    norm : {None, 'ortho'}, optional
+        Normalization mode (see Notes). Default is None.
     overwrite_x : bool, optional
         If True the contents of x can be destroyed. (default=False)
 
     Returns
     -------
-    z : real ndarray
+    y : ndarray of real
+        The transformed input array.
+
+    See Also
+    --------
+    idst, dct
+
+    Notes
+    -----
+    For ``norm=None`` the DSTs are defined as follows, with ``0 <= k < N``.
+
+    type I
+    ~~~~~~
+    ::
+
+                N-1
+      y[k] = 2* sum x[n]*sin(pi*(k+1)*(n+1)/(N+1))
+                n=0
+
+    If ``norm='ortho'``, ``y[k]`` is multiplied by ``sqrt(1/(2*(N+1)))``.
+
+    type II
+    ~~~~~~~
+    ::
+
+                N-1
+      y[k] = 2* sum x[n]*sin(pi*(k+1)*(2n+1)/(2*N))
+                n=0
+
+    If ``norm='ortho'``, ``y[k]`` is multiplied by a scaling factor `f`::
+
+      f = sqrt(1/(4*N)) if k = N-1,
+      f = sqrt(1/(2*N)) otherwise.
+
+    type III
+    ~~~~~~~~
+    ::
+
+                                     N-2
+      y[k] = (-1)**k x[N-1] + 2 * sum x[n]*sin(pi*(2k+1)*(n+1)/(2*N))
+                                     n=0
+
+    If ``norm='ortho'``, ``x[N-1]`` is multiplied by ``sqrt(1/N)`` and the
+    other terms by ``sqrt(1/(2*N))``, which makes it the inverse of the
+    orthonormalized DST-II.
+
+    type IV
+    ~~~~~~~
+    ::
+
+                N-1
+      y[k] = 2* sum x[n]*sin(pi*(2k+1)*(2n+1)/(4*N))
+                n=0
+
+    If ``norm='ortho'``, ``y[k]`` is multiplied by ``sqrt(1/(2*N))``.
+
+    The unnormalized DST-I is its own inverse up to a factor `2(N+1)`, the
+    DST-III is the inverse of the DST-II and the DST-IV its own inverse, up
+    to a factor `2N`.
+
+    """
+    return _dst(x, type, n, axis, normalize=norm, overwrite_x=overwrite_x)
+
+def idst(x, type=2, n=None, axis=-1, norm=None, overwrite_x=0):
+    """
+    Return the Inverse Discrete Sine Transform of an arbitrary type sequence.
+
+    IDST of type 1 is the DST of type 1, IDST of type 2 is the DST of type 3,
+    IDST of type 3 is the DST of type 2 and IDST of type 4 is the DST of
+    type 4. For the parameters and the definition of these types, see `dst`.
+
+    See Also
+    --------
+    dst
+
+    """
+    if not type in _TP:
+        raise ValueError("Type %d not understood" % type)
+    return _dst(x, _TP[type], n, axis, normalize=norm, overwrite_x=overwrite_x)
+
+def dctn(x, type=2, shape=None, axes=None, norm=None, overwrite_x=0):
+    """
+    Return the multi-dimensional Discrete Cosine Transform along the
+    specified axes.
+
+    Parameters
+    ----------
+    x : array_like
+        The input array.
+    type : {1, 2, 3, 4}, optional
+        Type of the DCT (see `dct`). Default type is 2.
+    shape : sequence of ints, optional
+        Length of the transform along each of `axes`.  Axes are zero-padded
+        or truncated as needed.
+    axes : sequence of ints, optional
+        Axes over which to compute the transform.  Default is the last
+        ``len(shape)`` axes, or all axes if `shape` is not given.
+    norm : {None, 'ortho'}, optional
+        Normalization mode (see `dct`). Default is None.
+    overwrite_x : bool, optional
+        If True the contents of x can be destroyed. (default=False)
+
+    Returns
+    -------
+    y : ndarray of real
+        The transformed input array.
+
+    See Also
+    --------
+    idctn, dct
+
+    Examples
+    --------
+    >>> x = np.random.randn(16, 16)
+    >>> np.allclose(x, idctn(dctn(x, norm='ortho'), norm='ortho'))
+    True
+
+    """
+    return _raw_r2rn(_dct, x, type, shape, axes, norm, overwrite_x)
+
+def idctn(x, type=2, shape=None, axes=None, norm=None, overwrite_x=0):
+    """
+    Return the multi-dimensional Inverse Discrete Cosine Transform along the
+    specified axes.
+
+    For the parameters see `dctn`.
+
+    See Also
+    --------
+    dctn, idct
 
     """
+    if not type in _TP:
+        raise ValueError("Type %d not understood" % type)
+    return _raw_r2rn(_dct, x, _TP[type], shape, axes, norm, overwrite_x)
+
+def dstn(x, type=2, shape=None, axes=None, norm=None, overwrite_x=0):
+    """
+    Return the multi-dimensional Discrete Sine Transform along the
+    specified axes.
+
+    For the parameters see `dctn`, and `dst` for the definitions.
+
+    See Also
+    --------
+    idstn, dst
+
+    """
+    return _raw_r2rn(_dst, x, type, shape, axes, norm, overwrite_x)
+
+def idstn(x, type=2, shape=None, axes=None, norm=None, overwrite_x=0):
+    """
+    Return the multi-dimensional Inverse Discrete Sine Transform along the
+    specified axes.
+
+    For the parameters see `dctn`.
+
+    See Also
+    --------
+    dstn, idst
+
+    """
+    if not type in _TP:
+        raise ValueError("Type %d not understood" % type)
+    return _raw_r2rn(_dst, x, _TP[type], shape, axes, norm, overwrite_x)
+
+def _raw_r2rn(func, x, type, shape, axes, norm, overwrite_x):
+    """ Internal auxiliary function for dctn, idctn, dstn, idstn."""
+    tmp = np.asarray(x)
+    if axes is None:
+        if shape is None:
+            axes = range(tmp.ndim)
+        else:
+            axes = range(tmp.ndim - len(shape), tmp.ndim)
+    if shape is None:
+        shape = [None] * len(axes)
+    elif len(shape) != len(axes):
+        raise ValueError("when given, axes and shape arguments "\
+                         "have to be of the same length")
+
+    # Each 1-D transform handles all the lines along its axis in one call,
+    # and only the first one may need to leave x untouched.
+    for n, axis in zip(shape, axes):
+        y = func(tmp, type, n, axis, normalize=norm, overwrite_x=overwrite_x)
+        overwrite_x = 1
+        tmp = y
+    return tmp
+
+def _raw_r2r(table, name, x, type, n, axis, overwrite_x, normalize):
+    """ Internal auxiliary function for _dct, _dst."""
     tmp = np.asarray(x)
     if not np.isrealobj(tmp):
         raise TypeError("1st argument must be real sequence")
 
-    if n is None:
-        n = tmp.shape[axis]
-    else:
-        raise NotImplemented("Padding/truncating not yet implemented")
-
-    if tmp.dtype == np.double:
-        if type == 1:
-            f = _fftpack.ddct1
-        elif type == 2:
-            f = _fftpack.ddct2
-        elif type == 3:
-            f = _fftpack.ddct3
-        else:
-            raise ValueError("Type %d not understood" % type)
-    elif tmp.dtype == np.float32:
-        if type == 1:
-            f = _fftpack.dct1
-        elif type == 2:
-            f = _fftpack.dct2
-        elif type == 3:
-            f = _fftpack.dct3
-        else:
+    try:
+        f = table[tmp.dtype][type]
+    except KeyError:
+        if tmp.dtype in table:
             raise ValueError("Type %d not understood" % type)
-    else:
         raise ValueError("dtype %s not supported" % tmp.dtype)
 
     if normalize:
@@ -221,16 +431,53 @@ def _dct(x, type, n=None, axis=-1, overwrite_x=0, normalize=None):
     else:
         nm = 0
 
-    if type == 1 and n < 2:
+    overwrite_x = overwrite_x or _datacopied(tmp, x)
+
+    if n is None:
+        n = tmp.shape[axis]
+    if name == 'dct' and type == 1 and n < 2:
         raise ValueError("DCT-I is not defined for size < 2")
+    if n < 1:
+        raise ValueError("invalid number of data points (%d) specified" % n)
 
-    overwrite_x = overwrite_x or _datacopied(tmp, x)
+    if n != tmp.shape[axis]:
+        tmp, copy_made = _fix_shape(tmp, n, axis)
+        overwrite_x = overwrite_x or copy_made
 
     if axis == -1 or axis == len(tmp.shape) - 1:
         return f(tmp, n, nm, overwrite_x)
-    #else:
-    #    raise NotImplementedError("Axis arg not yet implemented")
 
     tmp = np.swapaxes(tmp, axis, -1)
     tmp = f(tmp, n, nm, overwrite_x)
     return np.swapaxes(tmp, axis, -1)
+
+def _dct(x, type, n=None, axis=-1, overwrite_x=0, normalize=None):
+    """
+    Return Discrete Cosine Transform of arbitrary type sequence x.
+
+    Parameters
+    ----------
+    x : array-like
+        input array.
+    n : int, optional
+        Length of the transform.
+    axis : int, optional
+        Axis along which the dct is computed. (default=-1)
+    overwrite_x : bool, optional
+        If True the contents of x can be destroyed. (default=False)
+
+    Returns
+    -------
+    z : real ndarray
+
+    """
+    return _raw_r2r(_DCT, 'dct', x, type, n, axis, overwrite_x, normalize)
+
+def _dst(x, type, n=None, axis=-1, overwrite_x=0, normalize=None):
+    """
+    Return Discrete Sine Transform of arbitrary type sequence x.
+
+    See `_dct` for the parameters.
+
+    """
+    return _raw_r2r(_DST, 'dst', x, type, n, axis, overwrite_x, normalize)
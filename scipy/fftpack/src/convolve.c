@@ -9,6 +9,8 @@
   Author: Pearu Peterson, September 2002
  */
 
+#include <math.h>
+
 #include "fftpack.h"
 
 /**************** FFTPACK ZFFT **********************/
@@ -22,9 +24,12 @@ GEN_CACHE(dfftpack, (int n)
           F_FUNC(dffti, DFFTI) (&n, caches_dfftpack[id].wsave);,
           free(caches_dfftpack[id].wsave);, 20)
 
+static void destroy_kernel_bank(void);
+
 extern void destroy_convolve_cache(void)
 {
     destroy_dfftpack_cache();
+    destroy_kernel_bank();
 }
 
 /**************** convolve **********************/
@@ -80,52 +85,332 @@ convolve_z(int n, double *inout, double *omega_real, double *omega_imag)
     F_FUNC(dfftb, DFFTB) (&n, inout, wsave);
 }
 
-extern void
-init_convolution_kernel(int n, double *omega, int d,
-                        double (*kernel_func) (int), int zero_nyquist)
+/*
+   omega[k] = pow(sqrt(-1),d) * kernel_func(k)
+   omega[0] = kernel_func(0)
+   conjugate(omega[-k]) == omega[k]
+
+   kernel_func is called as kernel_func(k, data).
+ */
+static void
+fill_kernel(int n, double *omega, int d,
+            double (*kernel_func) (int, void *), void *data,
+            int zero_nyquist)
 {
-    /*
-       omega[k] = pow(sqrt(-1),d) * kernel_func(k)
-       omega[0] = kernel_func(0)
-       conjugate(omega[-k]) == omega[k]
-     */
     int j, k, l = (n % 2 ? n : n - 1);
-    omega[0] = (*kernel_func) (0) / n;
+    omega[0] = (*kernel_func) (0, data) / n;
     switch (d % 4) {
         case 0:
             for (k = j = 1; j < l; j += 2, ++k)
-                omega[j] = omega[j + 1] = (*kernel_func) (k) / n;
+                omega[j] = omega[j + 1] = (*kernel_func) (k, data) / n;
             if (!(n % 2))
                 omega[n - 1] =
-                    (zero_nyquist ? 0.0 : (*kernel_func) (k) / n);
+                    (zero_nyquist ? 0.0 : (*kernel_func) (k, data) / n);
             break;
         case 1:;
         case -3:
             for (k = j = 1; j < l; j += 2, ++k) {
-                omega[j] = (*kernel_func) (k) / n;
+                omega[j] = (*kernel_func) (k, data) / n;
                 omega[j + 1] = -omega[j];
             }
             if (!(n % 2))
                 omega[n - 1] =
-                    (zero_nyquist ? 0.0 : (*kernel_func) (k) / n);
+                    (zero_nyquist ? 0.0 : (*kernel_func) (k, data) / n);
             break;
         case 2:;
         case -2:
             for (k = j = 1; j < l; j += 2, ++k)
-                omega[j] = omega[j + 1] = -(*kernel_func) (k) / n;
+                omega[j] = omega[j + 1] = -(*kernel_func) (k, data) / n;
             if (!(n % 2))
                 omega[n - 1] =
-                    (zero_nyquist ? 0.0 : -(*kernel_func) (k) / n);
+                    (zero_nyquist ? 0.0 : -(*kernel_func) (k, data) / n);
             break;
         case 3:;
         case -1:
             for (k = j = 1; j < l; j += 2, ++k) {
-                omega[j] = -(*kernel_func) (k) / n;
+                omega[j] = -(*kernel_func) (k, data) / n;
                 omega[j + 1] = -omega[j];
             }
             if (!(n % 2))
                 omega[n - 1] =
-                    (zero_nyquist ? 0.0 : -(*kernel_func) (k) / n);
+                    (zero_nyquist ? 0.0 : -(*kernel_func) (k, data) / n);
+            break;
+    }
+}
+
+typedef struct {
+    double (*func) (int);
+} user_kernel;
+
+static double
+call_user_kernel(int k, void *data)
+{
+    return (*((user_kernel *) data)->func) (k);
+}
+
+extern void
+init_convolution_kernel(int n, double *omega, int d,
+                        double (*kernel_func) (int), int zero_nyquist)
+{
+    user_kernel data;
+    data.func = kernel_func;
+    fill_kernel(n, omega, d, call_user_kernel, &data, zero_nyquist);
+}
+
+/**************** kernel bank **********************/
+
+/*
+  Spectra of the pseudo-differential operators of pseudo_diffs.py,
+  computed in C and kept in a least-recently-used bank bounded by a
+  memory budget.  The operator codes must match those in pseudo_diffs.py.
+ */
+enum {
+    KERNEL_DIFF = 0,            /* a = order, b = 2*pi/period */
+    KERNEL_TILBERT = 1,         /* a = h */
+    KERNEL_ITILBERT = 2,        /* a = h */
+    KERNEL_HILBERT = 3,
+    KERNEL_CS_DIFF = 4,         /* a, b */
+    KERNEL_SC_DIFF = 5,         /* a, b */
+    KERNEL_SS_DIFF = 6,         /* a, b */
+    KERNEL_CC_DIFF = 7,         /* a, b */
+    KERNEL_SHIFT = 8,           /* a */
+    KERNEL_NOPS = 9
+};
+
+typedef struct {
+    int op;
+    double a, b;
+} kernel_params;
+
+typedef struct {
+    int n;
+    kernel_params p;
+    double *omega;              /* 2*n items for KERNEL_SHIFT, n otherwise */
+    size_t nbytes;
+    unsigned long last_used;
+} kernel_entry;
+
+#define KERNEL_BANK_MAX_ENTRIES 256
+
+static kernel_entry kernel_bank[KERNEL_BANK_MAX_ENTRIES];
+static int kernel_bank_len = 0;
+static size_t kernel_bank_nbytes = 0;
+static size_t kernel_bank_budget = 16 * 1024 * 1024;
+static unsigned long kernel_bank_clock = 0;
+
+static double
+bank_kernel(int k, void *data)
+{
+    kernel_params *p = (kernel_params *) data;
+    double a = p->a, b = p->b;
+    switch (p->op) {
+        case KERNEL_DIFF:
+            return k ? pow(b * k, a) : 0.0;
+        case KERNEL_TILBERT:
+            return k ? 1.0 / tanh(a * k) : 0.0;
+        case KERNEL_ITILBERT:
+            return k ? -tanh(a * k) : 0.0;
+        case KERNEL_HILBERT:
+            return k > 0 ? 1.0 : (k < 0 ? -1.0 : 0.0);
+        case KERNEL_CS_DIFF:
+            return k ? -cosh(a * k) / sinh(b * k) : 0.0;
+        case KERNEL_SC_DIFF:
+            return k ? sinh(a * k) / cosh(b * k) : 0.0;
+        case KERNEL_SS_DIFF:
+            return k ? sinh(a * k) / sinh(b * k) : a / b;
+        case KERNEL_CC_DIFF:
+            return cosh(a * k) / cosh(b * k);
+    }
+    return 0.0;
+}
+
+static double
+shift_real_kernel(int k, void *data)
+{
+    return cos(((kernel_params *) data)->a * k);
+}
+
+static double
+shift_imag_kernel(int k, void *data)
+{
+    return sin(((kernel_params *) data)->a * k);
+}
+
+static void
+init_bank_kernel(int n, double *omega, kernel_params * p)
+{
+    int d;
+    switch (p->op) {
+        case KERNEL_SHIFT:
+            fill_kernel(n, omega, 0, shift_real_kernel, p, 0);
+            fill_kernel(n, omega + n, 1, shift_imag_kernel, p, 0);
+            return;
+        case KERNEL_DIFF:
+            d = (int) p->a;
+            fill_kernel(n, omega, d, bank_kernel, p, 1);
+            return;
+        case KERNEL_SS_DIFF:
+        case KERNEL_CC_DIFF:
+            fill_kernel(n, omega, 0, bank_kernel, p, 0);
+            return;
+        default:
+            fill_kernel(n, omega, 1, bank_kernel, p, 1);
+            return;
+    }
+}
+
+static void
+evict_kernel(int id)
+{
+    free(kernel_bank[id].omega);
+    kernel_bank_nbytes -= kernel_bank[id].nbytes;
+    kernel_bank[id] = kernel_bank[--kernel_bank_len];
+}
+
+/*
+  Evict least recently used kernels until nbytes more fit in the budget
+  and there is a free slot.
+ */
+static void
+make_room(size_t nbytes)
+{
+    int i, lru;
+    while (kernel_bank_len > 0
+           && (kernel_bank_len == KERNEL_BANK_MAX_ENTRIES
+               || kernel_bank_nbytes + nbytes > kernel_bank_budget)) {
+        lru = 0;
+        for (i = 1; i < kernel_bank_len; ++i)
+            if (kernel_bank[i].last_used < kernel_bank[lru].last_used)
+                lru = i;
+        evict_kernel(lru);
+    }
+}
+
+static double *
+get_bank_kernel(int n, kernel_params * p)
+{
+    int i;
+    size_t nbytes = sizeof(double) * (p->op == KERNEL_SHIFT ? 2 * n : n);
+    kernel_entry *e;
+    for (i = 0; i < kernel_bank_len; ++i) {
+        e = kernel_bank + i;
+        if (e->n == n && e->p.op == p->op && e->p.a == p->a
+            && e->p.b == p->b) {
+            e->last_used = ++kernel_bank_clock;
+            return e->omega;
+        }
+    }
+    /* A kernel larger than the budget is still cached on its own, it is
+       evicted by the next insertion. */
+    make_room(nbytes);
+    e = kernel_bank + kernel_bank_len;
+    e->omega = (double *) malloc(nbytes);
+    if (e->omega == NULL)
+        return NULL;
+    e->nbytes = nbytes;
+    e->n = n;
+    e->p = *p;
+    e->last_used = ++kernel_bank_clock;
+    init_bank_kernel(n, e->omega, p);
+    kernel_bank_nbytes += e->nbytes;
+    ++kernel_bank_len;
+    return e->omega;
+}
+
+static void
+destroy_kernel_bank(void)
+{
+    while (kernel_bank_len > 0)
+        evict_kernel(kernel_bank_len - 1);
+}
+
+/*
+  Set the memory budget of the kernel bank in bytes, shrinking it if
+  needed.  Returns the previous budget.
+ */
+extern int
+set_kernel_bank_size(int nbytes)
+{
+    int old = (int) kernel_bank_budget;
+    if (nbytes >= 0) {
+        kernel_bank_budget = (size_t) nbytes;
+        make_room(0);
+    }
+    return old;
+}
+
+/*
+  Apply the operator op with parameters a, b to howmany contiguous rows of
+  length n: forward FFT, multiplication by the cached spectrum and
+  backward FFT, row by row.
+ */
+extern void
+kernel_convolve(int n, int howmany, double *inout, int op, double a,
+                double b)
+{
+    int i, j, n1 = n - 1, swap;
+    double *wsave = NULL, *omega, *omega_imag, *ptr = inout, c;
+    kernel_params p;
+
+    if (op < 0 || op >= KERNEL_NOPS) {
+        fprintf(stderr, "kernel_convolve: invalid op=%d\n", op);
+        return;
+    }
+    p.op = op;
+    p.a = a;
+    p.b = b;
+    omega = get_bank_kernel(n, &p);
+    if (omega == NULL) {
+        fprintf(stderr, "kernel_convolve: out of memory\n");
+        return;
+    }
+    wsave = caches_dfftpack[get_cache_id_dfftpack(n)].wsave;
+
+    if (op == KERNEL_SHIFT) {
+        omega_imag = omega + n;
+        for (i = 0; i < howmany; ++i, ptr += n) {
+            F_FUNC(dfftf, DFFTF) (&n, ptr, wsave);
+            ptr[0] *= (omega[0] + omega_imag[0]);
+            if (!(n % 2))
+                ptr[n - 1] *= (omega[n - 1] + omega_imag[n - 1]);
+            for (j = 1; j < n1; j += 2) {
+                c = ptr[j] * omega_imag[j];
+                ptr[j] *= omega[j];
+                ptr[j] += ptr[j + 1] * omega_imag[j + 1];
+                ptr[j + 1] *= omega[j + 1];
+                ptr[j + 1] += c;
+            }
+            F_FUNC(dfftb, DFFTB) (&n, ptr, wsave);
+        }
+        return;
+    }
+
+    switch (op) {
+        case KERNEL_DIFF:
+            swap = ((int) a) % 2;
             break;
+        case KERNEL_SS_DIFF:
+        case KERNEL_CC_DIFF:
+            swap = 0;
+            break;
+        default:
+            swap = 1;
+    }
+
+    for (i = 0; i < howmany; ++i, ptr += n) {
+        F_FUNC(dfftf, DFFTF) (&n, ptr, wsave);
+        if (swap) {
+            ptr[0] *= omega[0];
+            if (!(n % 2))
+                ptr[n - 1] *= omega[n - 1];
+            for (j = 1; j < n1; j += 2) {
+                c = ptr[j] * omega[j];
+                ptr[j] = ptr[j + 1] * omega[j + 1];
+                ptr[j + 1] = c;
+            }
+        } else
+            for (j = 0; j < n; ++j)
+                ptr[j] *= omega[j];
+        F_FUNC(dfftb, DFFTB) (&n, ptr, wsave);
     }
 }
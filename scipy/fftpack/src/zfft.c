@@ -4,8 +4,15 @@
   Author: Pearu Peterson, August 2002
  */
 
+#include <math.h>
+#include <time.h>
+
 #include "fftpack.h"
 
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
 extern void F_FUNC(zfftf,ZFFTF)(int*,double*,double*);
 extern void F_FUNC(zfftb,ZFFTB)(int*,double*,double*);
 extern void F_FUNC(zffti,ZFFTI)(int*,double*);
@@ -13,14 +20,289 @@ extern void F_FUNC(cfftf,CFFTF)(int*,float*,float*);
 extern void F_FUNC(cfftb,CFFTB)(int*,float*,float*);
 extern void F_FUNC(cffti,CFFTI)(int*,float*);
 
+/*
+  Algorithms available for zfft.  FFTPACK is used unless the wisdom table
+  says otherwise; with autotuning on, sizes missing from the table are
+  timed with every algorithm when first seen and the winner is recorded.
+ */
+enum {
+    ZFFT_FFTPACK = 0,
+    ZFFT_BLUESTEIN = 1,
+    ZFFT_NALGOS = 2
+};
+
+/*
+  Bluestein's algorithm: a length n DFT written as a convolution with the
+  chirp exp(-i*pi*k**2/n), done with power of two FFTs of length m >= 2n-1.
+  Worth it for sizes with large prime factors.
+ */
+typedef struct {
+    int m;
+    double *wsave;              /* zffti(m) */
+    complex_double *chirp;      /* n items */
+    complex_double *spectrum;   /* m items, FFT of the conjugate chirp / m */
+    complex_double *work;       /* m items */
+} bluestein_plan;
+
+static bluestein_plan *bluestein_new(int n)
+{
+    int k, m = 1;
+    long long k2;
+    double t;
+    bluestein_plan *p = (bluestein_plan *) malloc(sizeof(bluestein_plan));
+
+    while (m < 2 * n - 1)
+        m *= 2;
+    p->m = m;
+    p->wsave = (double *) malloc(sizeof(double) * (4 * m + 15));
+    p->chirp = (complex_double *) malloc(sizeof(complex_double) * n);
+    p->spectrum = (complex_double *) malloc(sizeof(complex_double) * m);
+    p->work = (complex_double *) malloc(sizeof(complex_double) * m);
+    F_FUNC(zffti,ZFFTI)(&m, p->wsave);
+
+    for (k = 0; k < n; ++k) {
+        /* k**2 mod 2n keeps the angle accurate for large k */
+        k2 = ((long long) k * k) % (2 * (long long) n);
+        t = M_PI * k2 / n;
+        p->chirp[k].r = cos(t);
+        p->chirp[k].i = -sin(t);
+    }
+    for (k = 0; k < m; ++k)
+        p->spectrum[k].r = p->spectrum[k].i = 0.0;
+    p->spectrum[0].r = 1.0 / m;
+    for (k = 1; k < n; ++k) {
+        p->spectrum[k].r = p->spectrum[m - k].r = p->chirp[k].r / m;
+        p->spectrum[k].i = p->spectrum[m - k].i = -p->chirp[k].i / m;
+    }
+    F_FUNC(zfftf,ZFFTF)(&m, (double *) p->spectrum, p->wsave);
+    return p;
+}
+
+static void bluestein_free(bluestein_plan *p)
+{
+    if (p == NULL)
+        return;
+    free(p->wsave);
+    free(p->chirp);
+    free(p->spectrum);
+    free(p->work);
+    free(p);
+}
+
+static void bluestein_apply(bluestein_plan *p, complex_double *ptr, int n,
+                            int direction)
+{
+    int k, m = p->m;
+    /* the backward transform is conj(forward(conj(x))) */
+    double s = (direction == 1) ? 1.0 : -1.0, r, i;
+    complex_double *w = p->chirp, *a = p->work, *b = p->spectrum;
+
+    for (k = 0; k < n; ++k) {
+        a[k].r = ptr[k].r * w[k].r - s * ptr[k].i * w[k].i;
+        a[k].i = s * ptr[k].i * w[k].r + ptr[k].r * w[k].i;
+    }
+    for (k = n; k < m; ++k)
+        a[k].r = a[k].i = 0.0;
+    F_FUNC(zfftf,ZFFTF)(&m, (double *) a, p->wsave);
+    for (k = 0; k < m; ++k) {
+        r = a[k].r * b[k].r - a[k].i * b[k].i;
+        i = a[k].r * b[k].i + a[k].i * b[k].r;
+        a[k].r = r;
+        a[k].i = i;
+    }
+    F_FUNC(zfftb,ZFFTB)(&m, (double *) a, p->wsave);
+    for (k = 0; k < n; ++k) {
+        ptr[k].r = a[k].r * w[k].r - a[k].i * w[k].i;
+        ptr[k].i = s * (a[k].r * w[k].i + a[k].i * w[k].r);
+    }
+}
+
+/**************** wisdom **********************/
+
+#define ZFFT_WISDOM_MAX 4096
+
+static int zfft_wisdom_n[ZFFT_WISDOM_MAX];
+static int zfft_wisdom_algo[ZFFT_WISDOM_MAX];
+static int zfft_wisdom_len = 0;
+static int zfft_autotune_flag = 0;
+
+static int zfft_wisdom_lookup(int n)
+{
+    int i;
+    for (i = 0; i < zfft_wisdom_len; ++i)
+        if (zfft_wisdom_n[i] == n)
+            return zfft_wisdom_algo[i];
+    return -1;
+}
+
+static void zfft_wisdom_record(int n, int algo)
+{
+    int i;
+    for (i = 0; i < zfft_wisdom_len; ++i)
+        if (zfft_wisdom_n[i] == n) {
+            zfft_wisdom_algo[i] = algo;
+            return;
+        }
+    if (zfft_wisdom_len < ZFFT_WISDOM_MAX) {
+        zfft_wisdom_n[zfft_wisdom_len] = n;
+        zfft_wisdom_algo[zfft_wisdom_len++] = algo;
+    }
+}
+
+/* Seconds per transform of size n with the given algorithm. */
+static double zfft_time(int n, int algo, double *wsave, bluestein_plan *p)
+{
+    int i, reps = 0;
+    clock_t start, elapsed;
+    complex_double *x = (complex_double *) malloc(sizeof(complex_double) * n);
+
+    for (i = 0; i < n; ++i) {
+        x[i].r = (double) (i % 7) - 3.0;
+        x[i].i = (double) (i % 5) - 2.0;
+    }
+    start = clock();
+    do {
+        if (algo == ZFFT_BLUESTEIN)
+            bluestein_apply(p, x, n, 1);
+        else
+            F_FUNC(zfftf,ZFFTF)(&n, (double *) x, wsave);
+        ++reps;
+        elapsed = clock() - start;
+    } while (elapsed < CLOCKS_PER_SEC / 100);
+    free(x);
+    return ((double) elapsed / CLOCKS_PER_SEC) / reps;
+}
+
+/*
+  Rough flop counts used to skip timings whose outcome is clear: FFTPACK
+  does n*p work per prime factor p, Bluestein two FFTs of length m.
+ */
+static double zfft_fftpack_cost(int n)
+{
+    int p;
+    double c = 0.0;
+    for (p = 2; n > 1; ++p) {
+        if ((double) p * p > n)
+            p = n;
+        while (n % p == 0) {
+            c += p;
+            n /= p;
+        }
+    }
+    return c;
+}
+
+static double zfft_bluestein_cost(int n)
+{
+    int m = 1;
+    double lg = 0.0;
+    while (m < 2 * n - 1) {
+        m *= 2;
+        lg += 1.0;
+    }
+    return 2.0 * 2.0 * m * lg / n + 6.0 * m / n;
+}
+
+/*
+  Pick the algorithm for a new cache entry of size n, creating the
+  Bluestein plan in *p if it is the one chosen.
+ */
+static int zfft_choose_algo(int n, double *wsave, bluestein_plan **p)
+{
+    int algo = zfft_wisdom_lookup(n);
+    double ratio;
+
+    if (algo < 0 && zfft_autotune_flag && n > 1) {
+        ratio = zfft_fftpack_cost(n) / zfft_bluestein_cost(n);
+        if (ratio < 0.25) {
+            algo = ZFFT_FFTPACK;
+        } else if (ratio > 16.0) {
+            algo = ZFFT_BLUESTEIN;
+        } else {
+            *p = bluestein_new(n);
+            if (zfft_time(n, ZFFT_BLUESTEIN, wsave, *p)
+                    < zfft_time(n, ZFFT_FFTPACK, wsave, *p))
+                algo = ZFFT_BLUESTEIN;
+            else
+                algo = ZFFT_FFTPACK;
+        }
+        zfft_wisdom_record(n, algo);
+    }
+    if (algo == ZFFT_BLUESTEIN) {
+        if (*p == NULL)
+            *p = bluestein_new(n);
+    } else {
+        bluestein_free(*p);
+        *p = NULL;
+        algo = ZFFT_FFTPACK;
+    }
+    return algo;
+}
+
 GEN_CACHE(zfft,(int n)
-	  ,double* wsave;
+	  ,double* wsave; int algo; bluestein_plan *bluestein;
 	  ,(caches_zfft[i].n==n)
 	  ,caches_zfft[id].wsave = (double*)malloc(sizeof(double)*(4*n+15));
 	   F_FUNC(zffti,ZFFTI)(&n,caches_zfft[id].wsave);
+	   caches_zfft[id].bluestein = NULL;
+	   caches_zfft[id].algo = zfft_choose_algo(n, caches_zfft[id].wsave,
+						   &caches_zfft[id].bluestein);
 	  ,free(caches_zfft[id].wsave);
+	   bluestein_free(caches_zfft[id].bluestein);
+	   caches_zfft[id].bluestein = NULL;
 	  ,10)
 
+/*
+  Turn autotuning on (flag > 0) or off (flag == 0); returns the previous
+  setting.  A negative flag only queries it.
+ */
+int zfft_autotune(int flag)
+{
+    int old = zfft_autotune_flag;
+    if (flag >= 0)
+        zfft_autotune_flag = flag;
+    return old;
+}
+
+/* Algorithm that zfft uses for size n. */
+int zfft_algorithm(int n)
+{
+    return caches_zfft[get_cache_id_zfft(n)].algo;
+}
+
+int zfft_wisdom_size(void)
+{
+    return zfft_wisdom_len;
+}
+
+void zfft_wisdom_get(int *ns, int *algos, int k)
+{
+    int i;
+    for (i = 0; i < k && i < zfft_wisdom_len; ++i) {
+        ns[i] = zfft_wisdom_n[i];
+        algos[i] = zfft_wisdom_algo[i];
+    }
+}
+
+/*
+  Merge k (size, algorithm) pairs into the wisdom table.  Cached plans are
+  dropped so that they are rebuilt with the new choices.
+ */
+void zfft_wisdom_put(int *ns, int *algos, int k)
+{
+    int i;
+    for (i = 0; i < k; ++i)
+        if (ns[i] > 0 && algos[i] >= 0 && algos[i] < ZFFT_NALGOS)
+            zfft_wisdom_record(ns[i], algos[i]);
+    destroy_zfft_cache();
+}
+
+void zfft_wisdom_forget(void)
+{
+    zfft_wisdom_len = 0;
+    destroy_zfft_cache();
+}
+
 GEN_CACHE(cfft,(int n)
 	  ,float* wsave;
 	  ,(caches_cfft[i].n==n)
@@ -32,12 +314,20 @@ GEN_CACHE(cfft,(int n)
 void zfft(complex_double * inout, int n, int direction, int howmany,
 		int normalize)
 {
-	int i;
+	int i, id;
 	complex_double *ptr = inout;
 	double *wsave = NULL;
 
-	wsave = caches_zfft[get_cache_id_zfft(n)].wsave;
+	id = get_cache_id_zfft(n);
+	wsave = caches_zfft[id].wsave;
 
+	if (caches_zfft[id].algo == ZFFT_BLUESTEIN
+	    && (direction == 1 || direction == -1)) {
+		for (i = 0; i < howmany; ++i, ptr += n) {
+			bluestein_apply(caches_zfft[id].bluestein, ptr, n,
+					direction);
+		}
+	} else
 	switch (direction) {
 	case 1:
 		for (i = 0; i < howmany; ++i, ptr += n) {
@@ -14,7 +14,8 @@ Run tests if fftpack is not installed:
 from numpy.testing import assert_, assert_equal, assert_array_almost_equal, \
         assert_array_almost_equal_nulp, assert_raises, run_module_suite, \
         TestCase, dec
-from scipy.fftpack import ifft,fft,fftn,ifftn,rfft,irfft, fft2
+from scipy.fftpack import ifft,fft,fftn,ifftn,rfft,irfft, fft2, \
+        rfftn, irfftn
 from scipy.fftpack import _fftpack as fftpack
 
 from numpy import arange, add, array, asarray, zeros, dot, exp, pi,\
@@ -617,6 +618,61 @@ class TestIfftnSingle(_TestIfftn):
     cdtype = np.complex64
     maxnlp = 3500
 
+class _TestRfftn(TestCase):
+    dtype = None
+    cdtype = None
+
+    def setUp(self):
+        np.random.seed(1234)
+
+    def test_definition(self):
+        for shape in [(3,3), (20,26), (5,4,3,20), (4,7), (7,)]:
+            x = random(shape).astype(self.dtype)
+            y = rfftn(x)
+            assert_(y.dtype == self.cdtype)
+            h = shape[-1]//2 + 1
+            assert_equal(y.shape, shape[:-1] + (h,))
+            assert_array_almost_equal(y, direct_dftn(x)[..., :h],
+                                      decimal=self.decimal)
+
+    def test_axes_argument(self):
+        x = random((5,4,6)).astype(self.dtype)
+        y = rfftn(x, axes=(0,2))
+        assert_equal(y.shape, (5,4,4))
+        y_r = fftn(x, axes=(0,2))[:, :, :4]
+        assert_array_almost_equal(y, y_r, decimal=self.decimal)
+        # the real transform is done along the last given axis
+        y = rfftn(x, axes=(2,0))
+        assert_equal(y.shape, (3,4,6))
+        y_r = fftn(x, axes=(0,2))[:3]
+        assert_array_almost_equal(y, y_r, decimal=self.decimal)
+
+    def test_shape_argument(self):
+        x = random((5,7)).astype(self.dtype)
+        y = rfftn(x, shape=(8,10))
+        y_r = fftn(x, shape=(8,10))[:, :6]
+        assert_array_almost_equal(y, y_r, decimal=self.decimal)
+
+    def test_inverse(self):
+        for shape in [(1,1), (2,2), (9,9), (6,5,4), (3,7,5)]:
+            x = random(shape).astype(self.dtype)
+            y = irfftn(rfftn(x), shape)
+            assert_(y.dtype == self.dtype)
+            assert_array_almost_equal(y, x, decimal=self.decimal)
+        x = random((5,4,6)).astype(self.dtype)
+        y = irfftn(rfftn(x, axes=(2,0)), (6,5), axes=(2,0))
+        assert_array_almost_equal(y, x, decimal=self.decimal)
+
+class TestRfftnDouble(_TestRfftn):
+    dtype = np.float64
+    cdtype = np.complex128
+    decimal = 10
+
+class TestRfftnSingle(_TestRfftn):
+    dtype = np.float32
+    cdtype = np.complex64
+    decimal = 4
+
 class TestLongDoubleFailure(TestCase):
     def setUp(self):
         np.random.seed(1234)
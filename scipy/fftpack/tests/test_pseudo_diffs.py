@@ -15,6 +15,7 @@ from numpy.testing import *
 from scipy.fftpack import diff, fft, ifft, tilbert, itilbert, hilbert, \
                           ihilbert, shift, fftfreq, cs_diff, sc_diff, \
                           ss_diff, cc_diff
+from scipy.fftpack import convolve
 
 import numpy as np
 from numpy import arange, sin, cos, pi, exp, tanh, sum, sign
@@ -314,6 +315,51 @@ class TestShift(TestCase):
             assert_array_almost_equal(shift(sin(x),pi/2),cos(x))
 
 
+class TestRows(TestCase):
+    """Operators act on each row of a 2-d array."""
+
+    def _check(self, routine, *args):
+        np.random.seed(1234)
+        for n in [16, 17]:
+            x = np.random.randn(5, n)
+            y = routine(x, *args)
+            assert_equal(y.shape, x.shape)
+            for i in range(x.shape[0]):
+                assert_array_almost_equal(y[i], routine(x[i], *args))
+
+    def test_diff(self):
+        self._check(diff)
+        self._check(diff, 2)
+        self._check(diff, -1, 3.0)
+
+    def test_tilbert(self):
+        self._check(tilbert, 1.6)
+        self._check(itilbert, 1.6)
+
+    def test_hilbert(self):
+        self._check(hilbert)
+
+    def test_ab_diffs(self):
+        for routine in [cs_diff, sc_diff, ss_diff, cc_diff]:
+            self._check(routine, 1.0, 4.0)
+
+    def test_shift(self):
+        self._check(shift, 0.3)
+
+class TestKernelBank(TestCase):
+
+    def test_budget(self):
+        old = convolve.set_kernel_bank_size(1024)
+        try:
+            x = arange(64)*2*pi/64
+            # every kernel is larger than the budget, results must not
+            # depend on what was evicted
+            for a in [0.1, 0.2, 0.3, 0.1]:
+                assert_array_almost_equal(shift(sin(x), a), sin(x+a))
+            assert_equal(convolve.set_kernel_bank_size(), 1024)
+        finally:
+            convolve.set_kernel_bank_size(old)
+
 class TestOverwrite(object):
     """
     Check input overwrite behavior
@@ -5,7 +5,8 @@ import numpy as np
 from numpy.fft import fft as numfft
 from numpy.testing import assert_array_almost_equal, assert_equal, TestCase
 
-from scipy.fftpack.realtransforms import dct, idct
+from scipy.fftpack.realtransforms import dct, idct, dst, idst, dctn, idctn, \
+        dstn, idstn
 
 # Matlab reference data
 MDATA = np.load(join(dirname(__file__), 'test.npz'))
@@ -32,6 +33,25 @@ def fftw_ref(type, size, dt):
     y = (data['dct_%d_%d' % (type, size)]).astype(dt)
     return x, y
 
+def direct_r2r(kind, type, x):
+    """Naive O(N**2) DCT/DST, following the definitions in dct/dst."""
+    x = np.asarray(x, dtype=np.double)
+    N = len(x)
+    n = np.arange(N)
+    k = n[:, np.newaxis]
+    if kind == 'dct' and type == 4:
+        m = 2 * np.cos(np.pi * (2*k+1) * (2*n+1) / (4.*N))
+    elif type == 1:
+        m = 2 * np.sin(np.pi * (k+1) * (n+1) / (N+1.))
+    elif type == 2:
+        m = 2 * np.sin(np.pi * (k+1) * (2*n+1) / (2.*N))
+    elif type == 3:
+        m = 2 * np.sin(np.pi * (2*k+1) * (n+1) / (2.*N))
+        m[:, -1] = (-1)**n
+    else:
+        m = 2 * np.sin(np.pi * (2*k+1) * (2*n+1) / (4.*N))
+    return np.dot(m, x)
+
 class _TestDCTBase(TestCase):
     def setUp(self):
         self.rdt = None
@@ -184,6 +204,166 @@ class TestIDCTIIIFloat(_TestIDCTBase):
         self.dec = 5
         self.type = 3
 
+class _TestDCTIVBase(_TestDCTBase):
+    def test_definition(self):
+        for i in [1, 2, 5, 8, 15, 16, 33]:
+            x = np.random.randn(i).astype(self.rdt)
+            y = dct(x, type=4)
+            self.assertTrue(y.dtype == self.rdt)
+            yr = direct_r2r('dct', 4, x)
+            assert_array_almost_equal(y / np.max(np.abs(yr)),
+                                      yr / np.max(np.abs(yr)),
+                                      decimal=self.dec,
+                                      err_msg="Size %d failed" % i)
+
+class TestDCTIVDouble(_TestDCTIVBase):
+    def setUp(self):
+        self.rdt = np.double
+        self.dec = 12
+        self.type = 4
+
+class TestDCTIVFloat(_TestDCTIVBase):
+    def setUp(self):
+        self.rdt = np.float32
+        self.dec = 5
+        self.type = 4
+
+class _TestDSTBase(TestCase):
+    def setUp(self):
+        self.rdt = None
+        self.dec = None
+        self.type = None
+
+    def test_definition(self):
+        for i in [1, 2, 5, 8, 15, 16, 33]:
+            x = np.random.randn(i).astype(self.rdt)
+            y = dst(x, type=self.type)
+            self.assertTrue(y.dtype == self.rdt,
+                    "Output dtype is %s, expected %s" % (y.dtype, self.rdt))
+            yr = direct_r2r('dst', self.type, x)
+            assert_array_almost_equal(y / np.max(np.abs(yr)),
+                                      yr / np.max(np.abs(yr)),
+                                      decimal=self.dec,
+                                      err_msg="Size %d failed" % i)
+
+    def test_axis(self):
+        nt = 2
+        for i in [7, 8, 9, 16, 32, 64]:
+            x = np.random.randn(nt, i)
+            y = dst(x, type=self.type)
+            for j in range(nt):
+                assert_array_almost_equal(y[j], dst(x[j], type=self.type),
+                        decimal=self.dec)
+
+            x = x.T
+            y = dst(x, axis=0, type=self.type)
+            for j in range(nt):
+                assert_array_almost_equal(y[:,j], dst(x[:,j], type=self.type),
+                        decimal=self.dec)
+
+    def test_inverse(self):
+        for i in [2, 5, 16]:
+            x = np.random.randn(i).astype(self.rdt)
+            xi = idst(dst(x, type=self.type), type=self.type)
+            if self.type == 1:
+                xi /= 2 * (i+1)
+            else:
+                xi /= 2 * i
+            assert_array_almost_equal(xi, x, decimal=self.dec)
+
+class TestDSTIDouble(_TestDSTBase):
+    def setUp(self):
+        self.rdt = np.double
+        self.dec = 12
+        self.type = 1
+
+class TestDSTIFloat(_TestDSTBase):
+    def setUp(self):
+        self.rdt = np.float32
+        self.dec = 5
+        self.type = 1
+
+class TestDSTIIDouble(_TestDSTBase):
+    def setUp(self):
+        self.rdt = np.double
+        self.dec = 12
+        self.type = 2
+
+class TestDSTIIFloat(_TestDSTBase):
+    def setUp(self):
+        self.rdt = np.float32
+        self.dec = 5
+        self.type = 2
+
+class TestDSTIIIDouble(_TestDSTBase):
+    def setUp(self):
+        self.rdt = np.double
+        self.dec = 12
+        self.type = 3
+
+class TestDSTIIIFloat(_TestDSTBase):
+    def setUp(self):
+        self.rdt = np.float32
+        self.dec = 5
+        self.type = 3
+
+class TestDSTIVDouble(_TestDSTBase):
+    def setUp(self):
+        self.rdt = np.double
+        self.dec = 12
+        self.type = 4
+
+class TestDSTIVFloat(_TestDSTBase):
+    def setUp(self):
+        self.rdt = np.float32
+        self.dec = 5
+        self.type = 4
+
+class TestOrthoInverse(TestCase):
+    def test_ortho(self):
+        """The orthonormalized transforms are inverse of each other."""
+        x = np.random.randn(17)
+        for f, fi in [(dct, idct), (dst, idst)]:
+            for type in [1, 2, 3, 4]:
+                y = f(x, type=type, norm='ortho')
+                assert_array_almost_equal(np.dot(y, y), np.dot(x, x))
+                assert_array_almost_equal(fi(y, type=type, norm='ortho'), x)
+
+    def test_n_argument(self):
+        x = np.random.randn(10)
+        for f in [dct, dst]:
+            for type in [1, 2, 3, 4]:
+                assert_array_almost_equal(f(x, type=type, n=6),
+                                          f(x[:6], type=type))
+                xp = np.concatenate((x, np.zeros(4)))
+                assert_array_almost_equal(f(x, type=type, n=14),
+                                          f(xp, type=type))
+
+class TestMultiDim(TestCase):
+    def test_definition(self):
+        x = np.random.randn(4, 5, 6)
+        for fn, f in [(dctn, dct), (dstn, dst)]:
+            for type in [1, 2, 3, 4]:
+                y = f(f(f(x, type=type, axis=0), type=type, axis=1),
+                      type=type, axis=2)
+                assert_array_almost_equal(fn(x, type=type), y)
+                y = f(f(x, type=type, axis=0), type=type, axis=2)
+                assert_array_almost_equal(fn(x, type=type, axes=(0, 2)), y)
+
+    def test_inverse(self):
+        x = np.random.randn(8, 8, 3)
+        for fn, fi in [(dctn, idctn), (dstn, idstn)]:
+            for type in [1, 2, 3, 4]:
+                y = fn(x, type=type, axes=(0, 1), norm='ortho')
+                assert_array_almost_equal(fi(y, type=type, axes=(0, 1),
+                                             norm='ortho'), x)
+
+    def test_shape_argument(self):
+        x = np.random.randn(5, 7)
+        y = dctn(x, shape=(8, 4))
+        assert_equal(y.shape, (8, 4))
+        assert_array_almost_equal(y, dct(dct(x, n=8, axis=0), n=4, axis=1))
+
 class TestOverwrite(object):
     """
     Check input overwrite behavior
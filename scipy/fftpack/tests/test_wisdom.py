@@ -0,0 +1,95 @@
+#!/usr/bin/env python
+""" Test functions for fftpack.wisdom module
+"""
+
+import os
+import tempfile
+
+from numpy.testing import *
+from numpy import arange, exp, dot, zeros, cdouble, pi, asarray
+from numpy.random import rand
+
+from scipy.fftpack import fft, ifft, fftn, fft_autotune, save_wisdom, \
+        load_wisdom, forget_wisdom
+import scipy.fftpack._fftpack as _fftpack
+
+def direct_dft(x):
+    x = asarray(x)
+    n = len(x)
+    y = zeros(n,dtype=cdouble)
+    w = -arange(n)*(2j*pi/n)
+    for i in range(n):
+        y[i] = dot(exp(i*w),x)
+    return y
+
+def _write(text):
+    fd, name = tempfile.mkstemp()
+    f = os.fdopen(fd, 'w')
+    f.write(text)
+    f.close()
+    return name
+
+class TestWisdom(TestCase):
+
+    def setUp(self):
+        forget_wisdom()
+        self.old = fft_autotune(False)
+
+    def tearDown(self):
+        forget_wisdom()
+        fft_autotune(self.old)
+
+    def test_bluestein(self):
+        name = _write('# scipy.fftpack wisdom 1\n'
+                      'zfft 7 bluestein\nzfft 97 bluestein\n'
+                      'zfft 1000 bluestein\n')
+        try:
+            assert_equal(load_wisdom(name), 3)
+        finally:
+            os.remove(name)
+        for n in [7, 97, 1000]:
+            assert_equal(_fftpack.zfft_algorithm(n), 1)
+            x = rand(n) + 1j*rand(n)
+            assert_array_almost_equal(fft(x), direct_dft(x))
+            assert_array_almost_equal(ifft(fft(x)), x)
+        x = rand(97, 7) + 1j*rand(97, 7)
+        y = fft(fft(x, axis=0), axis=1)
+        assert_array_almost_equal(fftn(x), y)
+
+    def test_default(self):
+        for n in [7, 1009]:
+            assert_equal(_fftpack.zfft_algorithm(n), 0)
+
+    def test_roundtrip(self):
+        fft_autotune(True)
+        for n in [16, 1009, 4099]:
+            x = rand(n) + 1j*rand(n)
+            assert_array_almost_equal(ifft(fft(x)), x)
+        fft_autotune(False)
+        algos = [_fftpack.zfft_algorithm(n) for n in [16, 1009, 4099]]
+        assert_equal(algos[0], 0)
+        name = tempfile.mktemp()
+        try:
+            assert_equal(save_wisdom(name), 3)
+            forget_wisdom()
+            assert_equal(load_wisdom(name), 3)
+        finally:
+            os.remove(name)
+        assert_equal([_fftpack.zfft_algorithm(n) for n in [16, 1009, 4099]],
+                     algos)
+
+    def test_bad_file(self):
+        name = _write('zfft 7 bluestein\n')
+        try:
+            assert_raises(ValueError, load_wisdom, name)
+        finally:
+            os.remove(name)
+        name = _write('# scipy.fftpack wisdom 1\nrfft 8 bluestein\n'
+                      'zfft 9 radix7\nzfft 11 fftpack\n')
+        try:
+            assert_equal(load_wisdom(name), 1)
+        finally:
+            os.remove(name)
+
+if __name__ == "__main__":
+    run_module_suite()
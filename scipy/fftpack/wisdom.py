@@ -0,0 +1,75 @@
+"""
+FFT autotuning and wisdom files - wisdom.py
+
+Complex transforms of sizes with large prime factors can be done either
+directly by FFTPACK or with Bluestein's algorithm on top of power of two
+transforms.  The choice is made once per size, when the transform's work
+array is cached.  Without any wisdom FFTPACK is always used; with
+autotuning on, new sizes are timed and the faster algorithm is recorded.
+"""
+
+__all__ = ['fft_autotune', 'save_wisdom', 'load_wisdom', 'forget_wisdom']
+
+import _fftpack
+
+_ALGORITHMS = ['fftpack', 'bluestein']
+
+_HEADER = '# scipy.fftpack wisdom 1'
+
+
+def fft_autotune(flag=True):
+    """Turn on (or off) timing of new transform sizes.
+
+    Returns the previous setting. Applies to double precision complex
+    transforms (fft, ifft, fftn, ...) of sizes that have not yet been
+    used, or that were dropped from the cache.
+    """
+    return bool(_fftpack.zfft_autotune(int(bool(flag))))
+
+
+def save_wisdom(filename):
+    """Write the recorded algorithm choices to a text file.
+
+    Returns the number of sizes written.
+    """
+    k = _fftpack.zfft_wisdom_size()
+    ns, algos = _fftpack.zfft_wisdom_get(k)
+    f = open(filename, 'w')
+    try:
+        f.write(_HEADER + '\n')
+        for n, a in zip(ns, algos):
+            f.write('zfft %d %s\n' % (n, _ALGORITHMS[a]))
+    finally:
+        f.close()
+    return k
+
+
+def load_wisdom(filename):
+    """Merge the algorithm choices stored by save_wisdom.
+
+    Returns the number of sizes read. Lines for unknown transforms or
+    algorithms are skipped so that files from newer versions still load.
+    """
+    f = open(filename, 'r')
+    try:
+        lines = f.readlines()
+    finally:
+        f.close()
+    if not lines or lines[0].strip() != _HEADER:
+        raise ValueError("%s is not an fftpack wisdom file" % filename)
+    ns, algos = [], []
+    for line in lines[1:]:
+        fields = line.split()
+        if len(fields) != 3 or fields[0] != 'zfft' \
+               or fields[2] not in _ALGORITHMS:
+            continue
+        ns.append(int(fields[1]))
+        algos.append(_ALGORITHMS.index(fields[2]))
+    if ns:
+        _fftpack.zfft_wisdom_put(ns, algos)
+    return len(ns)
+
+
+def forget_wisdom():
+    """Drop all recorded algorithm choices."""
+    _fftpack.zfft_wisdom_forget()
@@ -16,6 +16,7 @@ from netcdf import netcdf_file, netcdf_variable
 from matlab import byteordercodes
 from data_store import save_as_module
 from mmio import mminfo, mmread, mmwrite
+from spbin import spbin_info, spbin_read, spbin_write
 from idl import readsav
 
 __all__ = filter(lambda s:not s.startswith('_'),dir())
@@ -18,6 +18,7 @@ Modules
    matlab - Utilities for dealing with MATLAB(R) files
    mmio - Matrix Market I/O in Python
    netcdf - NetCDF reader/writer module
+   spbin - Binary sparse matrix I/O with memory-mapped loading
    wavfile - module to read / write wav files using numpy arrays
 
 Classes
@@ -40,6 +41,9 @@ Functions
    mminfo - Query matrix info from Matrix Market formatted file
    mmread - Read matrix from Matrix Market formatted file
    mmwrite - Write matrix to Matrix Market formatted file
+   spbin_info - Query matrix info from binary sparse matrix file
+   spbin_read - Read sparse matrix from binary file, memory-mapped
+   spbin_write - Write sparse matrix to binary file
    save_as_module - Data saved as module, accessed on load as attirbutes
 
 """
@@ -10,12 +10,18 @@
 #
 
 import os
-from numpy import asarray, real, imag, conj, zeros, ndarray, concatenate, \
-                  ones, ascontiguousarray, vstack, savetxt, fromfile, fromstring
+from numpy import asarray, conj, zeros, ndarray, concatenate, ones, tril, \
+                  ascontiguousarray, frombuffer, uint8
 from numpy.compat import asbytes, asstr
 
 __all__ = ['mminfo','mmread','mmwrite', 'MMFile']
 
+# bytes of text parsed at a time when reading
+_BLOCK = 1 << 26
+
+# entries formatted at a time when writing
+_CHUNK = 1 << 20
+
 
 #-------------------------------------------------------------------------------
 def mminfo(source):
@@ -64,6 +70,11 @@ def mmread(source):
     a:
         Sparse or full matrix
 
+    Notes
+    -----
+    The entries are parsed by sparsetools, using the number of threads
+    set by scipy.sparse.sparsetools.set_num_threads.
+
     """
     return MMFile().read(source)
 
@@ -277,15 +288,6 @@ class MMFile (object):
         if isherm: return MMFile.SYMMETRY_HERMITIAN
         return MMFile.SYMMETRY_GENERAL
 
-    #---------------------------------------------------------------------------
-    @staticmethod
-    def _field_template(field, precision):
-        return {
-          MMFile.FIELD_REAL: '%%.%ie\n' % precision,
-          MMFile.FIELD_INTEGER: '%i\n',
-          MMFile.FIELD_COMPLEX: '%%.%ie %%.%ie\n' % (precision,precision)
-        }.get(field, None)
-
     #---------------------------------------------------------------------------
     def __init__(self, **kwargs): self._init_attrs(**kwargs)
 
@@ -338,11 +340,10 @@ class MMFile (object):
     def _parse_body(self, stream):
         rows, cols, entries, format, field, symm = \
           (self.rows, self.cols, self.entries, self.format, self.field, self.symmetry)
+        rows, cols, entries = int(rows), int(cols), int(entries)
 
-        try:
-            from scipy.sparse import coo_matrix
-        except ImportError:
-            coo_matrix = None
+        from scipy.sparse import coo_matrix
+        from scipy.sparse.sputils import get_index_dtype
 
         dtype = self.DTYPES_BY_FIELD.get(field, None)
 
@@ -352,99 +353,59 @@ class MMFile (object):
         is_herm = symm == self.SYMMETRY_HERMITIAN
         is_pattern = field == self.FIELD_PATTERN
 
+        # values are parsed as int or double, complex values as pairs
+        if is_pattern:
+            n_values = 0
+        elif is_complex:
+            n_values = 2
+        else:
+            n_values = 1
+        value_dtype = 'i' if field == self.FIELD_INTEGER else 'd'
+
         if format == self.FORMAT_ARRAY:
-            a = zeros((rows,cols),dtype=dtype)
-            line = 1
-            i,j = 0,0
-            while line:
-                line = stream.readline()
-                if not line or line.startswith(asbytes('%')):
-                    continue
-                if is_complex:
-                    aij = complex(*map(float,line.split()))
-                else:
-                    aij = float(line)
-                a[i,j] = aij
-                if has_symmetry and i!=j:
-                    if is_skew:
-                        a[j,i] = -aij
-                    elif is_herm:
-                        a[j,i] = conj(aij)
-                    else:
-                        a[j,i] = aij
-                if i<rows-1:
-                    i = i + 1
-                else:
-                    j = j + 1
-                    if not has_symmetry:
-                        i = 0
-                    else:
-                        i = j
-            assert i in [0,j] and j==cols,`i,j,rows,cols`
-
-        elif format == self.FORMAT_COORDINATE and coo_matrix is None:
-            # Read sparse matrix to dense when coo_matrix is not available.
+            # the lower triangle is stored for matrices with symmetry
+            stored = ones((rows,cols), dtype=bool)
+            if has_symmetry:
+                stored = tril(stored)
+            count = int(stored.sum())
+
+            idx = get_index_dtype(count)
+            I = J = zeros(0, dtype=idx)
+            V = zeros(count*n_values, dtype=value_dtype)
+            _parse_entries(stream, rows, cols, 0, n_values, count, I, J, V)
+            if is_complex:
+                V = V.view('D')
+
+            # entries are stored column by column
             a = zeros((rows,cols), dtype=dtype)
-            line = 1
-            k = 0
-            while line:
-                line = stream.readline()
-                if not line or line.startswith(asbytes('%')):
-                    continue
-                l = line.split()
-                i,j = map(int,l[:2])
-                i,j = i-1,j-1
-                if is_complex:
-                    aij = complex(*map(float,l[2:]))
+            a.T[stored.T] = V
+
+            if has_symmetry:
+                lower = tril(a, -1).T
+                if is_skew:
+                    a -= lower
+                elif is_herm:
+                    a += conj(lower)
                 else:
-                    aij = float(l[2])
-                a[i,j] = aij
-                if has_symmetry and i!=j:
-                    if is_skew:
-                        a[j,i] = -aij
-                    elif is_herm:
-                        a[j,i] = conj(aij)
-                    else:
-                        a[j,i] = aij
-                k = k + 1
-            assert k==entries,`k,entries`
+                    a += lower
 
         elif format == self.FORMAT_COORDINATE:
             # Read sparse COOrdinate format
-            
+
             if entries == 0:
                 # empty matrix
                 return coo_matrix((rows, cols), dtype=dtype)
 
-            try:
-                # fromfile works for normal files
-                flat_data = fromfile(stream, sep=' ')
-            except:
-                # fallback - fromfile fails for some file-like objects
-                flat_data = fromstring(stream.read(), sep=' ')
-
-                # TODO use iterator (e.g. xreadlines) to avoid reading
-                # the whole file into memory
+            idx = get_index_dtype(max(rows, cols, entries))
+            I = zeros(entries, dtype=idx)
+            J = zeros(entries, dtype=idx)
+            V = zeros(entries*n_values, dtype=value_dtype)
+            _parse_entries(stream, rows, cols, 2, n_values, entries, I, J, V)
 
             if is_pattern:
-                flat_data = flat_data.reshape(-1,2)
-                I = ascontiguousarray(flat_data[:,0], dtype='intc')
-                J = ascontiguousarray(flat_data[:,1], dtype='intc')
-                V = ones(len(I), dtype='int8')  # filler
+                V = ones(entries, dtype='int8')  # filler
             elif is_complex:
-                flat_data = flat_data.reshape(-1,4)
-                I = ascontiguousarray(flat_data[:,0], dtype='intc')
-                J = ascontiguousarray(flat_data[:,1], dtype='intc')
-                V = ascontiguousarray(flat_data[:,2], dtype='complex')
-                V.imag = flat_data[:,3]
-            else:
-                flat_data = flat_data.reshape(-1,3)
-                I = ascontiguousarray(flat_data[:,0], dtype='intc')
-                J = ascontiguousarray(flat_data[:,1], dtype='intc')
-                V = ascontiguousarray(flat_data[:,2], dtype='float')
-
-            I -= 1 #adjust indices (base 1 -> base 0)
-            J -= 1
+                V = V.view('D')
 
             if has_symmetry:
                 mask = (I != J)       #off diagonal mask
@@ -535,7 +496,12 @@ class MMFile (object):
             stream.write(asbytes('%%%s\n' % (line)))
 
 
-        template = self._field_template(field, precision)
+        if field == self.FIELD_PATTERN:
+            n_values = 0
+        elif field == self.FIELD_COMPLEX:
+            n_values = 2
+        else:
+            n_values = 1
 
         # write dense format
         if rep == self.FORMAT_ARRAY:
@@ -543,35 +509,22 @@ class MMFile (object):
             # write shape spec
             stream.write(asbytes('%i %i\n' % (rows,cols)))
 
-            if field in (self.FIELD_INTEGER, self.FIELD_REAL):
-
-                if symm == self.SYMMETRY_GENERAL:
-                    for j in range(cols):
-                        for i in range(rows):
-                            stream.write(asbytes(template % a[i,j]))
-                else:
-                    for j in range(cols):
-                        for i in range(j,rows):
-                            stream.write(asbytes(template % a[i,j]))
-
-            elif field == self.FIELD_COMPLEX:
-
-                if symm == self.SYMMETRY_GENERAL:
-                    for j in range(cols):
-                        for i in range(rows):
-                            aij = a[i,j]
-                            stream.write(asbytes(template % (real(aij),imag(aij))))
-                else:
-                    for j in range(cols):
-                        for i in range(j,rows):
-                            aij = a[i,j]
-                            stream.write(asbytes(template % (real(aij),imag(aij))))
-
-            elif field == self.FIELD_PATTERN:
+            if field == self.FIELD_PATTERN:
                 raise ValueError('pattern type inconsisted with dense format')
+            elif field not in (self.FIELD_INTEGER, self.FIELD_REAL,
+                               self.FIELD_COMPLEX):
+                raise TypeError('Unknown field type %s' % field)
 
+            # entries are written column by column, only the lower
+            # triangle for matrices with symmetry
+            if symm == self.SYMMETRY_GENERAL:
+                V = a.T.ravel()
             else:
-                raise TypeError('Unknown field type %s' % field)
+                V = a.T[tril(ones((rows,cols), dtype=bool)).T]
+
+            I = J = zeros(0, dtype='intc')
+            _write_entries(stream, 0, I, J, V, n_values, field, precision,
+                           True)
 
         # write sparse format
         else:
@@ -579,25 +532,90 @@ class MMFile (object):
             if symm != self.SYMMETRY_GENERAL:
                 raise NotImplementedError('symmetric matrices not yet supported')
 
+            from scipy.sparse.sputils import get_index_dtype
+
             coo = a.tocoo() # convert to COOrdinate format
 
             # write shape spec
             stream.write(asbytes('%i %i %i\n' % (rows, cols, coo.nnz)))
 
-            fmt = '%%.%dg' % precision
-
-            if field == self.FIELD_PATTERN:
-                IJV = vstack((coo.row, coo.col)).T
-            elif field in [ self.FIELD_INTEGER, self.FIELD_REAL ]:
-                IJV = vstack((coo.row, coo.col, coo.data)).T
-            elif field == self.FIELD_COMPLEX:
-                IJV = vstack((coo.row, coo.col, coo.data.real, coo.data.imag)).T
-            else:
+            if field not in self.FIELD_VALUES:
                 raise TypeError('Unknown field type %s' % field)
 
-            IJV[:,:2] += 1 # change base 0 -> base 1
+            idx = get_index_dtype(max(rows, cols))
+            I = asarray(coo.row, dtype=idx)
+            J = asarray(coo.col, dtype=idx)
+            _write_entries(stream, 2, I, J, coo.data, n_values, field,
+                           precision, False)
+
+
+#-------------------------------------------------------------------------------
+def _parse_entries(stream, rows, cols, n_indices, n_values, count, I, J, V):
+    """
+    Parse the remaining lines of stream into `count` entries, with
+    indices I and J (when n_indices is 2) and n_values values V each.
+    The text is handed to sparsetools in blocks ending at a line break.
+    """
+    from scipy.sparse import sparsetools
+
+    n_threads = sparsetools.get_num_threads()
+    newline = asbytes('\n')
+
+    k = 0
+    rest = asbytes('')
+    while True:
+        block = stream.read(_BLOCK)
+        text = rest + block
+        if block:
+            end = text.rfind(newline) + 1
+            text, rest = text[:end], text[end:]
+        if text:
+            n = sparsetools.mm_parse_entries(rows, cols, n_indices, n_values,
+                    count - k, len(text), frombuffer(text, dtype=uint8),
+                    I[k:], J[k:], V[k*n_values:], n_threads)
+            if n < 0:
+                raise ValueError('invalid or unexpected Matrix Market entry '
+                                 '%d' % (k - n))
+            k += n
+        if not block:
+            break
+
+    if k != count:
+        raise ValueError('expected %d Matrix Market entries, found %d'
+                         % (count, k))
+
+
+def _write_entries(stream, n_indices, I, J, V, n_values, field, precision,
+                   scientific):
+    """
+    Write the entries with indices I and J (when n_indices is 2) and
+    n_values values V each to stream, formatted by sparsetools in chunks.
+    """
+    from scipy.sparse import sparsetools
+
+    n_threads = sparsetools.get_num_threads()
+
+    if field == MMFile.FIELD_INTEGER:
+        V = ascontiguousarray(V, dtype='q')
+    elif field == MMFile.FIELD_COMPLEX:
+        V = ascontiguousarray(V, dtype='D').view('d')
+    elif field == MMFile.FIELD_REAL:
+        V = ascontiguousarray(V, dtype='d')
+    else:
+        V = zeros(0, dtype='d')
+
+    if n_indices:
+        count = len(I)
+    else:
+        count = len(V) // n_values
+
+    for k in range(0, count, _CHUNK):
+        n = min(_CHUNK, count - k)
+        text = sparsetools.mm_format_entries(n, n_indices, n_values,
+                I[k:k+n], J[k:k+n], V[k*n_values:(k+n)*n_values], precision, scientific,
+                n_threads)
+        stream.write(text.tostring())
 
-            savetxt(stream, IJV, fmt=fmt)
 
 #-------------------------------------------------------------------------------
 if __name__ == '__main__':
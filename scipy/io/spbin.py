@@ -0,0 +1,322 @@
+"""
+Binary sparse matrix I/O
+
+A simple file format holding the index and data arrays of a CSR, CSC or
+BSR matrix, so that loading a matrix takes no parsing.  Uncompressed
+files are memory-mapped: spbin_read returns a matrix whose arrays are
+views of the file, and the pages are read by the operating system as
+they are used.
+
+File layout (all numbers little-endian)::
+
+    magic            8 bytes   '\\x93SCIPYSP'
+    version          2 bytes   major, minor
+    (padding)        2 bytes
+    format           4 bytes   'csr', 'csc' or 'bsr', zero padded
+    flags            uint32    1: sorted indices, 2: compressed
+    index dtype      8 bytes   e.g. '<i4', zero padded
+    data dtype       8 bytes   e.g. '<f8', zero padded
+    shape            2 x uint64
+    blocksize        2 x uint64 (1, 1 for CSR and CSC)
+    sections         3 x (offset, stored size, size) as uint64,
+                     for indptr, indices and data, with offsets
+                     counted from the magic
+
+Each section starts at a file offset that is a multiple of 64 bytes.
+Compressed sections are zlib streams.
+
+"""
+
+__all__ = ['spbin_info', 'spbin_read', 'spbin_write']
+
+import struct
+import zlib
+
+import numpy as np
+from numpy.compat import asbytes, asstr
+
+_MAGIC     = asbytes('\x93SCIPYSP')
+_VERSION   = (1, 0)
+_HEADER    = struct.Struct('<8sBB2x4sI8s8s4Q9Q')
+_ALIGNMENT = 64
+
+_SORTED     = 1
+_COMPRESSED = 2
+
+# bytes per chunk when writing, to bound the memory used for copies
+_CHUNK = 1 << 24
+
+
+#-------------------------------------------------------------------------------
+def spbin_info(source):
+    """
+    Queries the header of a binary sparse matrix file.
+
+    Parameters
+    ----------
+    source : file
+        Filename or open file object.
+
+    Returns
+    -------
+    format : {'csr', 'csc', 'bsr'}
+    shape : tuple
+        Number of matrix rows and columns
+    nnz : int
+        Number of stored entries
+    dtype : dtype
+        Data type of the matrix
+    compressed : bool
+        Whether the sections are compressed (and can not be memory-mapped)
+
+    """
+    stream, close_it = _open(source, 'rb')
+    try:
+        h = _read_header(stream)
+    finally:
+        if close_it:
+            stream.close()
+
+    nnz = h['sections'][2][2] // h['data_dtype'].itemsize
+    return h['format'], h['shape'], nnz, h['data_dtype'], h['compressed']
+
+
+#-------------------------------------------------------------------------------
+def spbin_read(source, mmap_mode='r'):
+    """
+    Reads a sparse matrix from a binary sparse matrix file.
+
+    Parameters
+    ----------
+    source : file
+        Filename or open file object.
+    mmap_mode : {'r', 'c', None}
+        Memory-map the file read-only ('r', default) or copy-on-write
+        ('c'), or read it into memory (None).  Compressed files are
+        always read into memory.
+
+    Returns
+    -------
+    a : {csr_matrix, csc_matrix, bsr_matrix}
+        The matrix, with the format it was written in.
+
+    Notes
+    -----
+    A memory-mapped matrix is not copied on load, provided its index
+    dtype is the one scipy.sparse would choose for it (as for any file
+    written by spbin_write) and the machine is little-endian.  With
+    mmap_mode='r' operations that modify the matrix in place, such as
+    sort_indices, raise an error.
+
+    """
+    if mmap_mode not in ('r', 'c', None):
+        raise ValueError("mmap_mode must be 'r', 'c' or None")
+
+    stream, close_it = _open(source, 'rb')
+    try:
+        h = _read_header(stream)
+        if h['compressed']:
+            mmap_mode = None
+
+        arrays = []
+        for (offset, stored, size), dtype in zip(h['sections'],
+                [h['index_dtype'], h['index_dtype'], h['data_dtype']]):
+            count = size // dtype.itemsize
+            if count == 0:
+                arrays.append(np.zeros(0, dtype=dtype))
+            elif mmap_mode is not None:
+                arrays.append(np.memmap(stream, dtype=dtype, mode=mmap_mode,
+                                        offset=offset, shape=(count,)))
+            else:
+                stream.seek(offset)
+                buf = stream.read(stored)
+                if h['compressed']:
+                    buf = zlib.decompress(buf)
+                if len(buf) != size:
+                    raise ValueError('truncated binary sparse matrix file')
+                arrays.append(np.fromstring(buf, dtype=dtype))
+
+        # leave the stream after the matrix
+        stream.seek(max([offset + stored for offset, stored, size
+                         in h['sections']]))
+    finally:
+        if close_it:
+            stream.close()
+
+    from scipy.sparse import csr_matrix, csc_matrix, bsr_matrix
+
+    indptr, indices, data = arrays
+    R, C = h['blocksize']
+    if h['format'] == 'bsr':
+        a = bsr_matrix((data.reshape(-1, R, C), indices, indptr),
+                       shape=h['shape'])
+    elif h['format'] == 'csc':
+        a = csc_matrix((data, indices, indptr), shape=h['shape'])
+    else:
+        a = csr_matrix((data, indices, indptr), shape=h['shape'])
+
+    if h['sorted']:
+        a.has_sorted_indices = True
+    return a
+
+
+#-------------------------------------------------------------------------------
+def spbin_write(target, a, compress=False):
+    """
+    Writes a sparse matrix to a binary sparse matrix file.
+
+    Parameters
+    ----------
+    target : file
+        Filename or open file object, which must be seekable.
+    a : sparse matrix
+        CSR, CSC and BSR matrices are written as they are, other
+        formats are converted to CSR.
+    compress : {bool, int}
+        Compress the sections with zlib, at the given level (1-9) or
+        the default level if True.  Compressed files take less space but
+        can not be memory-mapped.
+
+    """
+    from scipy.sparse import isspmatrix, csr_matrix
+    from scipy.sparse.sputils import get_index_dtype
+
+    if not isspmatrix(a):
+        a = csr_matrix(a)
+    if a.format not in ('csr', 'csc', 'bsr'):
+        a = a.tocsr()
+    if a.dtype.hasobject:
+        raise ValueError('can not write matrices of dtype object')
+
+    if a.format == 'bsr':
+        blocksize = a.blocksize
+        nnz = a.indptr[-1]
+        data = a.data[:nnz].reshape(-1)
+    else:
+        blocksize = (1, 1)
+        nnz = a.nnz
+        data = a.data[:nnz]
+
+    # the index dtype check_format would choose, so that loading does
+    # not have to convert the memory-mapped arrays
+    M, N = a.shape
+    R, C = blocksize
+    idx_dtype = np.dtype(get_index_dtype(maxval=max(M//R, N//C, R*C*nnz)))
+    idx_dtype = idx_dtype.newbyteorder('<')
+
+    arrays = [np.ascontiguousarray(a.indptr, dtype=idx_dtype),
+              np.ascontiguousarray(a.indices[:nnz], dtype=idx_dtype),
+              np.ascontiguousarray(data, dtype=data.dtype.newbyteorder('<'))]
+
+    if compress is True:
+        level = 6
+    else:
+        level = int(compress)
+
+    h = dict(format=a.format, shape=a.shape, blocksize=blocksize,
+             index_dtype=arrays[0].dtype, data_dtype=arrays[2].dtype,
+             sorted=bool(a.has_sorted_indices), compressed=level > 0,
+             sections=[(0, 0, 0)] * 3)
+
+    stream, close_it = _open(target, 'wb')
+    try:
+        start = stream.tell()
+        stream.write(_pack_header(h))
+
+        sections = []
+        for x in arrays:
+            # align within the file, not within the matrix
+            padding = -stream.tell() % _ALIGNMENT
+            stream.write(asbytes('\x00') * padding)
+            offset = stream.tell() - start
+            stored = _write_array(stream, x, level)
+            sections.append((offset, stored, x.nbytes))
+
+        end = stream.tell()
+        h['sections'] = sections
+        stream.seek(start)
+        stream.write(_pack_header(h))
+        stream.seek(end)
+    finally:
+        if close_it:
+            stream.close()
+        else:
+            stream.flush()
+
+
+#-------------------------------------------------------------------------------
+def _open(filespec, mode):
+    """Return an open file and whether it should be closed after use"""
+    if isinstance(filespec, str):
+        return open(filespec, mode), True
+    else:
+        return filespec, False
+
+
+def _write_array(stream, x, level):
+    """Write the bytes of x in chunks, returning the number written"""
+    x = x.view(np.uint8)
+    if level > 0:
+        compressor = zlib.compressobj(level)
+    written = 0
+    for start in range(0, len(x), _CHUNK):
+        buf = x[start:start + _CHUNK].tostring()
+        if level > 0:
+            buf = compressor.compress(buf)
+        stream.write(buf)
+        written += len(buf)
+    if level > 0:
+        buf = compressor.flush()
+        stream.write(buf)
+        written += len(buf)
+    return written
+
+
+def _pack_header(h):
+    flags = 0
+    if h['sorted']:
+        flags |= _SORTED
+    if h['compressed']:
+        flags |= _COMPRESSED
+
+    sections = []
+    for s in h['sections']:
+        sections.extend(s)
+
+    return _HEADER.pack(_MAGIC, _VERSION[0], _VERSION[1],
+                        asbytes(h['format']), flags,
+                        asbytes(h['index_dtype'].str),
+                        asbytes(h['data_dtype'].str),
+                        h['shape'][0], h['shape'][1],
+                        h['blocksize'][0], h['blocksize'][1],
+                        *sections)
+
+
+def _read_header(stream):
+    start = stream.tell()
+    buf = stream.read(_HEADER.size)
+    if len(buf) != _HEADER.size or buf[:len(_MAGIC)] != _MAGIC:
+        raise ValueError('not a binary sparse matrix file')
+
+    fields = _HEADER.unpack(buf)
+    major, minor = fields[1:3]
+    if major != _VERSION[0]:
+        raise ValueError('unsupported binary sparse matrix file version '
+                         '%d.%d' % (major, minor))
+
+    format = asstr(fields[3].rstrip(asbytes('\x00')))
+    if format not in ('csr', 'csc', 'bsr'):
+        raise ValueError('unknown sparse matrix format %r' % format)
+    flags = fields[4]
+
+    s = fields[11:]
+    sections = [(start + s[3*k], s[3*k+1], s[3*k+2]) for k in range(3)]
+
+    return dict(format=format,
+                sorted=bool(flags & _SORTED),
+                compressed=bool(flags & _COMPRESSED),
+                index_dtype=np.dtype(asstr(fields[5].rstrip(asbytes('\x00')))),
+                data_dtype=np.dtype(asstr(fields[6].rstrip(asbytes('\x00')))),
+                shape=(int(fields[7]), int(fields[8])),
+                blocksize=(int(fields[9]), int(fields[10])),
+                sections=sections)
@@ -1,9 +1,11 @@
 #!/usr/bin/env python
 
 from tempfile import mktemp
+import numpy as np
 from numpy import array,transpose
+from numpy.compat import asbytes
 from numpy.testing import TestCase, run_module_suite, assert_array_almost_equal, \
-            assert_equal, rand
+            assert_equal, assert_raises, rand
 
 import scipy.sparse
 from scipy.io.mmio import mminfo,mmread,mmwrite
@@ -184,6 +186,17 @@ _symmetric_pattern_example = '''\
     5     4
 '''
 
+_comments_example = '''\
+%%MatrixMarket matrix coordinate integer general
+% comment
+  3  4  3
+    1     1     7
+% comment between entries
+
+    3     4    -2\r
+    2     2     5
+'''
+
 class TestMMIOCoordinate(TestCase):
     def test_read_general(self):
         """read a general matrix"""
@@ -260,6 +273,32 @@ class TestMMIOCoordinate(TestCase):
         b = mmread(fn).todense()
         assert_array_almost_equal(a,b)
 
+    def test_read_comments(self):
+        """read entries separated by comments and blank lines"""
+        fn = mktemp()
+        f = open(fn,'w')
+        f.write(_comments_example)
+        f.close()
+        a = [[7, 0, 0,  0],
+             [0, 5, 0,  0],
+             [0, 0, 0, -2]]
+        b = mmread(fn)
+        assert_equal(b.dtype.char, 'i')
+        assert_equal(b.todense(), a)
+
+    def test_read_invalid(self):
+        header = '%%MatrixMarket matrix coordinate real general\n3 3 2\n'
+        for body in ['1 1 1.0\n4 1 2.0\n',     # index out of bounds
+                     '1 1 1.0\n2 2 x\n',       # invalid value
+                     '1 1 1.0\n2 2\n',         # missing value
+                     '1 1 1.0\n',              # too few entries
+                     '1 1 1.0\n2 2 2.0\n3 3 3.0\n']: # too many entries
+            fn = mktemp()
+            f = open(fn,'w')
+            f.write(header + body)
+            f.close()
+            assert_raises(ValueError, mmread, fn)
+
     def test_empty_write_read(self):
         #http://projects.scipy.org/scipy/ticket/883
 
@@ -272,6 +311,14 @@ class TestMMIOCoordinate(TestCase):
         b = mmread(fn).todense()
         assert_array_almost_equal(a,b)
 
+    def test_empty_pattern_write_read(self):
+        b = scipy.sparse.coo_matrix((10,10))
+        fn = mktemp()
+        mmwrite(fn, b, field='pattern')
+
+        assert_equal(mminfo(fn),(10,10,0,'coordinate','pattern','general'))
+        assert_equal(mmread(fn).todense(), b.todense())
+
 
     def test_real_write_read(self):
         I = array([0, 0, 1, 2, 3, 3, 3, 4])
@@ -304,6 +351,84 @@ class TestMMIOCoordinate(TestCase):
         b = mmread(fn).todense()
         assert_array_almost_equal(a,b)
 
+    def test_integer_write_read(self):
+        I = array([0, 0, 1, 2, 3, 3, 3, 4])
+        J = array([0, 3, 1, 2, 1, 3, 4, 4])
+        V = array([1, 6, 10, -2**31, 250, -280, 2**31 - 1, 12], dtype='i')
+
+        b = scipy.sparse.coo_matrix((V,(I,J)),shape=(5,5))
+
+        fn = mktemp()
+        mmwrite(fn,b)
+
+        assert_equal(mminfo(fn),(5,5,8,'coordinate','integer','general'))
+        assert_equal(mmread(fn).todense(), b.todense())
+
+    def test_threads_write_read(self):
+        b = scipy.sparse.rand(300, 200, density=0.05, format='coo')
+        b.data = b.data - 0.5
+
+        fn = mktemp()
+        old = scipy.sparse.sparsetools.set_num_threads(4)
+        try:
+            mmwrite(fn, b, precision=17)
+            c = mmread(fn)
+        finally:
+            scipy.sparse.sparsetools.set_num_threads(old)
+
+        # entries keep their order and values are exact
+        assert_equal(c.row, b.row)
+        assert_equal(c.col, b.col)
+        assert_equal(c.data, b.data)
+
+    def test_chunked_entries(self):
+        # enough entries for mm_format_entries to use four chunks of 4096
+        # and enough text for mm_parse_entries to use four chunks of 64KB
+        from scipy.sparse import sparsetools
+
+        np.random.seed(0)
+        n = 40000
+        I = np.random.randint(0, 1000, n).astype('intc')
+        J = np.random.randint(0, 500, n).astype('intc')
+        V = np.random.rand(n) - 0.5
+
+        text = sparsetools.mm_format_entries(n, 2, 1, I, J, V, 17, 0, 4)
+        serial = sparsetools.mm_format_entries(n, 2, 1, I, J, V, 17, 0, 1)
+        assert_equal(text.tostring(), serial.tostring())
+
+        # comment lines shift the entry numbers of every later chunk
+        lines = text.tostring().split(asbytes('\n'))[:-1]
+        assert_equal(len(lines), n)
+        for k in range(n - 1000, 0, -1000):
+            lines.insert(k, asbytes('% comment'))
+
+        def parse(lines):
+            text = asbytes('\n').join(lines) + asbytes('\n')
+            assert len(text) > 4 * 65536
+            I2 = np.zeros(n, dtype='intc')
+            J2 = np.zeros(n, dtype='intc')
+            V2 = np.zeros(n, dtype='d')
+            k = sparsetools.mm_parse_entries(1000, 500, 2, 1, n, len(text),
+                    np.frombuffer(text, dtype=np.uint8), I2, J2, V2, 4)
+            return k, I2, J2, V2
+
+        k, I2, J2, V2 = parse(lines)
+        assert_equal(k, n)
+        assert_equal(I2, I)
+        assert_equal(J2, J)
+        assert_equal(V2, V)
+
+        # the first invalid entry is reported, whichever chunk holds it
+        def line_of(entry):
+            return entry + entry // 1000
+
+        bad = list(lines)
+        bad[line_of(35000)] = asbytes('1 x 1.0')
+        bad[line_of(25000)] = asbytes('1001 1 1.0')
+        assert_equal(parse(bad)[0], -1 - 25000)
+        bad[line_of(1234)] = asbytes('1 1 1.0 2.0')
+        assert_equal(parse(bad)[0], -1 - 1234)
+
     def test_sparse_formats(self):
         mats = []
 
@@ -0,0 +1,137 @@
+#!/usr/bin/env python
+
+import os
+from tempfile import mktemp
+
+import numpy as np
+from numpy.testing import TestCase, run_module_suite, assert_equal, \
+        assert_array_equal, assert_raises, assert_
+
+import scipy.sparse
+from scipy.io.spbin import spbin_info, spbin_read, spbin_write, \
+        _read_header
+
+
+class TestSpbin(TestCase):
+    def setUp(self):
+        np.random.seed(1234)
+        self.A = scipy.sparse.rand(20, 30, density=0.2, format='csr')
+        self.fn = mktemp()
+
+    def tearDown(self):
+        if os.path.exists(self.fn):
+            os.remove(self.fn)
+
+    def check(self, A, **kw):
+        spbin_write(self.fn, A, **kw)
+        for mmap_mode in ['r', 'c', None]:
+            B = spbin_read(self.fn, mmap_mode=mmap_mode)
+            assert_equal(B.format, A.format)
+            assert_equal(B.shape, A.shape)
+            assert_equal(B.dtype, A.dtype)
+            assert_array_equal(B.todense(), A.todense())
+        return B
+
+    def test_formats(self):
+        A = self.A
+        for fmt in ['csr', 'csc', 'bsr']:
+            self.check(A.asformat(fmt))
+        B = self.check(A.tobsr(blocksize=(2,3)))
+        assert_equal(B.blocksize, (2,3))
+
+        spbin_write(self.fn, A.tocoo())
+        assert_equal(spbin_read(self.fn).format, 'csr')
+
+    def test_dtypes(self):
+        for dtype in [np.int8, np.int32, np.float32, np.float64,
+                      np.complex64, np.complex128, np.longdouble]:
+            self.check(self.A.astype(dtype))
+
+    def test_empty(self):
+        self.check(scipy.sparse.csr_matrix((5,7)))
+        self.check(scipy.sparse.csc_matrix((4,3)))
+
+    def test_memmap(self):
+        A = self.A
+        A.sort_indices()
+        spbin_write(self.fn, A)
+        B = spbin_read(self.fn)
+        for x in [B.data, B.indices, B.indptr]:
+            # views of the file, not copies
+            assert_(not x.flags.owndata)
+            assert_(not x.flags.writeable)
+        assert_(B.has_sorted_indices)
+        assert_array_equal((B * B.T).todense(), (A * A.T).todense())
+
+        C = spbin_read(self.fn, mmap_mode='c')
+        C.data *= 2
+        assert_array_equal(spbin_read(self.fn).data, A.data)
+
+    def test_compressed(self):
+        A = self.A
+        for compress in [True, 1, 9]:
+            self.check(A, compress=compress)
+            assert_equal(spbin_info(self.fn),
+                         ('csr', A.shape, A.nnz, A.dtype, True))
+        A = scipy.sparse.identity(1000, format='csr')
+        spbin_write(self.fn, A)
+        size = os.path.getsize(self.fn)
+        spbin_write(self.fn, A, compress=True)
+        assert_(os.path.getsize(self.fn) < size)
+        assert_array_equal(spbin_read(self.fn).indices, A.indices)
+
+    def test_info(self):
+        spbin_write(self.fn, self.A)
+        assert_equal(spbin_info(self.fn),
+                     ('csr', (20, 30), self.A.nnz, self.A.dtype, False))
+
+    def test_file_objects(self):
+        A = self.A
+        f = open(self.fn, 'wb')
+        f.write(np.compat.asbytes('header'))
+        spbin_write(f, A)
+        spbin_write(f, A.tocsc())
+        f.close()
+
+        f = open(self.fn, 'rb')
+        f.read(6)
+        B = spbin_read(f)
+        C = spbin_read(f, mmap_mode=None)
+        f.close()
+        assert_array_equal(B.todense(), A.todense())
+        assert_equal(C.format, 'csc')
+        assert_array_equal(C.todense(), A.todense())
+
+        # sections are aligned in the file, not only within the matrix
+        f = open(self.fn, 'rb')
+        f.read(6)
+        for k in range(2):
+            start = f.tell()
+            h = _read_header(f)
+            assert_equal([s[0] % 64 for s in h['sections']], [0, 0, 0])
+            f.seek(start)
+            spbin_read(f, mmap_mode=None)
+        f.close()
+
+    def test_index_dtype(self):
+        A = self.A.copy()
+        A.indptr = A.indptr.astype(np.int64)
+        A.indices = A.indices.astype(np.int64)
+        spbin_write(self.fn, A)
+        B = spbin_read(self.fn)
+        assert_equal(B.indices.dtype, np.intc)
+        assert_(not B.indptr.flags.owndata)
+        assert_(not B.indices.flags.owndata)
+        assert_array_equal(B.todense(), A.todense())
+
+    def test_errors(self):
+        f = open(self.fn, 'wb')
+        f.write(np.compat.asbytes('not a matrix' * 20))
+        f.close()
+        assert_raises(ValueError, spbin_read, self.fn)
+        spbin_write(self.fn, self.A)
+        assert_raises(ValueError, spbin_read, self.fn, mmap_mode='w+')
+
+
+if __name__ == "__main__":
+    run_module_suite()
@@ -6,7 +6,7 @@ import warnings
 import sigtools
 from scipy import linalg
 from scipy.fftpack import fft, ifft, ifftshift, fft2, ifft2, fftn, \
-        ifftn, fftfreq
+        ifftn, fftfreq, rfftn, irfftn
 from numpy import polyadd, polymul, polydiv, polysub, roots, \
         poly, polyval, polyder, cast, asarray, isscalar, atleast_1d, \
         ones, real, real_if_close, zeros, array, arange, where, rank, \
@@ -119,9 +119,98 @@ def _centered(arr, newsize):
     myslice = [slice(startind[k], endind[k]) for k in range(len(endind))]
     return arr[tuple(myslice)]
 
+def _oa_fft_size(m):
+    """FFT length minimising the overlap-add cost per output sample for a
+    filter of length m."""
+    n = max(64, int(2**np.ceil(np.log2(2*m))))
+    best, best_cost = n, None
+    for i in range(10):
+        cost = n * np.log2(n) / float(n - m + 1)
+        if best_cost is None or cost < best_cost:
+            best, best_cost = n, cost
+        n *= 2
+    return best
+
+def _oa_axis(s1, s2):
+    """Return the axis to block along if overlap-add pays off, else None."""
+    if len(s1) != len(s2) or len(s1) == 0:
+        return None
+    if (s1 >= s2).all():
+        big, small = s1, s2
+    elif (s2 >= s1).all():
+        big, small = s2, s1
+    else:
+        return None
+    axis = np.argmax(big / small.astype(float))
+    # Only worth it with a handful of blocks
+    if big[axis] < 4 * _oa_fft_size(small[axis]):
+        return None
+    return axis
+
+def _fftconvolve_oa(big, small, axis, complex_result):
+    """Full convolution of big with small by overlap-add along axis.
+
+    big is cut into blocks of length L along axis, and all the blocks of a
+    chunk are transformed by a single batched FFT call against the one
+    filter spectrum.
+    """
+    big = np.swapaxes(big, axis, -1)
+    small = np.swapaxes(small, axis, -1)
+    nd = big.ndim
+    Nb, M = big.shape[-1], small.shape[-1]
+    N = _oa_fft_size(M)
+    L = N - M + 1
+    nblocks = -(-Nb // L)
+    size = [i + j - 1 for i, j in zip(big.shape, small.shape)]
+    fshape = [int(2**np.ceil(np.log2(sz))) for sz in size[:-1]] + [N]
+    # a batch axis for the blocks is inserted just before the last axis
+    axes = range(nd - 1) + [nd]
+    oslice = tuple([slice(0, sz) for sz in size[:-1]])
+
+    if complex_result:
+        H = fftn(small[..., newaxis, :], fshape, axes)
+    else:
+        H = rfftn(small[..., newaxis, :], fshape, axes)
+
+    bigp = zeros(big.shape[:-1] + (nblocks * L,), big.dtype)
+    bigp[..., :Nb] = big
+    blocks = bigp.reshape(big.shape[:-1] + (nblocks, L))
+
+    # Bound the temporaries to about 2**22 points per chunk
+    chunk = max(1, 2**22 // int(np.prod(fshape)))
+    out = None
+    for start in range(0, nblocks, chunk):
+        stop = min(start + chunk, nblocks)
+        nb = stop - start
+        if complex_result:
+            Y = fftn(blocks[..., start:stop, :], fshape, axes)
+            Y *= H
+            y = ifftn(Y, axes=axes, overwrite_x=1)[oslice]
+        else:
+            Y = rfftn(blocks[..., start:stop, :], fshape, axes)
+            Y *= H
+            y = irfftn(Y, fshape, axes, overwrite_x=1)[oslice]
+        del Y
+        if out is None:
+            out = zeros(size[:-1] + [(nblocks + 1) * L], y.dtype)
+        out[..., start*L:stop*L] += y[..., :L].reshape(size[:-1] + [nb * L])
+        # the M-1 trailing points of each block overlap the next one
+        tail = zeros(size[:-1] + [nb, L], y.dtype)
+        tail[..., :M-1] = y[..., L:]
+        out[..., (start+1)*L:(stop+1)*L] += tail.reshape(size[:-1] + [nb * L])
+
+    return np.swapaxes(out[..., :size[-1]], axis, -1)
+
 def fftconvolve(in1, in2, mode="full"):
     """Convolve two N-dimensional arrays using FFT. See convolve.
 
+    When one input is much longer than the other along some axis, the
+    convolution is done by overlap-add along that axis: the long input is
+    cut into blocks, with an FFT size chosen from the length of the short
+    one, and a single spectrum of the short input is reused for all blocks.
+    This bounds the memory and avoids padding both inputs to the full
+    output size.
+
     """
     s1 = array(in1.shape)
     s2 = array(in2.shape)
@@ -130,14 +219,25 @@ def fftconvolve(in1, in2, mode="full"):
     size = s1+s2-1
 
     # Always use 2**n-sized FFT
-    fsize = 2**np.ceil(np.log2(size))
-    IN1 = fftn(in1,fsize)
-    IN1 *= fftn(in2,fsize)
+    fsize = (2**np.ceil(np.log2(size))).astype(int)
     fslice = tuple([slice(0, int(sz)) for sz in size])
-    ret = ifftn(IN1)[fslice].copy()
-    del IN1
-    if not complex_result:
-        ret = ret.real
+    oa_axis = _oa_axis(s1, s2)
+    if oa_axis is not None:
+        if (s1 >= s2).all():
+            ret = _fftconvolve_oa(in1, in2, oa_axis, complex_result)
+        else:
+            ret = _fftconvolve_oa(in2, in1, oa_axis, complex_result)
+    elif not complex_result:
+        # Real inputs only need the half spectrum
+        IN1 = rfftn(in1,fsize)
+        IN1 *= rfftn(in2,fsize)
+        ret = irfftn(IN1,fsize,overwrite_x=1)[fslice].copy()
+        del IN1
+    else:
+        IN1 = fftn(in1,fsize)
+        IN1 *= fftn(in2,fsize)
+        ret = ifftn(IN1)[fslice].copy()
+        del IN1
     if mode == "full":
         return ret
     elif mode == "same":
@@ -182,6 +182,45 @@ class TestFFTConvolve(TestCase):
         d = np.convolve(a, b, 'full')
         assert_(np.allclose(c, d, rtol=1e-10))
 
+    def test_random_data_real(self):
+        np.random.seed(1234)
+        a = np.random.rand(1233)
+        b = np.random.rand(1321)
+        c = signal.fftconvolve(a, b, 'full')
+        d = np.convolve(a, b, 'full')
+        assert_(np.isrealobj(c))
+        assert_(np.allclose(c, d, rtol=1e-10))
+
+    def test_overlap_add(self):
+        # long signal, short filter: blocked along the long axis
+        np.random.seed(1234)
+        a = np.random.rand(20000)
+        b = np.random.rand(37)
+        for mode in ['full', 'same', 'valid']:
+            c = signal.fftconvolve(a, b, mode)
+            d = np.convolve(a, b, mode)
+            assert_equal(c.shape, d.shape)
+            assert_array_almost_equal(c, d)
+            c = signal.fftconvolve(b, a, mode)
+            assert_equal(c.shape, d.shape)
+            assert_array_almost_equal(c, d)
+
+    def test_overlap_add_complex(self):
+        np.random.seed(1234)
+        a = np.random.rand(5000) + 1j*np.random.rand(5000)
+        b = np.random.rand(10) + 1j*np.random.rand(10)
+        c = signal.fftconvolve(a, b)
+        d = np.convolve(a, b)
+        assert_array_almost_equal(c, d)
+
+    def test_overlap_add_2d(self):
+        np.random.seed(1234)
+        a = np.random.rand(3, 4000)
+        b = np.random.rand(2, 9)
+        c = signal.fftconvolve(a, b)
+        d = convolve2d(a, b)
+        assert_array_almost_equal(c, d)
+
 class TestMedFilt(TestCase):
     def test_basic(self):
         f = [[50, 50, 50, 50, 50, 92, 18, 27, 65, 46],
@@ -8,6 +8,9 @@ from dok import *
 from coo import *
 from dia import *
 from bsr import *
+from sell import *
+from builder import *
+from expression import *
 from csgraph import *
 
 from construct import *
@@ -35,7 +35,8 @@ _formats = {'csc':[0, "Compressed Sparse Column"],
             'jad':[16, "JAgged Diagonal"],
             'uss':[17, "Unsymmetric Sparse Skyline"],
             'vbr':[18, "Variable Block Row"],
-            'und':[19, "Undefined"]
+            'und':[19, "Undefined"],
+            'sell':[20, "Sliced ELLpack"]
             }
 
 
@@ -480,6 +481,11 @@ class spmatrix(object):
     def tobsr(self, blocksize=None):
         return self.tocsr().tobsr(blocksize=blocksize)
 
+    def tosell(self, slice_height=None, sigma=None):
+        from sell import sell_matrix
+        return sell_matrix(self.tocsr(), slice_height=slice_height,
+                           sigma=sigma)
+
     def copy(self):
         return self.__class__(self,copy=True)
 
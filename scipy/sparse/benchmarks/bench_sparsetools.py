@@ -0,0 +1,350 @@
+"""Bandwidth benchmarks for the sparsetools kernels and format conversions
+
+The kernels of csr.h, csc.h, bsr.h, coo.h, dia.h and sell.h are timed
+through the sparse matrix methods that call them, on four families of
+square matrices:
+
+    banded     7 diagonals
+    powerlaw   graph with power-law in- and out-degrees (10 on average)
+    fem        2D finite element stencil of dense 3x3 blocks (BSR)
+    random     10 uniformly random entries per row
+
+The sizes range from 10^4 stored entries up to SCIPY_BENCH_SPARSE_NNZ
+(default 10^6).  Set it to 1e8 for the full sweep, on a machine with
+tens of GB of memory (a CSR matrix of 10^8 doubles alone takes 1.2GB).
+
+Sparse kernels are bound by memory bandwidth, so every timing is
+reported as the rate at which the kernel moves its operands and result,
+and as a fraction of the STREAM bandwidth of the machine.  The byte
+counts are lower bounds: each input and output array is counted once
+(in-place results once more), and index lookups and temporaries are
+ignored.  The STREAM bandwidth is measured with numpy, which runs on a
+single thread; set SCIPY_BENCH_STREAM_GBS to the figure reported by the
+STREAM benchmark itself to compare against all cores.
+
+The threaded kernel variants run when sparsetools.set_num_threads has
+been given a count other than 1.
+
+"""
+
+import os
+import time
+
+import numpy
+from numpy import ones, zeros, arange, random
+
+from numpy.testing import *
+
+from scipy import sparse
+from scipy.sparse import sparsetools, coo_matrix, dia_matrix, csr_expression
+
+
+#-------------------------------------------------------------------------------
+# matrix families
+
+def banded(nnz, bandwidth=3, dtype='d'):
+    """Band matrix with 2*bandwidth + 1 diagonals and about nnz entries"""
+    n = max(nnz // (2*bandwidth + 1), 2*bandwidth + 1)
+    offsets = arange(-bandwidth, bandwidth + 1)
+    data = random.random_sample((len(offsets), n)).astype(dtype)
+    return dia_matrix((data, offsets), shape=(n, n)).tocsr()
+
+def powerlaw(nnz, degree=10, exponent=2.2, dtype='d'):
+    """Adjacency matrix of a directed graph with about nnz edges
+
+    Each node draws a weight from a Pareto distribution.  Its out-degree
+    is proportional to its weight, and the targets of the edges are
+    drawn with probabilities proportional to the weights, so both
+    degree distributions follow a power law.
+    """
+    n = max(nnz // degree, 1)
+    weights = random.pareto(exponent - 1, n) + 1
+
+    out_degree = (weights * (float(nnz) / weights.sum())).astype(int)
+    out_degree = numpy.clip(out_degree, 1, n)
+    rows = arange(n).repeat(out_degree)
+
+    cdf = numpy.cumsum(weights)
+    cols = numpy.searchsorted(cdf, random.random_sample(len(rows)) * cdf[-1])
+    cols = numpy.minimum(cols, n - 1)
+
+    data = random.random_sample(len(rows)).astype(dtype)
+    A = coo_matrix((data, (rows, cols)), shape=(n, n)).tocsr()
+    A.sum_duplicates()
+    return A
+
+def fem(nnz, blocksize=3, dtype='d'):
+    """BSR matrix of a 2D finite element discretization, with a 9-point
+    stencil and blocksize unknowns per node, of about nnz entries"""
+    R = blocksize
+    N = max(int(numpy.sqrt(nnz / (9.0 * R * R))), 2)
+    T = sparse.spdiags(ones((3, N)), [-1, 0, 1], N, N)
+    K = sparse.kron(T, T, format='csr')
+    B = random.random_sample((R, R)).astype(dtype) + R * numpy.eye(R)
+    return sparse.kron(K, B, format='bsr')
+
+def uniform(nnz, degree=10, dtype='d'):
+    """Matrix with degree uniformly random entries per row"""
+    n = max(nnz // degree, 1)
+    rows = arange(n).repeat(degree)
+    cols = random.randint(0, n, n*degree)
+    data = random.random_sample(n*degree).astype(dtype)
+    A = coo_matrix((data, (rows, cols)), shape=(n, n)).tocsr()
+    A.sum_duplicates()
+    return A
+
+# name, generator, whether the DIA format suits the matrices
+families = [('banded',   banded,   True),
+            ('powerlaw', powerlaw, False),
+            ('fem',      fem,      True),
+            ('random',   uniform,  False)]
+
+def sizes():
+    """Numbers of stored entries to sweep"""
+    max_nnz = float(os.environ.get('SCIPY_BENCH_SPARSE_NNZ', 1e6))
+    return [10**k for k in range(4, 9) if 10**k <= max_nnz]
+
+
+#-------------------------------------------------------------------------------
+# memory bandwidth
+
+_stream = None
+
+def stream_bandwidth(n=10**7):
+    """Memory bandwidth in GB/s
+
+    The best rate of the STREAM copy, scale and add loops on arrays of n
+    doubles, run with numpy, unless SCIPY_BENCH_STREAM_GBS is set.
+    """
+    global _stream
+    if _stream is None:
+        if 'SCIPY_BENCH_STREAM_GBS' in os.environ:
+            _stream = float(os.environ['SCIPY_BENCH_STREAM_GBS'])
+        else:
+            a, b, c = zeros(n), ones(n), ones(n)
+            loops = [(16, lambda: a.__setitem__(Ellipsis, b)),  # copy
+                     (16, lambda: numpy.multiply(b, 3.0, a)),    # scale
+                     (24, lambda: numpy.add(b, c, a))]           # add
+            _stream = max([bytes * n / best_time(fn) / 1e9
+                           for bytes, fn in loops])
+    return _stream
+
+
+#-------------------------------------------------------------------------------
+# timing
+
+def best_time(fn, args=(), min_time=0.2, min_iter=3):
+    """Best wall clock time of fn(*args) in seconds
+
+    Wall clock rather than processor time, which adds up the time of
+    all threads.  Taking the best run discards the cold first one.
+    """
+    best = None
+    total = 0.0
+    iter = 0
+    while iter < min_iter or total < min_time:
+        start = time.time()
+        fn(*args)
+        t = time.time() - start
+        if best is None or t < best:
+            best = t
+        total += t
+        iter += 1
+    return max(best, 1e-9)
+
+_arrays = ['data', 'indices', 'indptr', 'row', 'col', 'offsets',
+           'slice_ptr', 'perm', 'row_lengths']
+
+def nbytes(x):
+    """Bytes of the arrays of x, a matrix, an array or a tuple of them"""
+    if isinstance(x, (tuple, list)):
+        return sum([nbytes(y) for y in x])
+    elif isinstance(x, numpy.ndarray):
+        return x.nbytes
+    elif sparse.isspmatrix(x):
+        return sum([getattr(x, name).nbytes for name in _arrays
+                    if name in x.__dict__])
+    else:
+        return 0
+
+def measure(fn, args):
+    """Best time of fn(*args) in seconds and the bytes of its arguments
+    and result"""
+    result = fn(*args)
+    if result is None:
+        # in place on the first argument
+        result = args[0]
+    traffic = nbytes(args) + nbytes(result)
+    del result
+    return best_time(fn, args), traffic
+
+
+#-------------------------------------------------------------------------------
+# kernels
+
+N_VECS = 8
+
+def _self(A):     return (A,)
+def _copy(A):     return (A.copy(),)
+def _pair(A):     return (A, A)
+def _vec(A):      return (A, ones(A.shape[1], dtype=A.dtype))
+def _vecs(A):     return (A, ones((A.shape[1], N_VECS), dtype=A.dtype))
+def _row_vec(A):  return (A.copy(), ones(A.shape[0], dtype=A.dtype))
+def _col_vec(A):  return (A.copy(), ones(A.shape[1], dtype=A.dtype))
+def _rows(A):     return (A, random.randint(0, A.shape[0], A.shape[0] // 2))
+def _cols(A):     return (A, random.randint(0, A.shape[1], A.shape[1] // 2))
+def _perm(A):     return (A, random.permutation(A.shape[0]))
+def _samples(A):
+    k = max(A.nnz // 10, 1)
+    return (A, random.randint(0, A.shape[0], k), random.randint(0, A.shape[1], k))
+
+def _sort_indices(A):
+    A.has_sorted_indices = False
+    A.sort_indices()
+
+def _submatrix(A):
+    M, N = A.shape
+    return A[M//4:3*M//4, N//4:3*N//4]
+
+def _scale(fn):
+    """In-place CSR or BSR scaling kernel fn applied to A with scales x"""
+    def scale(A, x):
+        if A.format == 'bsr':
+            R, C = A.blocksize
+            fn(A.shape[0] // R, A.shape[1] // C, R, C,
+               A.indptr, A.indices, A.data.ravel(), x)
+        else:
+            fn(A.shape[0], A.shape[1], A.indptr, A.indices, A.data, x)
+    return scale
+
+def _small(A):
+    """Whether the matrix is small enough for a dense copy"""
+    return A.shape[0] * A.shape[1] <= 10**7
+
+def _moderate(A):
+    """Whether the product of A with itself fits in memory"""
+    return A.nnz <= 10**6
+
+# for each format: kernel, arguments, operation, condition (if any)
+kernels = {
+ 'csr' : [('csr_matvec',             _vec,     lambda A, x: A * x,                     None),
+          ('csr_matvecs',            _vecs,    lambda A, X: A * X,                     None),
+          ('csr_diagonal',           _self,    lambda A: A.diagonal(),                 None),
+          ('csr_scale_rows',         _row_vec, _scale(sparsetools.csr_scale_rows),     None),
+          ('csr_scale_columns',      _col_vec, _scale(sparsetools.csr_scale_columns),  None),
+          ('csr_sort_indices',       _copy,    _sort_indices,                          None),
+          ('csr_sum_duplicates',     _copy,    lambda A: A.sum_duplicates(),           None),
+          ('csr_eliminate_zeros',    _copy,    lambda A: A.eliminate_zeros(),          None),
+          ('csr_plus_csr',           _pair,    lambda A, B: A + B,                     None),
+          ('csr_minus_csr',          _pair,    lambda A, B: A - B,                     None),
+          ('csr_elmul_csr',          _pair,    lambda A, B: A.multiply(B),             None),
+          ('csr_linear_combination', _pair,    lambda A, B: (csr_expression(A) +
+                                                   2*csr_expression(B)).tocsr(),       None),
+          ('csr_matmat',             _pair,    lambda A, B: A * B,                     _moderate),
+          ('csr_row_index',          _rows,    lambda A, rows: A[rows],                None),
+          ('csr_column_index',       _cols,    lambda A, cols: A[:,cols],              None),
+          ('get_csr_submatrix',      _self,    _submatrix,                             None),
+          ('csr_sample_values',      _samples, lambda A, I, J: A[I,J],                 None),
+          ('csr_symmetric_permute',  _perm,    lambda A, p: A.symmetric_permute(p),    None)],
+ 'csc' : [('csc_matvec',             _vec,     lambda A, x: A * x,                     None),
+          ('csc_matvecs',            _vecs,    lambda A, X: A * X,                     None),
+          ('csc_diagonal',           _self,    lambda A: A.diagonal(),                 None),
+          ('csc_plus_csc',           _pair,    lambda A, B: A + B,                     None),
+          ('csc_elmul_csc',          _pair,    lambda A, B: A.multiply(B),             None),
+          ('csc_matmat',             _pair,    lambda A, B: A * B,                     _moderate)],
+ 'bsr' : [('bsr_matvec',             _vec,     lambda A, x: A * x,                     None),
+          ('bsr_matvecs',            _vecs,    lambda A, X: A * X,                     None),
+          ('bsr_diagonal',           _self,    lambda A: A.diagonal(),                 None),
+          ('bsr_scale_rows',         _row_vec, _scale(sparsetools.bsr_scale_rows),     None),
+          ('bsr_scale_columns',      _col_vec, _scale(sparsetools.bsr_scale_columns),  None),
+          ('bsr_sort_indices',       _copy,    _sort_indices,                          None),
+          ('bsr_transpose',          _self,    lambda A: A.transpose(),                None),
+          ('bsr_plus_bsr',           _pair,    lambda A, B: A + B,                     None),
+          ('bsr_minus_bsr',          _pair,    lambda A, B: A - B,                     None),
+          ('bsr_elmul_bsr',          _pair,    lambda A, B: A.multiply(B),             None),
+          ('bsr_matmat',             _pair,    lambda A, B: A * B,                     _moderate)],
+ 'coo' : [('coo_matvec',             _vec,     lambda A, x: A * x,                     None),
+          ('coo_todense',            _self,    lambda A: A.toarray(),                  _small)],
+ 'dia' : [('dia_matvec',             _vec,     lambda A, x: A * x,                     None),
+          ('dia_matvecs',            _vecs,    lambda A, X: A * X,                     None)],
+ 'sell': [('sell_matvec',            _vec,     lambda A, x: A * x,                     None),
+          ('sell_matvecs',           _vecs,    lambda A, X: A * X,                     None)],
+}
+
+formats = ['csr', 'csc', 'bsr', 'coo', 'dia', 'sell']
+
+
+class BenchmarkSparsetools(TestCase):
+    """Memory bandwidth of the sparsetools kernels"""
+
+    def bench_stream(self):
+        print
+        print '        Memory bandwidth (STREAM): %6.2f GB/s' % stream_bandwidth()
+
+    def bench_kernels(self):
+        stream = stream_bandwidth()
+
+        for family, generate, dia_ok in families:
+            print
+            print '          sparsetools kernels, %s matrices' % family
+            print '          (STREAM bandwidth %.2f GB/s)' % stream
+            print '=================================================================================='
+            print ' format |         kernel          |    shape    |    nnz    | time (msec) |  GB/s  | % STREAM '
+            print '----------------------------------------------------------------------------------'
+            fmt = '  %4s  | %23s | %11d | %9d |  %9.3f  | %6.2f | %6.1f '
+
+            for nnz in sizes():
+                base = generate(nnz)
+
+                for format in formats:
+                    if format == 'dia' and not dia_ok:
+                        continue
+                    A = base.asformat(format)
+
+                    for kernel, setup, fn, applies in kernels[format]:
+                        if applies is not None and not applies(A):
+                            continue
+                        args = setup(A)
+                        seconds, traffic = measure(fn, args)
+                        rate = traffic / seconds / 1e9
+                        print fmt % (format, kernel, A.shape[0], A.nnz,
+                                     1e3 * seconds, rate, 100 * rate / stream)
+                        del args
+                    del A
+
+                del base
+
+    def bench_conversions(self):
+        stream = stream_bandwidth()
+
+        for family, generate, dia_ok in families:
+            targets = [f for f in formats if dia_ok or f != 'dia']
+
+            print
+            print '          Format conversions, %s matrices (GB/s)' % family
+            print '          (STREAM bandwidth %.2f GB/s)' % stream
+            print '========================================================================='
+            print '    nnz    |  from  ' + ''.join(['|  to%-4s ' % f for f in targets])
+            print '-------------------------------------------------------------------------'
+
+            for nnz in sizes():
+                base = generate(nnz)
+
+                for source in targets:
+                    A = base.asformat(source)
+                    output = ' %9d |  %4s  ' % (A.nnz, source)
+                    for target in targets:
+                        if target == source:
+                            output += '|    -    '
+                            continue
+                        fn = getattr(A.__class__, 'to' + target)
+                        seconds, traffic = measure(fn, (A,))
+                        output += '| %7.2f ' % (traffic / seconds / 1e9)
+                    print output
+                    del A
+
+                del base
+
+
+if __name__ == "__main__":
+    run_module_suite()
@@ -0,0 +1,184 @@
+"""Incremental assembly of sparse matrices"""
+
+__docformat__ = "restructuredtext en"
+
+__all__ = ['csr_builder']
+
+import numpy as np
+
+from sputils import getdtype, isshape, get_index_dtype
+import sparsetools
+from sparsetools import csr_add_coo, expandptr
+
+class csr_builder(object):
+    """Incremental assembly of a CSR matrix from batches of (i, j, v)
+
+    Values added at the same position are summed, as in
+    ``A[i,j] += v``.  The builder keeps a canonical CSR matrix of all
+    positions seen so far and adds new values straight into it, so once
+    the sparsity pattern is known (e.g. after the first step of a
+    finite element assembly loop) adding a batch costs one binary search
+    per value and allocates nothing.  Values at new positions are
+    buffered and merged into the pattern in bulk.
+
+    This can be instantiated in several ways:
+        csr_builder((M, N), [dtype])
+            to assemble a matrix with shape (M, N),
+            dtype is optional, defaulting to dtype='d'.
+
+        csr_builder(S)
+            to start from the sparsity pattern and values of the
+            sparse matrix S
+
+    Notes
+    -----
+    Pass whole arrays of indices and values to add(); adding one value
+    per call is dominated by the Python call overhead.
+
+    Examples
+    --------
+    >>> from scipy.sparse import csr_builder
+    >>> from numpy import array
+    >>> B = csr_builder((3,3))
+    >>> B.add(array([0,1,2,0]), array([0,1,2,0]), 1.0)
+    >>> B.add(2, array([0,1]), array([5.0,6.0]))
+    >>> B.tocsr().todense()
+    matrix([[ 2.,  0.,  0.],
+            [ 0.,  1.,  0.],
+            [ 5.,  6.,  1.]])
+
+    """
+
+    def __init__(self, arg1, dtype=None):
+        if isshape(arg1):
+            M, N = arg1
+            self.shape = (int(M), int(N))
+            self.dtype = getdtype(dtype, default=float)
+            idx_dtype  = get_index_dtype(maxval=max(self.shape))
+            self.indptr  = np.zeros(self.shape[0] + 1, dtype=idx_dtype)
+            self.indices = np.zeros(0, dtype=idx_dtype)
+            self.data    = np.zeros(0, dtype=self.dtype)
+        else:
+            from base import isspmatrix
+            if not isspmatrix(arg1):
+                raise ValueError('expected a shape or a sparse matrix')
+            # only csr_matrix.tocsr() takes copy, and it returns arg1
+            # itself, which sum_duplicates() must not modify
+            A = arg1.tocsr()
+            if A is arg1:
+                A = A.copy()
+            A.sum_duplicates()
+            self.shape   = A.shape
+            self.dtype   = getdtype(dtype, A)
+            self.indptr  = A.indptr
+            self.indices = A.indices
+            self.data    = A.data.astype(self.dtype)
+
+        self._pending = []
+        self._n_pending = 0
+
+    def add(self, i, j, v):
+        """Add v to the entries at rows i and columns j
+
+        i, j and v are broadcast against each other.  Negative indices
+        count from the end, as in ``A[i,j] += v``.
+        """
+        M, N = self.shape
+        i, j, v = np.broadcast_arrays(i, j, v)
+
+        if i.size == 0:
+            return
+        if i.min() < -M or i.max() >= M or j.min() < -N or j.max() >= N:
+            raise IndexError('index out of bounds')
+
+        i = np.array(i, dtype=self.indices.dtype).ravel()
+        j = np.array(j, dtype=self.indices.dtype).ravel()
+        v = np.array(v, dtype=self.dtype).ravel()
+        i[i < 0] += M
+        j[j < 0] += N
+
+        if len(self.indices) > 0:
+            flag = np.empty(len(i), dtype=self.indices.dtype)
+            n_missing = csr_add_coo(M, N, self.indptr, self.indices,
+                                    self.data, len(i), i, j, v, flag)
+            if n_missing == 0:
+                return
+            missing = flag.nonzero()[0]
+            i, j, v = i[missing], j[missing], v[missing]
+
+        self._pending.append((i, j, v))
+        self._n_pending += len(i)
+
+        # merging costs O(nnz), so only do it once the buffer is as large
+        # as the pattern; later batches then hit the pattern
+        if self._n_pending >= max(len(self.indices), 2**16):
+            self._merge()
+
+    def zero(self):
+        """Set all values to zero, keeping the sparsity pattern"""
+        self._merge()
+        self.data[:] = 0
+
+    def getnnz(self):
+        """number of stored values, including explicit zeros"""
+        self._merge()
+        return len(self.indices)
+
+    nnz = property(fget=getnnz)
+
+    def tocsr(self, copy=True):
+        """Return the assembled matrix in Compressed Sparse Row format
+
+        The result has sorted indices and no duplicates.  It is a
+        snapshot of the values added so far.  copy=False skips copying
+        the arrays, so later calls to add() or zero() may or may not
+        show up in the result; call tocsr() again after adding values.
+        """
+        from csr import csr_matrix
+        self._merge()
+        A = csr_matrix((self.data, self.indices, self.indptr),
+                       shape=self.shape, copy=copy)
+        A.has_sorted_indices = True
+        return A
+
+    def tocoo(self):
+        """Return a copy of the assembled matrix in COOrdinate format
+
+        The entries are sorted by row, then column, with no duplicates.
+        """
+        return self.tocsr(copy=False).tocoo(copy=True)
+
+    def _merge(self):
+        """Merge the buffered values into the sparsity pattern"""
+        if self._n_pending == 0:
+            return
+
+        M, N = self.shape
+        nnz = len(self.indices) + self._n_pending
+        idx_dtype = get_index_dtype(maxval=max(M, N, nnz))
+
+        rows = np.empty(len(self.indices), dtype=self.indices.dtype)
+        expandptr(M, self.indptr, rows)
+        pending = zip(*self._pending)
+        row  = np.concatenate((rows,) + pending[0]).astype(idx_dtype)
+        col  = np.concatenate((self.indices,) + pending[1]).astype(idx_dtype)
+        data = np.concatenate((self.data,) + pending[2])
+
+        indptr  = np.empty(M + 1, dtype=idx_dtype)
+        indices = np.empty(nnz, dtype=idx_dtype)
+        values  = np.empty(nnz, dtype=self.dtype)
+        sparsetools.coo_tocsr_canonical(M, N, nnz, row, col, data,
+                                        indptr, indices, values,
+                                        sparsetools.get_num_threads())
+
+        self.indptr  = indptr
+        self.indices = indices[:indptr[-1]].copy()
+        self.data    = values[:indptr[-1]].copy()
+        self._pending = []
+        self._n_pending = 0
+
+    def __repr__(self):
+        return "<%dx%d sparse matrix builder of type '%s'\n" \
+               "\twith %d stored elements and %d buffered values>" % \
+               (self.shape + (self.dtype.type, len(self.indices),
+                              self._n_pending))
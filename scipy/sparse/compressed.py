@@ -11,7 +11,7 @@ from base import spmatrix, isspmatrix, SparseEfficiencyWarning
 from data import _data_matrix
 import sparsetools
 from sputils import upcast, to_native, isdense, isshape, getdtype, \
-        isscalarlike, isintlike
+        isscalarlike, isintlike, get_index_dtype
 
 
 class _cs_matrix(_data_matrix):
@@ -34,9 +34,10 @@ class _cs_matrix(_data_matrix):
                 # create empty matrix
                 self.shape = arg1   #spmatrix checks for errors here
                 M, N = self.shape
+                idx_dtype = get_index_dtype(maxval=max(M,N))
                 self.data    = np.zeros(0, getdtype(dtype, default=float))
-                self.indices = np.zeros(0, np.intc)
-                self.indptr  = np.zeros(self._swap((M,N))[0] + 1, dtype=np.intc)
+                self.indices = np.zeros(0, idx_dtype)
+                self.indptr  = np.zeros(self._swap((M,N))[0] + 1, dtype=idx_dtype)
             else:
                 if len(arg1) == 2:
                     # (data, ij) format
@@ -121,9 +122,10 @@ class _cs_matrix(_data_matrix):
             warn("indices array has non-integer dtype (%s)" \
                     % self.indices.dtype.name )
 
-        # only support 32-bit ints for now
-        self.indptr  = np.asarray(self.indptr,  dtype=np.intc)
-        self.indices = np.asarray(self.indices, dtype=np.intc)
+        # use 32-bit indices whenever the dimensions and nnz allow
+        idx_dtype = get_index_dtype(maxval=max(self.shape + (len(self.indices),)))
+        self.indptr  = np.asarray(self.indptr,  dtype=idx_dtype)
+        self.indices = np.asarray(self.indices, dtype=idx_dtype)
         self.data    = to_native(self.data)
 
         # check array shapes
@@ -254,8 +256,14 @@ class _cs_matrix(_data_matrix):
         result = np.zeros( self.shape[0], dtype=upcast(self.dtype,other.dtype) )
 
         # csr_matvec or csc_matvec
-        fn = getattr(sparsetools,self.format + '_matvec')
-        fn(M, N, self.indptr, self.indices, self.data, other, result)
+        n_threads = sparsetools.get_num_threads()
+        if n_threads != 1:
+            fn = getattr(sparsetools,self.format + '_matvec_threads')
+            fn(M, N, self.indptr, self.indices, self.data, other, result,
+               n_threads)
+        else:
+            fn = getattr(sparsetools,self.format + '_matvec')
+            fn(M, N, self.indptr, self.indices, self.data, other, result)
 
         return result
 
@@ -267,8 +275,14 @@ class _cs_matrix(_data_matrix):
         result = np.zeros( (M,n_vecs), dtype=upcast(self.dtype,other.dtype) )
 
         # csr_matvecs or csc_matvecs
-        fn = getattr(sparsetools,self.format + '_matvecs')
-        fn(M, N, n_vecs, self.indptr, self.indices, self.data, other.ravel(), result.ravel())
+        n_threads = sparsetools.get_num_threads()
+        if n_threads != 1:
+            fn = getattr(sparsetools,self.format + '_matvecs_threads')
+            fn(M, N, n_vecs, self.indptr, self.indices, self.data,
+               other.ravel(), result.ravel(), n_threads)
+        else:
+            fn = getattr(sparsetools,self.format + '_matvecs')
+            fn(M, N, n_vecs, self.indptr, self.indices, self.data, other.ravel(), result.ravel())
 
         return result
 
@@ -277,23 +291,41 @@ class _cs_matrix(_data_matrix):
         M, K1 = self.shape
         K2, N = other.shape
 
+        other = self.__class__(other) #convert to this format
+
+        # nnz(C) is at most nnz(A) times the length of the longest row of B
+        first, second = self._swap((self, other))
+        lengths = np.diff(second.indptr)
+        longest = lengths.max() if len(lengths) else 0
+        idx_dtype = get_index_dtype(maxval=max(M, N, K1, self.nnz, other.nnz,
+                                    min(M*N, int(first.nnz) * int(longest))))
+        A_indptr  = np.asarray(self.indptr,   dtype=idx_dtype)
+        A_indices = np.asarray(self.indices,  dtype=idx_dtype)
+        B_indptr  = np.asarray(other.indptr,  dtype=idx_dtype)
+        B_indices = np.asarray(other.indices, dtype=idx_dtype)
+
         major_axis = self._swap((M,N))[0]
-        indptr = np.empty(major_axis + 1, dtype=np.intc)
+        indptr = np.empty(major_axis + 1, dtype=idx_dtype)
 
-        other = self.__class__(other) #convert to this format
-        fn = getattr(sparsetools, self.format + '_matmat_pass1')
-        fn( M, N, self.indptr, self.indices, \
-                  other.indptr, other.indices, \
-                  indptr)
+        n_threads = sparsetools.get_num_threads()
+        if n_threads != 1:
+            extra, suffix = (n_threads,), '_threads'
+        else:
+            extra, suffix = (), ''
+
+        fn = getattr(sparsetools, self.format + '_matmat_pass1' + suffix)
+        fn( M, N, A_indptr, A_indices, \
+                  B_indptr, B_indices, \
+                  indptr, *extra)
 
         nnz = indptr[-1]
-        indices = np.empty(nnz, dtype=np.intc)
+        indices = np.empty(nnz, dtype=idx_dtype)
         data    = np.empty(nnz, dtype=upcast(self.dtype,other.dtype))
 
-        fn = getattr(sparsetools, self.format + '_matmat_pass2')
-        fn( M, N, self.indptr, self.indices, self.data, \
-                  other.indptr, other.indices, other.data, \
-                  indptr, indices, data)
+        fn = getattr(sparsetools, self.format + '_matmat_pass2' + suffix)
+        fn( M, N, A_indptr, A_indices, self.data, \
+                  B_indptr, B_indices, other.data, \
+                  indptr, indices, data, *extra)
 
         return self.__class__((data,indices,indptr),shape=(M,N))
 
@@ -537,7 +569,7 @@ class _cs_matrix(_data_matrix):
             data = data.copy()
             minor_indices = minor_indices.copy()
 
-        major_indices = np.empty(len(minor_indices), dtype=np.intc)
+        major_indices = np.empty(len(minor_indices), dtype=self.indptr.dtype)
 
         sparsetools.expandptr(major_dim,self.indptr,major_indices)
 
@@ -615,10 +647,54 @@ class _cs_matrix(_data_matrix):
         """
 
         if not self.has_sorted_indices:
-            fn = sparsetools.csr_sort_indices
-            fn( len(self.indptr) - 1, self.indptr, self.indices, self.data)
+            n_threads = sparsetools.get_num_threads()
+            if n_threads != 1:
+                sparsetools.csr_sort_indices_threads(len(self.indptr) - 1,
+                        self.indptr, self.indices, self.data, n_threads)
+            else:
+                fn = sparsetools.csr_sort_indices
+                fn( len(self.indptr) - 1, self.indptr, self.indices, self.data)
             self.has_sorted_indices = True
 
+    def symmetric_permute(self, perm):
+        """Return P*A*P^T for the permutation matrix P given by perm
+
+        Row and column perm[k] of this matrix become row and column k of
+        the result, which has sorted indices.  Combined with an ordering
+        such as cs_graph_reverse_cuthill_mckee this improves the memory
+        locality of matrix-vector products.
+
+        Examples
+        --------
+        >>> from scipy.sparse import csr_matrix
+        >>> A = csr_matrix([[1,2,0],[0,3,0],[4,0,5]])
+        >>> A.symmetric_permute([2,0,1]).todense()
+        matrix([[5, 4, 0],
+                [0, 1, 2],
+                [0, 0, 3]])
+
+        """
+        M,N = self.shape
+        if M != N:
+            raise ValueError('matrix must be square')
+
+        perm = np.asarray(perm, dtype=self.indices.dtype)
+        if perm.shape != (M,) or \
+                (np.sort(perm) != np.arange(M, dtype=perm.dtype)).any():
+            raise ValueError('perm must be a permutation of range(%d)' % M)
+
+        nnz = self.indptr[-1]
+        indptr  = np.empty_like(self.indptr)
+        indices = np.empty(nnz, dtype=self.indices.dtype)
+        data    = np.empty(nnz, dtype=self.data.dtype)
+        sparsetools.csr_symmetric_permute(M, self.indptr, self.indices,
+                self.data, perm, indptr, indices, data,
+                sparsetools.get_num_threads())
+
+        A = self.__class__((data, indices, indptr), shape=self.shape)
+        A.has_sorted_indices = True
+        return A
+
     def prune(self):
         """Remove empty space after all non-zero elements.
         """
@@ -660,13 +736,16 @@ class _cs_matrix(_data_matrix):
         fn = getattr(sparsetools, self.format + op + self.format)
 
         maxnnz  = self.nnz + other.nnz
-        indptr  = np.empty_like(self.indptr)
-        indices = np.empty(maxnnz, dtype=np.intc)
+        idx_dtype = get_index_dtype(maxval=max(self.shape + (maxnnz,)))
+        indptr  = np.empty(len(self.indptr), dtype=idx_dtype)
+        indices = np.empty(maxnnz, dtype=idx_dtype)
         data    = np.empty(maxnnz, dtype=upcast(self.dtype,other.dtype))
 
         fn(self.shape[0], self.shape[1], \
-                self.indptr,  self.indices,  self.data,
-                other.indptr, other.indices, other.data,
+                np.asarray(self.indptr,   dtype=idx_dtype),
+                np.asarray(self.indices,  dtype=idx_dtype), self.data,
+                np.asarray(other.indptr,  dtype=idx_dtype),
+                np.asarray(other.indices, dtype=idx_dtype), other.data,
                 indptr, indices, data)
 
         actual_nnz = indptr[-1]
@@ -11,7 +11,7 @@ from warnings import warn
 
 import numpy as np
 
-from sputils import upcast
+from sputils import upcast, get_index_dtype
 
 from csr import csr_matrix
 from csc import csc_matrix
@@ -19,6 +19,7 @@ from bsr import bsr_matrix
 from coo import coo_matrix
 from lil import lil_matrix
 from dia import dia_matrix
+import sparsetools
 
 def spdiags(data, diags, m, n, format=None):
     """
@@ -82,15 +83,16 @@ def identity(n, dtype='d', format=None):
 
     """
 
+    idx_dtype = get_index_dtype(maxval=n)
     if format in ['csr','csc']:
-        indptr  = np.arange(n+1, dtype=np.intc)
-        indices = np.arange(n,   dtype=np.intc)
+        indptr  = np.arange(n+1, dtype=idx_dtype)
+        indices = np.arange(n,   dtype=idx_dtype)
         data    = np.ones(n,     dtype=dtype)
         cls = eval('%s_matrix' % format)
         return cls((data,indices,indptr),(n,n))
     elif format == 'coo':
-        row  = np.arange(n, dtype=np.intc)
-        col  = np.arange(n, dtype=np.intc)
+        row  = np.arange(n, dtype=idx_dtype)
+        col  = np.arange(n, dtype=idx_dtype)
         data = np.ones(n, dtype=dtype)
         return coo_matrix((data,(row,col)),(n,n))
     elif format == 'dia':
@@ -156,39 +158,35 @@ def kron(A, B, format=None):
             # kronecker product is the zero matrix
             return coo_matrix( output_shape )
 
+        # each block is a multiple of B, formed without temporaries
         B = B.toarray()
-        data = A.data.repeat(B.size).reshape(-1,B.shape[0],B.shape[1])
-        data = data * B
+        data = A.data.reshape(-1,1,1) * B
 
         return bsr_matrix((data,A.indices,A.indptr), shape=output_shape)
     else:
-        #use COO
-        A = coo_matrix(A)
-        output_shape = (A.shape[0]*B.shape[0], A.shape[1]*B.shape[1])
-
-        if A.nnz == 0 or B.nnz == 0:
-            # kronecker product is the zero matrix
-            return coo_matrix( output_shape )
-
-        # expand entries of a into blocks
-        row  = A.row.repeat(B.nnz)
-        col  = A.col.repeat(B.nnz)
-        data = A.data.repeat(B.nnz)
+        #use CSR
+        if format == 'csc':
+            # kron(A,B).T == kron(A.T,B.T) is in CSC format without a conversion
+            return kron(csc_matrix(A).T, B.T, format='csr').T
 
-        row *= B.shape[0]
-        col *= B.shape[1]
+        A = csr_matrix(A)
+        B = B.tocsr()
+        output_shape = (A.shape[0]*B.shape[0], A.shape[1]*B.shape[1])
 
-        # increment block indices
-        row,col = row.reshape(-1,B.nnz),col.reshape(-1,B.nnz)
-        row += B.row
-        col += B.col
-        row,col = row.reshape(-1),col.reshape(-1)
+        dtype = upcast(A.dtype, B.dtype)
+        idx_dtype = get_index_dtype(maxval=max(output_shape +
+                                               (int(A.nnz) * int(B.nnz),)))
 
-        # compute block entries
-        data = data.reshape(-1,B.nnz) * B.data
-        data = data.reshape(-1)
+        indptr, indices, data = sparsetools.csr_kron(
+                A.shape[0], A.shape[1], A.indptr.astype(idx_dtype),
+                A.indices.astype(idx_dtype), A.data.astype(dtype),
+                B.shape[0], B.shape[1], B.indptr.astype(idx_dtype),
+                B.indices.astype(idx_dtype), B.data.astype(dtype),
+                sparsetools.get_num_threads())
 
-        return coo_matrix((data,(row,col)), shape=output_shape).asformat(format)
+        C = csr_matrix((data,indices,indptr), shape=output_shape)
+        C.has_sorted_indices = A.has_sorted_indices and B.has_sorted_indices
+        return C.asformat(format)
 
 def kronsum(A, B, format=None):
     """kronecker sum of sparse matrices A and B
@@ -216,8 +214,8 @@ def kronsum(A, B, format=None):
 
 
     """
-    A = coo_matrix(A)
-    B = coo_matrix(B)
+    A = csr_matrix(A)
+    B = csr_matrix(B)
 
     if A.shape[0] != A.shape[1]:
         raise ValueError('A is not square')
@@ -225,12 +223,28 @@ def kronsum(A, B, format=None):
     if B.shape[0] != B.shape[1]:
         raise ValueError('B is not square')
 
+    if not A.has_sorted_indices:
+        A = A.sorted_indices()
+    if not B.has_sorted_indices:
+        B = B.sorted_indices()
+
     dtype = upcast(A.dtype, B.dtype)
 
-    L = kron(identity(B.shape[0],dtype=dtype), A, format=format)
-    R = kron(B, identity(A.shape[0],dtype=dtype), format=format)
+    # the two products are merged row by row without forming either one
+    n = A.shape[0] * B.shape[0]
+    idx_dtype = get_index_dtype(maxval=max(n, int(A.nnz) * B.shape[0] +
+                                              int(B.nnz) * A.shape[0]))
+
+    indptr, indices, data = sparsetools.csr_kronsum(
+            A.shape[0], A.indptr.astype(idx_dtype),
+            A.indices.astype(idx_dtype), A.data.astype(dtype),
+            B.shape[0], B.indptr.astype(idx_dtype),
+            B.indices.astype(idx_dtype), B.data.astype(dtype),
+            sparsetools.get_num_threads())
 
-    return (L+R).asformat(format) #since L + R is not always same format
+    C = csr_matrix((data,indices,indptr), shape=(n,n))
+    C.has_sorted_indices = True
+    return C.asformat(format)
 
 
 def hstack(blocks, format=None, dtype=None):
@@ -330,15 +344,28 @@ def bmat(blocks, format=None, dtype=None):
 
     M,N = blocks.shape
 
+    if format == 'csc':
+        # bmat(blocks).T is built from the transposed blocks in CSR
+        # format and is then in CSC format without a conversion
+        blocksT = np.empty((N,M), dtype='object')
+        for i in range(M):
+            for j in range(N):
+                if blocks[i,j] is not None:
+                    blocksT[j,i] = csc_matrix(blocks[i,j]).T
+        return bmat(blocksT, format='csr', dtype=dtype).T
+
+    # the block dimensions are summed into the shape of the result, so
+    # they are counted in 64 bits; get_index_dtype picks the index dtype
+    # once that shape is known
     block_mask   = np.zeros(blocks.shape,    dtype=np.bool)
-    brow_lengths = np.zeros(blocks.shape[0], dtype=np.intc)
-    bcol_lengths = np.zeros(blocks.shape[1], dtype=np.intc)
+    brow_lengths = np.zeros(blocks.shape[0], dtype=np.int64)
+    bcol_lengths = np.zeros(blocks.shape[1], dtype=np.int64)
 
-    # convert everything to COO format
+    # convert everything to CSR format
     for i in range(M):
         for j in range(N):
             if blocks[i,j] is not None:
-                A = coo_matrix(blocks[i,j])
+                A = csr_matrix(blocks[i,j])
                 blocks[i,j] = A
                 block_mask[i,j] = True
 
@@ -361,33 +388,34 @@ def bmat(blocks, format=None, dtype=None):
     if bcol_lengths.min() == 0:
         raise ValueError('blocks[:,%d] is all None' % bcol_lengths.argmin() )
 
-    nnz = sum([ A.nnz for A in blocks[block_mask] ])
+    mats = blocks[block_mask]
+    nnz  = [ int(A.indptr[-1]) for A in mats ]
     if dtype is None:
-        dtype = upcast( *tuple([A.dtype for A in blocks[block_mask]]) )
+        dtype = upcast( *tuple([A.dtype for A in mats]) )
+
+    shape = (int(np.sum(brow_lengths)), int(np.sum(bcol_lengths)))
+    idx_dtype = get_index_dtype(maxval=max(shape + (sum(nnz),)))
 
     row_offsets = np.concatenate(([0], np.cumsum(brow_lengths)))
     col_offsets = np.concatenate(([0], np.cumsum(bcol_lengths)))
 
-    data = np.empty(nnz, dtype=dtype)
-    row  = np.empty(nnz, dtype=np.intc)
-    col  = np.empty(nnz, dtype=np.intc)
-
-    nnz = 0
-    for i in range(M):
-        for j in range(N):
-            if blocks[i,j] is not None:
-                A = blocks[i,j]
-                data[nnz:nnz + A.nnz] = A.data
-                row[nnz:nnz + A.nnz]  = A.row
-                col[nnz:nnz + A.nnz]  = A.col
+    # start of each block in the concatenated arrays, -1 for None
+    offsets = -np.ones(blocks.shape, dtype=idx_dtype)
+    offsets[block_mask] = np.concatenate(([0], np.cumsum(nnz)[:-1]))
 
-                row[nnz:nnz + A.nnz] += row_offsets[i]
-                col[nnz:nnz + A.nnz] += col_offsets[j]
+    indptr  = np.concatenate([A.indptr for A in mats])
+    indices = np.concatenate([A.indices[:n] for A, n in zip(mats, nnz)])
+    data    = np.concatenate([A.data[:n] for A, n in zip(mats, nnz)])
 
-                nnz += A.nnz
+    indptr, indices, data = sparsetools.csr_bmat(M, N,
+            row_offsets.astype(idx_dtype), col_offsets.astype(idx_dtype),
+            offsets.ravel(), indptr.astype(idx_dtype),
+            indices.astype(idx_dtype), data.astype(dtype),
+            sparsetools.get_num_threads())
 
-    shape = (np.sum(brow_lengths), np.sum(bcol_lengths))
-    return coo_matrix((data, (row, col)), shape=shape).asformat(format)
+    C = csr_matrix((data, indices, indptr), shape=shape)
+    C.has_sorted_indices = all([A.has_sorted_indices for A in mats])
+    return C.asformat(format)
 
 def rand(m, n, density=0.01, format="coo", dtype=None):
     """Generate a sparse matrix of the given shape and density with uniformely
@@ -8,10 +8,12 @@ from warnings import warn
 
 import numpy as np
 
+import sparsetools
 from sparsetools import coo_tocsr, coo_todense, coo_matvec
 from base import isspmatrix
 from data import _data_matrix
-from sputils import upcast, to_native, isshape, getdtype, isintlike
+from sputils import upcast, to_native, isshape, getdtype, isintlike, \
+        get_index_dtype
 
 class coo_matrix(_data_matrix):
     """
@@ -100,8 +102,9 @@ class coo_matrix(_data_matrix):
             if isshape(arg1):
                 M, N = arg1
                 self.shape = (M,N)
-                self.row  = np.array([], dtype=np.intc)
-                self.col  = np.array([], dtype=np.intc)
+                idx_dtype = get_index_dtype(maxval=max(M, N))
+                self.row  = np.array([], dtype=idx_dtype)
+                self.col  = np.array([], dtype=idx_dtype)
                 self.data = np.array([], getdtype(dtype, default=float))
             else:
                 try:
@@ -115,21 +118,25 @@ class coo_matrix(_data_matrix):
                 except TypeError:
                     raise TypeError('invalid input format')
 
-                self.row  = np.array(ij[0], copy=copy, dtype=np.intc)
-                self.col  = np.array(ij[1], copy=copy, dtype=np.intc)
-                self.data = np.array(  obj, copy=copy)
+                row, col = np.asarray(ij[0]), np.asarray(ij[1])
 
                 if shape is None:
-                    if len(self.row) == 0 or len(self.col) == 0:
+                    if len(row) == 0 or len(col) == 0:
                         raise ValueError('cannot infer dimensions from zero sized index arrays')
-                    M = self.row.max() + 1
-                    N = self.col.max() + 1
+                    M = row.max() + 1
+                    N = col.max() + 1
                     self.shape = (M, N)
                 else:
                     # Use 2 steps to ensure shape has length 2.
                     M, N = shape
                     self.shape = (M, N)
 
+                # _check() narrows this further once nnz is known
+                idx_dtype = get_index_dtype(maxval=max(self.shape))
+                self.row  = np.array(row, copy=copy, dtype=idx_dtype)
+                self.col  = np.array(col, copy=copy, dtype=idx_dtype)
+                self.data = np.array(  obj, copy=copy)
+
         elif arg1 is None:
             # Initialize an empty matrix.
             if not isinstance(shape, tuple) or not isintlike(shape[0]):
@@ -137,9 +144,10 @@ class coo_matrix(_data_matrix):
             warn('coo_matrix(None, shape=(M,N)) is deprecated, ' \
                     'use coo_matrix( (M,N) ) instead', DeprecationWarning)
             self.shape = shape
+            idx_dtype = get_index_dtype(maxval=max(self.shape))
             self.data = np.array([], getdtype(dtype, default=float))
-            self.row  = np.array([], dtype=np.intc)
-            self.col  = np.array([], dtype=np.intc)
+            self.row  = np.array([], dtype=idx_dtype)
+            self.col  = np.array([], dtype=idx_dtype)
         else:
             if isspmatrix(arg1):
                 if isspmatrix_coo(arg1) and copy:
@@ -195,9 +203,10 @@ class coo_matrix(_data_matrix):
             warn("col index array has non-integer dtype (%s) " \
                     % self.col.dtype.name )
 
-        # only support 32-bit ints for now
-        self.row  = np.asarray(self.row, dtype=np.intc)
-        self.col  = np.asarray(self.col, dtype=np.intc)
+        # use 32-bit indices whenever the dimensions and nnz allow
+        idx_dtype = get_index_dtype(maxval=max(self.shape + (nnz,)))
+        self.row  = np.asarray(self.row, dtype=idx_dtype)
+        self.col  = np.asarray(self.col, dtype=idx_dtype)
         self.data = to_native(self.data)
 
         if nnz > 0:
@@ -246,10 +255,20 @@ class coo_matrix(_data_matrix):
             return csc_matrix(self.shape, dtype=self.dtype)
         else:
             M,N = self.shape
-            indptr  = np.empty(N + 1,    dtype=np.intc)
-            indices = np.empty(self.nnz, dtype=np.intc)
+            indptr  = np.empty(N + 1,    dtype=self.row.dtype)
+            indices = np.empty(self.nnz, dtype=self.row.dtype)
             data    = np.empty(self.nnz, dtype=upcast(self.dtype))
 
+            n_threads = sparsetools.get_num_threads()
+            if n_threads != 1:
+                # sort and sum duplicates in one multithreaded pass
+                sparsetools.coo_tocsc_canonical(M, N, self.nnz, \
+                        self.row, self.col, self.data, \
+                        indptr, indices, data, n_threads)
+                A = csc_matrix((data, indices, indptr), shape=self.shape)
+                A.has_sorted_indices = True
+                return A
+
             coo_tocsr(N, M, self.nnz, \
                       self.col, self.row, self.data, \
                       indptr, indices, data)
@@ -284,10 +303,20 @@ class coo_matrix(_data_matrix):
             return csr_matrix(self.shape, dtype=self.dtype)
         else:
             M,N = self.shape
-            indptr  = np.empty(M + 1,    dtype=np.intc)
-            indices = np.empty(self.nnz, dtype=np.intc)
+            indptr  = np.empty(M + 1,    dtype=self.row.dtype)
+            indices = np.empty(self.nnz, dtype=self.row.dtype)
             data    = np.empty(self.nnz, dtype=upcast(self.dtype))
 
+            n_threads = sparsetools.get_num_threads()
+            if n_threads != 1:
+                # sort and sum duplicates in one multithreaded pass
+                sparsetools.coo_tocsr_canonical(M, N, self.nnz, \
+                        self.row, self.col, self.data, \
+                        indptr, indices, data, n_threads)
+                A = csr_matrix((data, indices, indptr), shape=self.shape)
+                A.has_sorted_indices = True
+                return A
+
             coo_tocsr(M, N, self.nnz, \
                       self.row, self.col, self.data, \
                       indptr, indices, data)
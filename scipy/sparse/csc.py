@@ -8,6 +8,7 @@ from warnings import warn
 
 import numpy as np
 
+import sparsetools
 from sparsetools import csc_tocsr
 from sputils import upcast, isintlike
 
@@ -99,13 +100,19 @@ class csc_matrix(_cs_matrix):
 
     def tocsr(self):
         M,N = self.shape
-        indptr  = np.empty(M + 1,    dtype=np.intc)
-        indices = np.empty(self.nnz, dtype=np.intc)
+        indptr  = np.empty(M + 1,    dtype=self.indptr.dtype)
+        indices = np.empty(self.nnz, dtype=self.indptr.dtype)
         data    = np.empty(self.nnz, dtype=upcast(self.dtype))
 
-        csc_tocsr(M, N, \
-                 self.indptr, self.indices, self.data, \
-                 indptr, indices, data)
+        n_threads = sparsetools.get_num_threads()
+        if n_threads != 1:
+            sparsetools.csc_tocsr_threads(M, N,
+                    self.indptr, self.indices, self.data,
+                    indptr, indices, data, n_threads)
+        else:
+            csc_tocsr(M, N, \
+                     self.indptr, self.indices, self.data, \
+                     indptr, indices, data)
 
         from csr import csr_matrix
         A = csr_matrix((data, indices, indptr), shape=self.shape)
@@ -126,8 +133,9 @@ class csc_matrix(_cs_matrix):
                 if isintlike(col) or isinstance(col,slice):
                     return self.T[col,row].T
                 else:
-                    row = np.asarray(row, dtype=np.intc)
-                    col = np.asarray(col, dtype=np.intc)
+                    # boolean masks are converted by csr_matrix
+                    row = np.asarray(row)
+                    col = np.asarray(col)
                     if len(row.shape) == 1:
                         return self.T[col,row]
                     elif len(row.shape) == 2:
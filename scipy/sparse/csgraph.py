@@ -2,10 +2,14 @@
 
 __docformat__ = "restructuredtext en"
 
-__all__ = ['cs_graph_components']
+__all__ = ['cs_graph_components', 'cs_graph_connected_components',
+           'cs_graph_breadth_first_order', 'cs_graph_depth_first_order',
+           'cs_graph_shortest_path', 'cs_graph_reverse_cuthill_mckee',
+           'cs_graph_nested_dissection']
 
 import numpy as np
 
+import sparsetools
 from sparsetools import cs_graph_components as _cs_graph_components
 
 from csr import csr_matrix
@@ -13,6 +17,34 @@ from base import isspmatrix
 
 _msg0 = 'x must be a symmetric square matrix!'
 _msg1 = _msg0 + '(has shape %s)'
+_msg2 = 'x must be a square matrix (has shape %s)'
+
+def _graph_tocsr(x):
+    """Return the adjacency matrix x of a graph as a CSR matrix"""
+    if not (isspmatrix(x) or hasattr(x, 'shape')):
+        x = np.asarray(x)
+    if not ((len(x.shape) == 2) and (x.shape[0] == x.shape[1])):
+        raise ValueError(_msg2 % (x.shape,))
+
+    if isspmatrix(x):
+        return x.tocsr()
+    else:
+        return csr_matrix(x)
+
+def _graph_pattern(x, symmetric_mode):
+    """Return the structure of x + x.T as a CSR matrix"""
+    x = _graph_tocsr(x)
+    if symmetric_mode:
+        return x
+    x = csr_matrix((np.ones(len(x.indices), dtype=x.indices.dtype),
+                    x.indices, x.indptr), shape=x.shape)
+    return x + x.T.tocsr()
+
+def _check_node(x, i_start):
+    n = x.shape[0]
+    if not (-n <= i_start < n):
+        raise ValueError('i_start must be a node of the graph')
+    return int(i_start) % n
 
 def cs_graph_components(x):
     """
@@ -77,4 +109,296 @@ def cs_graph_components(x):
 
     return n_comp, label
 
+def cs_graph_connected_components(x, connection='weak'):
+    """
+    Connected components of a directed or undirected graph, in time
+    linear in the number of nodes and edges.
+
+    Parameters
+    -----------
+    x: ndarray-like, 2 dimensions, or sparse matrix
+        The adjacency matrix of the graph: every stored entry `(i, j)`,
+        including explicit zeros, is an edge from node `i` to node `j`.
+    connection: 'weak' or 'strong'
+        With 'weak' edge directions are ignored. With 'strong' two nodes
+        are in the same component if each can be reached from the other.
+
+    Returns
+    --------
+    n_comp: int
+        The number of connected components.
+    labels: ndarray (ints, 1 dimension):
+        The component of each node, from 0 to n_comp - 1. Isolated
+        nodes form components of their own.
+
+    Notes
+    ------
+    Weak components are found with union-find, using several threads
+    when sparsetools.set_num_threads allows it, and are numbered in the
+    order of their first node. Strong components are found with Tarjan's
+    algorithm; an edge between two strong components always goes from
+    the higher label to the lower one.
+
+    Examples
+    --------
+    >>> from scipy.sparse import cs_graph_connected_components
+    >>> import numpy as np
+    >>> D = np.zeros((4,4))
+    >>> D[0,1] = D[1,2] = D[2,1] = 1
+    >>> cs_graph_connected_components(D)
+    (2, array([0, 0, 0, 1]))
+    >>> cs_graph_connected_components(D, connection='strong')
+    (3, array([1, 0, 0, 2]))
+
+    """
+    x = _graph_tocsr(x)
+    n = x.shape[0]
+    labels = np.empty(n, dtype=x.indptr.dtype)
+
+    if connection == 'weak':
+        n_comp = sparsetools.cs_graph_connected_components(n, x.indptr,
+                            x.indices, labels, sparsetools.get_num_threads())
+    elif connection == 'strong':
+        n_comp = sparsetools.cs_graph_strong_components(n, x.indptr,
+                                                        x.indices, labels)
+    else:
+        raise ValueError("connection must be 'weak' or 'strong'")
+
+    return n_comp, labels
+
+def cs_graph_breadth_first_order(x, i_start):
+    """
+    Breadth-first traversal of a graph from node i_start.
 
+    Parameters
+    -----------
+    x: ndarray-like, 2 dimensions, or sparse matrix
+        The adjacency matrix of the graph: every stored entry `(i, j)`
+        is an edge from node `i` to node `j`.
+    i_start: int
+        The first node.
+
+    Returns
+    --------
+    order: ndarray (ints, 1 dimension):
+        The nodes reachable from i_start, in the order they are reached.
+        Neighbours are visited in increasing order if x has sorted
+        indices.
+    predecessors: ndarray (ints, 1 dimension):
+        The node from which each node was reached, -1 for i_start and
+        for the nodes that are not reachable.  This describes a tree of
+        shortest paths (counting edges) from i_start.
+
+    Examples
+    --------
+    >>> from scipy.sparse import cs_graph_breadth_first_order
+    >>> import numpy as np
+    >>> D = np.array([[0,1,1,0],[0,0,0,1],[0,0,0,0],[0,0,0,0]])
+    >>> cs_graph_breadth_first_order(D, 0)
+    (array([0, 1, 2, 3]), array([-1,  0,  0,  1]))
+
+    """
+    x = _graph_tocsr(x)
+    n = x.shape[0]
+    i_start = _check_node(x, i_start)
+
+    order = np.empty(n, dtype=x.indptr.dtype)
+    predecessors = np.empty(n, dtype=x.indptr.dtype)
+    levels = np.empty(n, dtype=x.indptr.dtype)
+    n_reached = sparsetools.cs_graph_breadth_first(n, x.indptr, x.indices,
+                                   i_start, order, predecessors, levels)
+
+    return order[:n_reached], predecessors
+
+def cs_graph_depth_first_order(x, i_start):
+    """
+    Depth-first traversal of a graph from node i_start.
+
+    Parameters
+    -----------
+    x: ndarray-like, 2 dimensions, or sparse matrix
+        The adjacency matrix of the graph: every stored entry `(i, j)`
+        is an edge from node `i` to node `j`.
+    i_start: int
+        The first node.
+
+    Returns
+    --------
+    order: ndarray (ints, 1 dimension):
+        The nodes reachable from i_start in preorder, as visited by the
+        recursive algorithm.  Neighbours are visited in increasing order
+        if x has sorted indices.
+    predecessors: ndarray (ints, 1 dimension):
+        The node from which each node was reached, -1 for i_start and
+        for the nodes that are not reachable.
+
+    Notes
+    ------
+    The traversal uses an explicit stack, so it also works on graphs
+    with very long paths.
+
+    Examples
+    --------
+    >>> from scipy.sparse import cs_graph_depth_first_order
+    >>> import numpy as np
+    >>> D = np.array([[0,1,1,0],[0,0,0,1],[0,0,0,0],[0,0,0,0]])
+    >>> cs_graph_depth_first_order(D, 0)
+    (array([0, 1, 3, 2]), array([-1,  0,  0,  1]))
+
+    """
+    x = _graph_tocsr(x)
+    n = x.shape[0]
+    i_start = _check_node(x, i_start)
+
+    order = np.empty(n, dtype=x.indptr.dtype)
+    predecessors = np.empty(n, dtype=x.indptr.dtype)
+    n_reached = sparsetools.cs_graph_depth_first(n, x.indptr, x.indices,
+                                                 i_start, order, predecessors)
+
+    return order[:n_reached], predecessors
+
+def cs_graph_shortest_path(x, i_start, unweighted=False):
+    """
+    Shortest paths from node i_start to all other nodes of a graph.
+
+    Parameters
+    -----------
+    x: ndarray-like, 2 dimensions, or sparse matrix
+        The adjacency matrix of the graph: every stored entry `(i, j)` is
+        an edge from node `i` to node `j` whose length is the value of
+        the entry.  Lengths must not be negative.
+    i_start: int
+        The source node.
+    unweighted: bool
+        If True every edge has length 1 and the values of x are ignored.
+
+    Returns
+    --------
+    dist: ndarray (floats, 1 dimension):
+        The length of the shortest path from i_start to each node,
+        inf for the nodes that are not reachable.
+    predecessors: ndarray (ints, 1 dimension):
+        The previous node on the shortest path to each node, -1 for
+        i_start and for the nodes that are not reachable.
+
+    Notes
+    ------
+    Uses Dijkstra's algorithm with a binary heap, in
+    O((N + nnz) log(nnz)) time, or a breadth-first search in linear time
+    if unweighted is True.  Explicit zeros are edges of length 0.
+
+    Examples
+    --------
+    >>> from scipy.sparse import cs_graph_shortest_path
+    >>> import numpy as np
+    >>> D = np.array([[0,4,1,0],[0,0,0,1],[0,2,0,0],[0,0,0,0]])
+    >>> cs_graph_shortest_path(D, 0)
+    (array([ 0.,  3.,  1.,  4.]), array([-1,  2,  0,  1]))
+
+    """
+    x = _graph_tocsr(x)
+    n = x.shape[0]
+    i_start = _check_node(x, i_start)
+
+    predecessors = np.empty(n, dtype=x.indptr.dtype)
+
+    if unweighted:
+        order = np.empty(n, dtype=x.indptr.dtype)
+        levels = np.empty(n, dtype=x.indptr.dtype)
+        sparsetools.cs_graph_breadth_first(n, x.indptr, x.indices, i_start,
+                                           order, predecessors, levels)
+        dist = levels.astype(np.float64)
+        dist[levels < 0] = np.inf
+        return dist, predecessors
+
+    if np.iscomplexobj(x.data):
+        raise ValueError('edge lengths must be real')
+    weights = np.asarray(x.data, dtype=np.float64)
+    if len(weights) > 0 and weights.min() < 0:
+        raise ValueError('edge lengths must not be negative')
+
+    dist = np.empty(n, dtype=np.float64)
+    dist.fill(np.inf)
+    sparsetools.cs_graph_dijkstra(n, x.indptr, x.indices, weights, i_start,
+                                  dist, predecessors)
+
+    return dist, predecessors
+
+def cs_graph_reverse_cuthill_mckee(x, symmetric_mode=False):
+    """
+    Reverse Cuthill-McKee ordering of the nodes of a graph.
+
+    Parameters
+    -----------
+    x: ndarray-like, 2 dimensions, or sparse matrix
+        The adjacency matrix of the graph. Only its sparsity structure
+        is used.
+    symmetric_mode: bool
+        If True, x is assumed to have a symmetric structure, otherwise
+        the structure of x + x.T is used.
+
+    Returns
+    --------
+    perm: ndarray (ints, 1 dimension):
+        The node placed at each position.  ``x.symmetric_permute(perm)``
+        has a small bandwidth, which improves the memory locality of
+        matrix-vector products and the fill of banded factorisations.
+
+    Notes
+    ------
+    Each connected component is ordered by a breadth-first search from
+    a pseudo-peripheral node that visits neighbours by increasing
+    degree, and the resulting order is reversed.
+
+    Examples
+    --------
+    >>> from scipy.sparse import csr_matrix, cs_graph_reverse_cuthill_mckee
+    >>> A = csr_matrix([[1,0,0,1],[0,1,1,0],[0,1,1,1],[1,0,1,1]])
+    >>> perm = cs_graph_reverse_cuthill_mckee(A)
+    >>> perm
+    array([0, 3, 2, 1])
+    >>> A.symmetric_permute(perm).todense()
+    matrix([[1, 1, 0, 0],
+            [1, 1, 1, 0],
+            [0, 1, 1, 1],
+            [0, 0, 1, 1]])
+
+    """
+    x = _graph_pattern(x, symmetric_mode)
+    perm = np.empty(x.shape[0], dtype=x.indptr.dtype)
+    sparsetools.cs_graph_reverse_cuthill_mckee(x.shape[0], x.indptr,
+                                               x.indices, perm)
+    return perm
+
+def cs_graph_nested_dissection(x, symmetric_mode=False):
+    """
+    Nested dissection ordering of the nodes of a graph.
+
+    Parameters
+    -----------
+    x: ndarray-like, 2 dimensions, or sparse matrix
+        The adjacency matrix of the graph. Only its sparsity structure
+        is used.
+    symmetric_mode: bool
+        If True, x is assumed to have a symmetric structure, otherwise
+        the structure of x + x.T is used.
+
+    Returns
+    --------
+    perm: ndarray (ints, 1 dimension):
+        The node placed at each position.  Factorising
+        ``x.symmetric_permute(perm)`` produces less fill than factorising
+        x in its original order, in particular for meshes.
+
+    Notes
+    ------
+    The graph is split recursively by the middle level of a breadth-first
+    level structure.  Each separator is ordered after the two parts it
+    separates.  Parts of at most 32 nodes are not split further.
+
+    """
+    x = _graph_pattern(x, symmetric_mode)
+    perm = np.empty(x.shape[0], dtype=x.indptr.dtype)
+    sparsetools.cs_graph_nested_dissection(x.shape[0], x.indptr,
+                                           x.indices, perm)
+    return perm
@@ -9,8 +9,10 @@ from warnings import warn
 
 import numpy as np
 
+import sparsetools
 from sparsetools import csr_tocsc, csr_tobsr, csr_count_blocks, \
-        get_csr_submatrix, csr_sample_values
+        get_csr_submatrix, csr_sample_values_threads, csr_row_index, \
+        csr_column_index
 from sputils import upcast, isintlike
 
 
@@ -110,13 +112,19 @@ class csr_matrix(_cs_matrix):
             return self
 
     def tocsc(self):
-        indptr  = np.empty(self.shape[1] + 1, dtype=np.intc)
-        indices = np.empty(self.nnz, dtype=np.intc)
+        indptr  = np.empty(self.shape[1] + 1, dtype=self.indptr.dtype)
+        indices = np.empty(self.nnz, dtype=self.indptr.dtype)
         data    = np.empty(self.nnz, dtype=upcast(self.dtype))
 
-        csr_tocsc(self.shape[0], self.shape[1], \
-                  self.indptr, self.indices, self.data, \
-                  indptr, indices, data)
+        n_threads = sparsetools.get_num_threads()
+        if n_threads != 1:
+            sparsetools.csr_tocsc_threads(self.shape[0], self.shape[1],
+                    self.indptr, self.indices, self.data,
+                    indptr, indices, data, n_threads)
+        else:
+            csr_tocsc(self.shape[0], self.shape[1], \
+                      self.indptr, self.indices, self.data, \
+                      indptr, indices, data)
 
         from csc import csc_matrix
         A = csc_matrix((data, indices, indptr), shape=self.shape)
@@ -143,8 +151,8 @@ class csr_matrix(_cs_matrix):
 
             blks = csr_count_blocks(M,N,R,C,self.indptr,self.indices)
 
-            indptr  = np.empty(M//R + 1,    dtype=np.intc)
-            indices = np.empty(blks,       dtype=np.intc)
+            indptr  = np.empty(M//R + 1,    dtype=self.indptr.dtype)
+            indices = np.empty(blks,       dtype=self.indptr.dtype)
             data    = np.zeros((blks,R,C), dtype=self.dtype)
 
             csr_tobsr(M, N, R, C, self.indptr, self.indices, self.data, \
@@ -161,14 +169,27 @@ class csr_matrix(_cs_matrix):
 
 
     def __getitem__(self, key):
-        def asindices(x):
+        def asindices(x, N):
+            try:
+                x = np.asarray(x)
+            except:
+                raise IndexError('invalid index')
+            if x.dtype == np.bool_:
+                # boolean mask of the N rows or columns
+                if x.shape != (N,):
+                    raise IndexError('boolean index has shape %s, expected (%d,)'
+                                     % (x.shape, N))
+                x = x.nonzero()[0]
             try:
-                x = np.asarray(x, dtype=np.intc)
+                x = np.asarray(x, dtype=self.indices.dtype)
             except:
                 raise IndexError('invalid index')
             else:
                 return x
         def check_bounds(indices,N):
+            if indices.size == 0:
+                return (0,0)
+
             max_indx = indices.max()
             if max_indx >= N:
                 raise IndexError('index (%d) out of range' % max_indx)
@@ -179,11 +200,9 @@ class csr_matrix(_cs_matrix):
 
             return (min_indx,max_indx)
 
-        def extractor(indices,N):
-            """Return a sparse matrix P so that P*self implements
-            slicing of the form self[[1,2,3],:]
-            """
-            indices = asindices(indices)
+        def normalize(indices,N):
+            """Return indices as an array of nonnegative indices"""
+            indices = asindices(indices,N).ravel()
 
             (min_indx,max_indx) = check_bounds(indices,N)
 
@@ -191,11 +210,25 @@ class csr_matrix(_cs_matrix):
                 indices = indices.copy()
                 indices[indices < 0] += N
 
-            indptr  = np.arange(len(indices) + 1, dtype=np.intc)
-            data    = np.ones(len(indices), dtype=self.dtype)
-            shape   = (len(indices),N)
+            return indices
+
+        def row_index(A,rows):
+            """Return A[rows,:] for a CSR matrix A"""
+            M,N = A.shape
+            rows = normalize(rows,M).astype(A.indices.dtype)
+            indptr, indices, data = csr_row_index(M, N, A.indptr,
+                    A.indices, A.data, len(rows), rows,
+                    sparsetools.get_num_threads())
+            return csr_matrix((data,indices,indptr), shape=(len(rows),N))
 
-            return csr_matrix((data,indices,indptr), shape=shape)
+        def column_index(A,cols):
+            """Return A[:,cols] for a CSR matrix A"""
+            M,N = A.shape
+            cols = normalize(cols,N).astype(A.indices.dtype)
+            indptr, indices, data = csr_column_index(M, N, A.indptr,
+                    A.indices, A.data, len(cols), cols,
+                    sparsetools.get_num_threads())
+            return csr_matrix((data,indices,indptr), shape=(M,len(cols)))
 
 
         if isinstance(key, tuple):
@@ -209,26 +242,23 @@ class csr_matrix(_cs_matrix):
                 elif isinstance(col, slice):
                     return self._get_row_slice(row, col)      #[i,1:2]
                 else:
-                    P = extractor(col,self.shape[1]).T        #[i,[1,2]]
-                    return self[row,:]*P
+                    return column_index(self[row,:], col)     #[i,[1,2]]
 
             elif isinstance(row, slice):
                 #[1:2,??]
                 if isintlike(col) or isinstance(col, slice):
                     return self._get_submatrix(row, col)      #[1:2,j]
                 else:
-                    P = extractor(col,self.shape[1]).T        #[1:2,[1,2]]
-                    return self[row,:]*P
+                    return column_index(self[row,:], col)     #[1:2,[1,2]]
 
             else:
                 #[[1,2],??] or [[[1],[2]],??]
                 if isintlike(col) or isinstance(col,slice):
-                    P = extractor(row, self.shape[0])        #[[1,2],j] or [[1,2],1:2]
-                    return (P*self)[:,col]
+                    return row_index(self, row)[:,col]        #[[1,2],j] or [[1,2],1:2]
 
                 else:
-                    row = asindices(row)
-                    col = asindices(col)
+                    row = asindices(row, self.shape[0])
+                    col = asindices(col, self.shape[1])
                     if len(row.shape) == 1:
                         if len(row) != len(col):             #[[1,2],[1,2]]
                             raise IndexError('number of row and column indices differ')
@@ -238,18 +268,15 @@ class csr_matrix(_cs_matrix):
 
                         num_samples = len(row)
                         val = np.empty(num_samples, dtype=self.dtype)
-                        csr_sample_values(self.shape[0], self.shape[1],
-                                          self.indptr, self.indices, self.data,
-                                          num_samples, row, col, val)
-                        #val = []
-                        #for i,j in zip(row,col):
-                        #    val.append(self._get_single_element(i,j))
+                        csr_sample_values_threads(self.shape[0], self.shape[1],
+                                self.indptr, self.indices, self.data,
+                                num_samples, row, col, val,
+                                int(self.has_sorted_indices),
+                                sparsetools.get_num_threads())
                         return np.asmatrix(val)
 
                     elif len(row.shape) == 2:
-                        row = np.ravel(row)                   #[[[1],[2]],[1,2]]
-                        P = extractor(row, self.shape[0])
-                        return (P*self)[:,col]
+                        return column_index(row_index(self, row), col) #[[[1],[2]],[1,2]]
 
                     else:
                         raise NotImplementedError('unsupported indexing')
@@ -257,7 +284,7 @@ class csr_matrix(_cs_matrix):
         elif isintlike(key) or isinstance(key,slice):
             return self[key,:]                                #[i] or [1:2]
         else:
-            return self[asindices(key),:]                     #[[1,2]]
+            return self[asindices(key, self.shape[0]),:]      #[[1,2]]
 
 
     def _get_single_element(self,row,col):
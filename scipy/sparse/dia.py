@@ -8,8 +8,8 @@ import numpy as np
 
 from base import isspmatrix, _formats
 from data import _data_matrix
-from sputils import isshape, upcast, getdtype
-from sparsetools import dia_matvec
+from sputils import isshape, upcast, getdtype, get_index_dtype
+import sparsetools
 
 class dia_matrix(_data_matrix):
     """Sparse matrix with DIAgonal storage
@@ -73,7 +73,8 @@ class dia_matrix(_data_matrix):
                 # create empty matrix
                 self.shape   = arg1   #spmatrix checks for errors here
                 self.data    = np.zeros( (0,0), getdtype(dtype, default=float))
-                self.offsets = np.zeros( (0), dtype=np.intc)
+                idx_dtype    = get_index_dtype(maxval=max(self.shape))
+                self.offsets = np.zeros( (0), dtype=idx_dtype)
             else:
                 try:
                     # Try interpreting it as (data, offsets)
@@ -83,8 +84,9 @@ class dia_matrix(_data_matrix):
                 else:
                     if shape is None:
                         raise ValueError('expected a shape argument')
+                    idx_dtype    = get_index_dtype(maxval=max(shape))
                     self.data    = np.atleast_2d(np.array(arg1[0], dtype=dtype, copy=copy))
-                    self.offsets = np.atleast_1d(np.array(arg1[1], dtype=np.intc, copy=copy))
+                    self.offsets = np.atleast_1d(np.array(arg1[1], dtype=idx_dtype, copy=copy))
                     self.shape   = shape
         else:
             #must be dense, convert to COO first, then to DIA
@@ -151,12 +153,34 @@ class dia_matrix(_data_matrix):
 
         M,N = self.shape
 
-        dia_matvec(M,N, len(self.offsets), L, self.offsets, self.data, x.ravel(), y.ravel())
+        n_threads = sparsetools.get_num_threads()
+        if n_threads != 1:
+            sparsetools.dia_matvec_threads(M, N, len(self.offsets), L,
+                    self.offsets, self.data, x.ravel(), y.ravel(), n_threads)
+        else:
+            sparsetools.dia_matvec(M, N, len(self.offsets), L,
+                    self.offsets, self.data, x.ravel(), y.ravel())
 
         return y
 
-    def _mul_multimatrix(self, other):
-        return np.hstack( [ self._mul_vector(col).reshape(-1,1) for col in other.T ] )
+    def _mul_multivector(self, other):
+        M,N = self.shape
+        n_vecs = other.shape[1] #number of column vectors
+
+        result = np.zeros( (M,n_vecs), dtype=upcast(self.dtype,other.dtype) )
+
+        L = self.data.shape[1]
+
+        n_threads = sparsetools.get_num_threads()
+        if n_threads != 1:
+            sparsetools.dia_matvecs_threads(M, N, n_vecs, len(self.offsets),
+                    L, self.offsets, self.data, other.ravel(), result.ravel(),
+                    n_threads)
+        else:
+            sparsetools.dia_matvecs(M, N, n_vecs, len(self.offsets), L,
+                    self.offsets, self.data, other.ravel(), result.ravel())
+
+        return result
 
     def todia(self,copy=False):
         if copy:
@@ -0,0 +1,196 @@
+"""Lazy evaluation of element-wise sparse matrix expressions"""
+
+__docformat__ = "restructuredtext en"
+
+__all__ = ['csr_expression']
+
+import numpy as np
+
+from base import isspmatrix
+from sputils import upcast, isscalarlike, get_index_dtype
+import sparsetools
+
+class csr_expression(object):
+    """Lazy linear combination of sparse matrices
+
+    Sums of sparse matrices and their scalar multiples, optionally
+    multiplied element-wise by one more sparse matrix, are collected
+    without computing anything.  tocsr() then evaluates the whole
+    expression in compiled code with one merge pass per row and a single
+    allocation of the result, whereas evaluating ``A + 2*B - C`` with
+    sparse matrices creates a new matrix for every operator.
+
+    This can be instantiated in several ways:
+        csr_expression(S)
+            with a sparse matrix S
+
+        csr_expression(E)
+            with another expression E (a copy is made)
+
+    Expressions combine with sparse matrices, other expressions and
+    scalars through +, -, unary -, multiplication and division by a
+    scalar, and multiply() for the element-wise product.  Write scalar
+    multiples as ``2*csr_expression(B)`` rather than ``2*B``, which
+    would compute a scaled copy of B first.
+
+    Notes
+    -----
+    Operands in other formats are converted to CSR, and operands without
+    sorted indices are sorted in a copy.  The result is in canonical
+    format and holds no explicit zeros.
+
+    Examples
+    --------
+    >>> from scipy.sparse import csr_matrix, csr_expression
+    >>> from numpy import array
+    >>> A = csr_matrix(array([[1,0],[0,2]]))
+    >>> B = csr_matrix(array([[0,3],[4,0]]))
+    >>> C = csr_matrix(array([[1,1],[0,1]]))
+    >>> E = (csr_expression(A) + 2*csr_expression(B)).multiply(C)
+    >>> E.tocsr().todense()
+    matrix([[1, 6],
+            [0, 2]])
+
+    """
+
+    def __init__(self, arg1):
+        if isinstance(arg1, csr_expression):
+            self.shape = arg1.shape
+            self._terms = list(arg1._terms)
+            self._mask  = arg1._mask
+        elif isspmatrix(arg1):
+            self.shape = arg1.shape
+            self._terms = [(1, arg1)]
+            self._mask  = None
+        else:
+            raise ValueError('expected a sparse matrix or an expression')
+
+    def _linear_terms(self):
+        """list of (coefficient, matrix) pairs whose sum is self"""
+        if self._mask is None:
+            return self._terms
+        else:
+            # a product cannot be merged with further terms
+            return [(1, self.tocsr())]
+
+    def _combine(self, other, sign):
+        if isinstance(other, csr_expression) or isspmatrix(other):
+            if other.shape != self.shape:
+                raise ValueError('inconsistent shapes')
+            if isspmatrix(other):
+                other = csr_expression(other)
+            result = csr_expression(self)
+            result._terms = self._linear_terms() + \
+                    [(sign * c, A) for c, A in other._linear_terms()]
+            result._mask  = None
+            return result
+        elif isscalarlike(other) and other == 0:
+            return csr_expression(self)
+        else:
+            raise NotImplementedError('adding a nonzero scalar to a ' \
+                    'sparse expression is not supported')
+
+    def __add__(self, other):
+        return self._combine(other, 1)
+
+    __radd__ = __add__
+
+    def __sub__(self, other):
+        return self._combine(other, -1)
+
+    def __rsub__(self, other):  # other - self
+        return (-self)._combine(other, 1)
+
+    def __neg__(self):
+        return self * -1
+
+    def __mul__(self, other):
+        if not isscalarlike(other):
+            raise NotImplementedError('use multiply() for element-wise ' \
+                    'products of sparse expressions')
+        result = csr_expression(self)
+        result._terms = [(c * other, A) for c, A in self._linear_terms()]
+        result._mask  = None
+        return result
+
+    __rmul__ = __mul__
+
+    def __truediv__(self, other):
+        if not isscalarlike(other):
+            raise NotImplementedError('only division by a scalar is supported')
+        return self * (1.0 / other)
+
+    __div__ = __truediv__
+
+    def multiply(self, other):
+        """Element-wise product with a sparse matrix or expression"""
+        if isinstance(other, csr_expression):
+            other = other.tocsr()
+        if not isspmatrix(other):
+            raise ValueError('expected a sparse matrix or an expression')
+        if other.shape != self.shape:
+            raise ValueError('inconsistent shapes')
+
+        result = csr_expression(self)
+        result._terms = self._linear_terms()
+        result._mask  = other
+        return result
+
+    def tocsr(self):
+        """Evaluate the expression as a canonical CSR matrix"""
+        from csr import csr_matrix
+
+        M,N = self.shape
+        coefs = [c for c, A in self._terms]
+        mats  = [_sorted_csr(A) for c, A in self._terms]
+        mask  = self._mask
+        if mask is not None:
+            mask = _sorted_csr(mask)
+
+        # numpy's rules for scalar times array decide the result type
+        dtype = upcast(*[A.dtype for A in mats])
+        for c in coefs:
+            dtype = upcast(dtype, (np.zeros(1, dtype=dtype) * c).dtype)
+        if mask is not None:
+            dtype = upcast(dtype, mask.dtype)
+
+        nnz = [A.indptr[-1] for A in mats]
+        idx_dtype = get_index_dtype(maxval=max(M, N, sum(nnz)))
+
+        offsets = np.zeros(len(mats), dtype=idx_dtype)
+        offsets[1:] = np.cumsum(nnz)[:-1]
+        indptr  = np.concatenate([A.indptr for A in mats]).astype(idx_dtype)
+        indices = np.concatenate([A.indices[:n] for A, n in zip(mats, nnz)])
+        data    = np.concatenate([A.data[:n] for A, n in zip(mats, nnz)])
+        indices = indices.astype(idx_dtype)
+        data    = data.astype(dtype)
+        coefs   = np.array(coefs, dtype=dtype)
+
+        n_threads = sparsetools.get_num_threads()
+        if mask is None:
+            Cp, Cj, Cx = sparsetools.csr_linear_combination(M, N, len(mats),
+                    offsets, indptr, indices, data, coefs, n_threads)
+        else:
+            Cp, Cj, Cx = sparsetools.csr_linear_combination_elmul(M, N,
+                    len(mats), offsets, indptr, indices, data, coefs,
+                    mask.indptr.astype(idx_dtype),
+                    mask.indices.astype(idx_dtype),
+                    mask.data.astype(dtype), n_threads)
+
+        C = csr_matrix((Cx, Cj, Cp), shape=self.shape)
+        C.has_sorted_indices = True
+        return C
+
+    def __repr__(self):
+        return "<%dx%d lazy sparse expression with %d terms%s>" % \
+               (self.shape + (len(self._terms),
+                ' and an element-wise product' if self._mask is not None
+                else ''))
+
+
+def _sorted_csr(A):
+    """A in CSR format with sorted indices, without modifying A"""
+    A = A.tocsr()
+    if not A.has_sorted_indices:
+        A = A.sorted_indices()
+    return A
@@ -7,7 +7,7 @@ SciPy 2-D sparse matrix package.
 Original code by Travis Oliphant.
 Modified and extended by Ed Schofield, Robert Cimrman, and Nathan Bell.
 
-There are seven available sparse matrix types:
+There are eight available sparse matrix types:
     1. csc_matrix: Compressed Sparse Column format
     2. csr_matrix: Compressed Sparse Row format
     3. bsr_matrix: Block Sparse Row format
@@ -15,11 +15,17 @@ There are seven available sparse matrix types:
     5. dok_matrix: Dictionary of Keys format
     6. coo_matrix: COOrdinate format (aka IJV, triplet format)
     7. dia_matrix: DIAgonal format
+    8. sell_matrix: Sliced ELLpack format (for fast matrix-vector products)
 
 To construct a matrix efficiently, use either lil_matrix (recommended) or
 dok_matrix. The lil_matrix class supports basic slicing and fancy
 indexing with a similar syntax to NumPy arrays.  As illustrated below,
 the COO format may also be used to efficiently construct matrices.
+For assembling large matrices from many batches of (i, j, v) values
+that are summed together, e.g. in finite element codes, use
+csr_builder, which adds values into a CSR matrix in compiled code.
+Sums of several sparse matrices are best written with csr_expression,
+which evaluates them in one pass without intermediate matrices.
 
 To perform manipulations such as multiplication or inversion, first
 convert the matrix to either CSC or CSR format. The lil_matrix format is
@@ -103,6 +109,7 @@ Modules
    :toctree: generated/
 
    base - Base class for sparse matrices
+   builder - Incremental assembly of sparse matrices
    bsr - Compressed Block Sparse Row matrix format
    compressed - Sparse matrix base class using compressed storage
    construct - Functions to construct sparse matrices
@@ -115,6 +122,7 @@ Modules
    dok - Dictionary Of Keys based matrix
    extract - Functions to extract parts of sparse matrices
    lil - LInked List sparse matrix class
+   sell - Sliced ELLpack sparse matrix format
    linalg -
    sparsetools - A collection of routines for sparse matrix operations
    spfuncs - Functions that operate on sparse matrices
@@ -130,11 +138,14 @@ Classes
    SparseWarning -
    bsr_matrix - Block Sparse Row matrix
    coo_matrix - A sparse matrix in COOrdinate format
+   csr_builder - Incremental assembly of a CSR matrix
+   csr_expression - Lazy linear combination of sparse matrices
    csc_matrix - Compressed Sparse Column matrix
    csr_matrix - Compressed Sparse Row matrix
    dia_matrix - Sparse matrix with DIAgonal storage
    dok_matrix - Dictionary Of Keys based sparse matrix
    lil_matrix - Row-based linked list sparse matrix
+   sell_matrix - Sparse matrix with Sliced ELLpack storage
 
 Functions
 ---------
@@ -143,7 +154,13 @@ Functions
    :toctree: generated/
 
    bmat - Build a sparse matrix from sparse sub-blocks
+   cs_graph_breadth_first_order - Breadth-first traversal of a graph
    cs_graph_components -
+   cs_graph_connected_components - Weak or strong components of a graph
+   cs_graph_depth_first_order - Depth-first traversal of a graph
+   cs_graph_nested_dissection - Fill-reducing ordering of a graph
+   cs_graph_reverse_cuthill_mckee - Bandwidth-reducing ordering of a graph
+   cs_graph_shortest_path - Shortest paths from one node of a graph
    eye - Sparse MxN matrix whose k-th diagonal is all ones
    find -
    hstack - Stack sparse matrices horizontally (column wise)
@@ -10,7 +10,8 @@ from bisect import bisect_left
 import numpy as np
 
 from base import spmatrix, isspmatrix
-from sputils import getdtype, isshape, issequence, isscalarlike
+from sputils import getdtype, isshape, issequence, isscalarlike, \
+        get_index_dtype
 
 class lil_matrix(spmatrix):
     """Row-based linked list sparse matrix
@@ -424,15 +425,17 @@ class lil_matrix(spmatrix):
         """ Return Compressed Sparse Row format arrays for this matrix.
         """
 
-        indptr = np.asarray([len(x) for x in self.rows], dtype=np.intc)
-        indptr = np.concatenate( (np.array([0], dtype=np.intc), np.cumsum(indptr)) )
+        lengths = [len(x) for x in self.rows]
+        nnz = sum(lengths)
+        idx_dtype = get_index_dtype(maxval=max(self.shape + (nnz,)))
 
-        nnz = indptr[-1]
+        indptr = np.asarray(lengths, dtype=idx_dtype)
+        indptr = np.concatenate( (np.array([0], dtype=idx_dtype), np.cumsum(indptr)) )
 
         indices = []
         for x in self.rows:
             indices.extend(x)
-        indices = np.asarray(indices, dtype=np.intc)
+        indices = np.asarray(indices, dtype=idx_dtype)
 
         data = []
         for x in self.data:
@@ -58,6 +58,7 @@ from info import __doc__
 #del umfpack
 
 from linsolve import *
+from triangular import *
 
 __all__ = filter(lambda s:not s.startswith('_'),dir())
 from numpy.testing import Tester
@@ -0,0 +1,85 @@
+import numpy as np
+from numpy import array, tril, triu, eye, dot
+from numpy.linalg import LinAlgError
+from numpy.testing import TestCase, run_module_suite, assert_equal, \
+        assert_array_almost_equal, assert_raises
+
+from scipy.sparse import csr_matrix, csc_matrix, rand, sparsetools
+from scipy.sparse.linalg.dsolve import TriangularSolver, spsolve_triangular
+
+
+class TestTriangularSolve(TestCase):
+    def setUp(self):
+        np.random.seed(1234)
+        n = 200
+        A = rand(n, n, density=0.05, format='csr') + 4*eye(n)
+        self.A = csr_matrix(A)
+        self.D = self.A.todense().A
+        self.b = np.random.rand(n)
+        self.B = np.random.rand(n, 3)
+
+    def _expected(self, lower, unit_diagonal, trans, b):
+        T = tril(self.D, -1) if lower else triu(self.D, 1)
+        if unit_diagonal:
+            T = T + eye(len(T))
+        else:
+            T = T + np.diag(np.diag(self.D))
+        if trans:
+            T = T.T
+        return np.linalg.solve(T, b)
+
+    def test_solve(self):
+        for fmt in ['csr', 'csc']:
+            A = self.A.asformat(fmt)
+            for lower in [True, False]:
+                for unit_diagonal in [True, False]:
+                    solver = TriangularSolver(A, lower, unit_diagonal)
+                    for trans in [False, True]:
+                        for b in [self.b, self.B]:
+                            x = solver.solve(b, trans)
+                            assert_equal(x.shape, b.shape)
+                            assert_array_almost_equal(x,
+                                self._expected(lower, unit_diagonal, trans, b))
+
+    def test_threads(self):
+        A = self.A
+        for lower in [True, False]:
+            expected = spsolve_triangular(A, self.B, lower=lower)
+            expectedT = spsolve_triangular(A.tocsc(), self.b, lower=lower,
+                                           trans=True)
+            old = sparsetools.set_num_threads(3)
+            try:
+                solver = TriangularSolver(A, lower=lower)
+                assert_equal(solver.solve(self.B), expected)
+                assert_array_almost_equal(solver.solve(self.b, trans=True),
+                                          expectedT)
+                assert_equal(solver.solve(self.B), expected)
+            finally:
+                sparsetools.set_num_threads(old)
+
+    def test_dtypes(self):
+        L = csr_matrix(array([[2,0,0],[1,1,0],[0,3,4]]))
+        x = spsolve_triangular(L, [2,3,10])
+        assert_equal(x.dtype, np.float64)
+        assert_array_almost_equal(x, [1,2,1])
+
+        x = spsolve_triangular(L.astype(np.float32),
+                               array([2,3,10], dtype=np.float32))
+        assert_equal(x.dtype, np.float32)
+        assert_array_almost_equal(x, [1,2,1])
+
+        x = spsolve_triangular(L.astype(complex), [2,3,10j])
+        assert_equal(x.dtype, np.complex128)
+        assert_array_almost_equal(dot(tril(L.todense().A), x), [2,3,10j])
+
+    def test_singular(self):
+        A = csr_matrix(array([[1.,0,0],[1,0,0],[1,1,1]]))
+        assert_raises(LinAlgError, spsolve_triangular, A, [1,2,3])
+        x = spsolve_triangular(A, [1,2,3], unit_diagonal=True)
+        assert_array_almost_equal(x, [1,1,1])
+        assert_raises(ValueError, spsolve_triangular, A, [1,2])
+        assert_raises(ValueError, TriangularSolver, A[:2,:])
+
+
+if __name__ == "__main__":
+    run_module_suite()
@@ -0,0 +1,152 @@
+"""Sparse triangular solves
+"""
+
+__docformat__ = "restructuredtext en"
+
+__all__ = [ 'TriangularSolver', 'spsolve_triangular' ]
+
+from warnings import warn
+
+import numpy as np
+from numpy.linalg import LinAlgError
+
+from scipy.sparse import isspmatrix_csc, isspmatrix_csr, csr_matrix, \
+        SparseEfficiencyWarning
+from scipy.sparse import sparsetools
+from scipy.sparse.sputils import upcast
+
+
+class TriangularSolver(object):
+    """Repeated solves with a sparse triangular matrix
+
+    Parameters
+    ----------
+    A : sparse matrix
+        Square matrix in CSR or CSC format.  Only the lower (or upper)
+        triangle of A is used, so the two factors of an incomplete LU
+        factorization may be stored in one matrix.
+    lower : bool
+        Use the lower triangle of A (default) or the upper triangle.
+    unit_diagonal : bool
+        Take the diagonal of A to be one, ignoring stored diagonal
+        entries.
+
+    Notes
+    -----
+    With more than one sparsetools thread (see
+    sparsetools.set_num_threads) the rows are solved in parallel, one
+    level set at a time.  The level sets, and for solves with A.T the
+    transpose of A, are computed on first use and kept for later solves,
+    so A must not be modified while the solver is in use.  With one
+    thread the solves run directly on A.
+
+    Examples
+    --------
+    >>> from scipy.sparse import csr_matrix
+    >>> from scipy.sparse.linalg import TriangularSolver
+    >>> L = csr_matrix([[2., 0., 0.], [1., 1., 0.], [0., 3., 4.]])
+    >>> solver = TriangularSolver(L, lower=True)
+    >>> solver.solve([2., 3., 10.])
+    array([ 1.,  2.,  1.])
+
+    """
+
+    def __init__(self, A, lower=True, unit_diagonal=False):
+        if not (isspmatrix_csc(A) or isspmatrix_csr(A)):
+            A = csr_matrix(A)
+            warn('TriangularSolver requires CSC or CSR matrix format',
+                 SparseEfficiencyWarning)
+
+        M, N = A.shape
+        if (M != N):
+            raise ValueError("matrix must be square (has shape %s)" % ((M, N),))
+
+        self.A = A
+        self.shape = A.shape
+        self.dtype = A.dtype
+        self.lower = bool(lower)
+        self.unit_diagonal = bool(unit_diagonal)
+        self._levels = {}
+
+    def _level_sets(self, trans):
+        """CSR matrix, triangle and level sets for solves with A or A.T"""
+        if trans not in self._levels:
+            A = (self.A.T if trans else self.A).tocsr()
+            lower = self.lower != trans
+            Bp, Bj = sparsetools.csr_triangular_levels(A.shape[0],
+                    A.indptr, A.indices, int(lower))
+            self._levels[trans] = (A, lower, Bp, Bj)
+        return self._levels[trans]
+
+    def solve(self, b, trans=False):
+        """Solve A*x = b, or A.T*x = b if trans is True
+
+        b is a vector or a 2-D array with one right-hand side per column.
+        """
+        b = np.asarray(b)
+        N = self.shape[0]
+        if b.ndim not in (1, 2) or b.shape[0] != N:
+            raise ValueError("matrix - rhs size mismatch (%s - %s)"
+                  % (self.shape, b.shape))
+        n_vecs = 1 if b.ndim == 1 else b.shape[1]
+
+        dtype = upcast(self.dtype, b.dtype, np.float32)
+        x = np.array(b, dtype=dtype, order='C')   # solved in place
+
+        n_threads = sparsetools.get_num_threads()
+        if n_threads == 1:
+            A = self.A
+            fn = getattr(sparsetools, A.format + '_triangular_solve')
+            info = fn(N, n_vecs, A.indptr, A.indices, _data(A, dtype),
+                      int(self.lower), int(self.unit_diagonal), int(trans),
+                      x.ravel())
+        else:
+            A, lower, Bp, Bj = self._level_sets(bool(trans))
+            info = sparsetools.csr_triangular_solve_levels(N, n_vecs,
+                    A.indptr, A.indices, _data(A, dtype), int(lower),
+                    int(self.unit_diagonal), len(Bp) - 1, Bp, Bj, x.ravel(),
+                    n_threads)
+
+        if info >= 0:
+            raise LinAlgError('matrix is singular: diagonal entry %d is '
+                              'zero or missing' % info)
+        return x
+
+
+def _data(A, dtype):
+    """A.data as an array of the given dtype, without a copy if possible"""
+    if A.dtype == dtype:
+        return A.data
+    else:
+        return A.data.astype(dtype)
+
+
+def spsolve_triangular(A, b, lower=True, unit_diagonal=False, trans=False):
+    """Solve A*x = b, or A.T*x = b, for a sparse triangular matrix A
+
+    Parameters
+    ----------
+    A : sparse matrix
+        Square matrix in CSR or CSC format.  Only the lower (or upper)
+        triangle of A is used.
+    b : array
+        Right-hand side, a vector or a 2-D array with one right-hand side
+        per column.
+    lower : bool
+        Use the lower triangle of A (default) or the upper triangle.
+    unit_diagonal : bool
+        Take the diagonal of A to be one.
+    trans : bool
+        Solve with A.T (not conjugated) instead of A.
+
+    Returns
+    -------
+    x : array
+        Solution, with the shape of b.
+
+    See Also
+    --------
+    TriangularSolver : keeps the analysis of A for repeated solves
+
+    """
+    return TriangularSolver(A, lower, unit_diagonal).solve(b, trans)
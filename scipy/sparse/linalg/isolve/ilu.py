@@ -0,0 +1,186 @@
+"""Incomplete factorization preconditioners"""
+
+__docformat__ = "restructuredtext en"
+
+__all__ = ['ilu0', 'ilut', 'ic0', 'IncompleteFactor']
+
+from warnings import warn
+
+import numpy as np
+from numpy.linalg import LinAlgError
+
+from scipy.sparse import isspmatrix_csr, csr_matrix, tril, \
+        SparseEfficiencyWarning
+from scipy.sparse import sparsetools
+from scipy.sparse.linalg.interface import LinearOperator
+from scipy.sparse.linalg.dsolve import TriangularSolver
+
+
+class IncompleteFactor(LinearOperator):
+    """Preconditioner given by an incomplete factorization of A
+
+    Applying the operator, e.g. with M.matvec(b) or M*b, solves
+    L*U*x = b, or L*L.T*x = b for a Cholesky factor.  This makes it
+    suitable as the M argument of the iterative solvers in
+    scipy.sparse.linalg.
+
+    Parameters
+    ----------
+    factor : csr_matrix
+        L and U in one matrix, where the strictly lower part holds L,
+        whose unit diagonal is not stored, and the rest holds U.  For a
+        Cholesky factorization, the lower triangular L.
+    cholesky : bool
+        Whether factor holds a Cholesky factor.
+
+    Notes
+    -----
+    Use ilu0, ilut or ic0 to compute the factorization.  The triangular
+    solves run in compiled code, in parallel when sparsetools uses more
+    than one thread (see TriangularSolver).
+
+    """
+
+    def __init__(self, factor, cholesky=False):
+        self.factor   = factor
+        self.cholesky = cholesky
+        self._L = TriangularSolver(factor, lower=True,
+                                   unit_diagonal=not cholesky)
+        if not cholesky:
+            self._U = TriangularSolver(factor, lower=False)
+
+        LinearOperator.__init__(self, factor.shape, matvec=self.solve,
+                                rmatvec=self.rsolve, matmat=self.solve,
+                                dtype=factor.dtype)
+
+    def solve(self, b):
+        """Solve L*U*x = b (or L*L.T*x = b) for x"""
+        if self.cholesky:
+            return self._L.solve(self._L.solve(b), trans=True)
+        else:
+            return self._U.solve(self._L.solve(b))
+
+    def rsolve(self, b):
+        """Solve (L*U).T*x = b for x"""
+        if self.cholesky:
+            return self.solve(b)
+        else:
+            return self._L.solve(self._U.solve(b, trans=True), trans=True)
+
+    def __repr__(self):
+        M,N = self.shape
+        kind = 'Cholesky' if self.cholesky else 'LU'
+        return '<%dx%d incomplete %s factor with %d stored elements>' % \
+               (M, N, kind, self.factor.nnz)
+
+
+def _canonical_csr(A, name):
+    """A copy of A as a real floating point CSR matrix in canonical format"""
+    if not isspmatrix_csr(A):
+        warn('%s requires CSR matrix format' % name, SparseEfficiencyWarning)
+    A = csr_matrix(A, copy=True).asfptype()
+    if A.dtype.char not in 'fdg':
+        raise TypeError('%s does not support %s matrices' % (name, A.dtype.name))
+    M,N = A.shape
+    if M != N:
+        raise ValueError('matrix must be square (has shape %s)' % ((M, N),))
+    A.sum_duplicates()
+    return A
+
+
+def _check_pivot(info, name):
+    if info >= 0:
+        raise LinAlgError('%s failed: zero pivot in row %d' % (name, info))
+
+
+def ilu0(A):
+    """Incomplete LU factorization with no fill-in, ILU(0)
+
+    L and U have the sparsity pattern of A: updates of entries outside
+    of it are dropped.
+
+    Parameters
+    ----------
+    A : sparse matrix
+        Square matrix, preferably in CSR format.
+
+    Returns
+    -------
+    M : IncompleteFactor
+        Preconditioner applying (L*U)^-1.
+
+    Examples
+    --------
+    >>> from scipy.sparse.linalg import cg, ilu0
+    >>> M = ilu0(A)                         #doctest: +SKIP
+    >>> x, info = cg(A, b, M=M)             #doctest: +SKIP
+
+    """
+    A = _canonical_csr(A, 'ilu0')
+    info = sparsetools.csr_ilu0(A.shape[0], A.indptr, A.indices, A.data)
+    _check_pivot(info, 'ilu0')
+    return IncompleteFactor(A)
+
+
+def ilut(A, drop_tol=1e-4, fill_factor=10):
+    """Incomplete LU factorization with threshold dropping, ILUT
+
+    Parameters
+    ----------
+    A : sparse matrix
+        Square matrix, preferably in CSR format.
+    drop_tol : float
+        Entries smaller than drop_tol times the norm of their row of A
+        (divided by the number of entries in the row) are dropped.
+    fill_factor : float
+        Each row of L and of U keeps at most fill_factor times the
+        average number of entries per row of A.
+
+    Returns
+    -------
+    M : IncompleteFactor
+        Preconditioner applying (L*U)^-1.
+
+    Notes
+    -----
+    This is ILUT(p, tau) from Y. Saad, "Iterative Methods for Sparse
+    Linear Systems", without pivoting.  drop_tol=0 and a large
+    fill_factor give the complete LU factorization.
+
+    """
+    A = _canonical_csr(A, 'ilut')
+    n = A.shape[0]
+    fill = int(np.ceil(fill_factor * A.nnz / float(max(n, 1))))
+
+    info, indptr, indices, data = sparsetools.csr_ilut(n, A.indptr,
+            A.indices, A.data, float(drop_tol), min(fill, n))
+    _check_pivot(info, 'ilut')
+    F = csr_matrix((data, indices, indptr), shape=A.shape)
+    F.has_sorted_indices = True
+    return IncompleteFactor(F)
+
+
+def ic0(A):
+    """Incomplete Cholesky factorization with no fill-in, IC(0)
+
+    Computes L with the sparsity pattern of the lower triangle of A such
+    that L*L.T matches A on that pattern.
+
+    Parameters
+    ----------
+    A : sparse matrix
+        Symmetric positive definite matrix, preferably in CSR format.
+        Only its lower triangle is read.
+
+    Returns
+    -------
+    M : IncompleteFactor
+        Preconditioner applying (L*L.T)^-1.
+
+    """
+    A = _canonical_csr(A, 'ic0')
+    L = tril(A, format='csr')
+    L.sort_indices()
+    info = sparsetools.csr_ic0(L.shape[0], L.indptr, L.indices, L.data)
+    _check_pivot(info, 'ic0')
+    return IncompleteFactor(L, cholesky=True)
@@ -0,0 +1,177 @@
+"""Krylov solvers running in compiled code"""
+
+__docformat__ = "restructuredtext en"
+
+__all__ = ['native_solve']
+
+import numpy as np
+
+from scipy.sparse import sparsetools
+from scipy.sparse.sputils import upcast
+from ilu import IncompleteFactor
+
+_methods = {'cg' : 0, 'bicgstab' : 1, 'gmres' : 2}
+_formats = {'csr' : 0, 'csc' : 1, 'bsr' : 2, 'dia' : 3}
+
+# number of scalars at the start of the work array (see krylov.h)
+_header = 8
+
+
+def _work_size(method, n, restart):
+    if method == 'cg':
+        return _header + 4*n
+    elif method == 'bicgstab':
+        return _header + 7*n
+    else:
+        return _header + (restart + 4)*n + (restart + 1)*restart + 4*restart + 1
+
+
+def native_solve(A, b, method='cg', x0=None, tol=1e-5, maxiter=None, M=None,
+                 callback=None, callback_interval=1, restart=20):
+    """Solve A x = b with a Krylov method running in compiled code
+
+    Unlike cg, bicgstab and gmres, which return to Python for every
+    product with A and every preconditioner solve, the whole iteration
+    runs in sparsetools.  This removes the Python overhead per
+    iteration, which dominates for small and medium systems.
+
+    Parameters
+    ----------
+    A : sparse matrix
+        The N-by-N matrix of the linear system, in CSR, CSC, BSR or DIA
+        format, with a real dtype.
+    b : {array, matrix}
+        Right hand side of the linear system. Has shape (N,) or (N,1).
+    method : {'cg', 'bicgstab', 'gmres'}
+        Conjugate gradients (A must be symmetric positive definite),
+        BiCGSTAB, or GMRES restarted every `restart` iterations.
+
+    Returns
+    -------
+    x : {array, matrix}
+        The converged solution.
+    info : integer
+        Provides convergence information:
+            0  : successful exit
+            >0 : convergence to tolerance not achieved, number of iterations
+            <0 : breakdown
+
+    Other Parameters
+    ----------------
+    x0  : {array, matrix}
+        Starting guess for the solution.
+    tol : float
+        Tolerance to achieve.  The algorithm terminates when the norm of
+        the residual b - A x is at most tol times the norm of b.
+    maxiter : integer
+        Maximum number of iterations (default 10*N).
+    M : IncompleteFactor
+        Preconditioner computed by ilu0, ilut or ic0 (ic0 or no
+        preconditioner for method='cg').
+    callback : function
+        User-supplied function called as callback(xk) every
+        `callback_interval` iterations and at the end, where xk is the
+        current solution vector.
+    callback_interval : integer
+        Number of iterations run in compiled code between callbacks.
+    restart : integer
+        Number of iterations between GMRES restarts.
+
+    Examples
+    --------
+    >>> from scipy.sparse.linalg import native_solve, ilu0
+    >>> x, info = native_solve(A, b, 'gmres', M=ilu0(A))     #doctest: +SKIP
+
+    """
+    if method not in _methods:
+        raise ValueError('unknown method %r' % (method,))
+
+    format = getattr(A, 'format', None)
+    if format not in _formats:
+        raise TypeError('native_solve requires CSR, CSC, BSR or DIA matrix format')
+    if M is not None and not isinstance(M, IncompleteFactor):
+        raise TypeError('M must be None or an incomplete factorization '
+                        '(see ilu0, ilut and ic0)')
+
+    N = A.shape[0]
+    if A.shape != (N, N):
+        raise ValueError('expected square matrix, but got shape=%s' % (A.shape,))
+
+    b_ = b
+    b = np.asarray(b)
+    if not (b.shape == (N,1) or b.shape == (N,)):
+        raise ValueError('A and b have incompatible dimensions')
+
+    types = [A.dtype, b.dtype, np.float32]
+    if M is not None:
+        types.append(M.dtype)
+    dtype = np.dtype(upcast(*types))
+    if dtype.char not in 'fdg':
+        raise TypeError('native_solve does not support %s matrices' % dtype.name)
+
+    if format == 'dia':
+        Ap = A.offsets
+        Aj = np.empty(0, dtype=Ap.dtype)
+        R, C = A.data.shape
+    else:
+        Ap, Aj = A.indptr, A.indices
+        R, C = A.blocksize if format == 'bsr' else (1, 1)
+    idx = Ap.dtype
+    Ax = np.ascontiguousarray(A.data, dtype=dtype).ravel()
+
+    if M is None:
+        precond = 0
+        Bp = Bj = np.empty(0, dtype=idx)
+        Bx = np.empty(0, dtype=dtype)
+    else:
+        F = M.factor
+        precond = 2 if M.cholesky else 1
+        Bp = np.asarray(F.indptr, dtype=idx)
+        Bj = np.asarray(F.indices, dtype=idx)
+        Bx = np.asarray(F.data, dtype=dtype)
+
+    b = np.ascontiguousarray(b, dtype=dtype).ravel()
+    if x0 is None:
+        x = np.zeros(N, dtype=dtype)
+    else:
+        x = np.array(x0, dtype=dtype).ravel()
+        if x.shape != (N,):
+            raise ValueError('A and x have incompatible dimensions')
+
+    if maxiter is None:
+        maxiter = N*10
+    restart = max(min(restart, N), 1)
+    if callback is None:
+        callback_interval = maxiter
+    callback_interval = max(int(callback_interval), 1)
+
+    bnrm2 = np.sqrt(np.dot(b, b))
+    if bnrm2 == 0:
+        bnrm2 = 1.0
+    atol = float(tol * bnrm2)
+
+    work = np.zeros(_work_size(method, N, restart), dtype=dtype)
+    iter_ = 0
+    while True:
+        n_iter = sparsetools.krylov_solve(_methods[method], restart,
+                _formats[format], N, R, C, Ap, Aj, Ax, precond, Bp, Bj, Bx,
+                b, x, work, atol, min(callback_interval, maxiter - iter_))
+        if n_iter < 0:
+            info = -1
+            break
+        iter_ += n_iter
+
+        if callback is not None:
+            callback(x)
+        if work[0] <= atol:
+            info = 0
+            break
+        if iter_ >= maxiter:
+            # not converged; maxiter=0 does no iterations but must not
+            # report success
+            info = max(iter_, 1)
+            break
+
+    if isinstance(b_, np.matrix):
+        x = np.asmatrix(x)
+    return x.reshape(np.shape(b_)), info
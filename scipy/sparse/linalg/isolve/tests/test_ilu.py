@@ -0,0 +1,142 @@
+""" Test functions for the incomplete factorization preconditioners
+"""
+
+import numpy as np
+from numpy import array, eye, tril, triu, dot
+from numpy.linalg import LinAlgError
+from numpy.testing import TestCase, run_module_suite, assert_equal, \
+        assert_array_almost_equal, assert_raises, assert_
+
+from scipy.sparse import csr_matrix, spdiags, rand, kronsum
+from scipy.sparse.linalg.isolve import cg, gmres, ilu0, ilut, ic0
+
+
+def poisson2d(n):
+    data = np.ones((3,n))
+    data[0,:] =  2
+    data[1,:] = -1
+    data[2,:] = -1
+    P = spdiags(data, [0,-1,1], n, n, format='csr')
+    return kronsum(P, P, format='csr')
+
+
+def iterations(solver, A, b, M=None):
+    count = [0]
+    def callback(x):
+        count[0] += 1
+    x, info = solver(A, b, M=M, callback=callback, tol=1e-8)
+    assert_equal(info, 0)
+    return count[0]
+
+
+def lu_factors(M):
+    F = M.factor.todense().A
+    return tril(F, -1) + eye(len(F)), triu(F)
+
+
+class TestILU0(TestCase):
+    def setUp(self):
+        np.random.seed(1234)
+        n = 50
+        self.A = csr_matrix(rand(n, n, density=0.1) + 4*eye(n))
+
+    def test_pattern(self):
+        A = self.A
+        L, U = lu_factors(ilu0(A))
+        D = A.todense().A
+        mask = D != 0
+        assert_array_almost_equal(dot(L, U)[mask], D[mask])
+        assert_equal(ilu0(A).factor.nnz, A.nnz)
+
+    def test_complete(self):
+        # no fill-in for a tridiagonal matrix
+        A = csr_matrix(spdiags([[4,4,4,4],[1,2,3,4],[1,1,1,1]], [0,-1,1], 4, 4))
+        M = ilu0(A)
+        b = array([1.,2,3,4])
+        assert_array_almost_equal(A * M.matvec(b), b)
+        assert_array_almost_equal(A.T * M.rmatvec(b), b)
+
+    def test_preconditioner(self):
+        A = poisson2d(20)
+        b = np.ones(A.shape[0])
+        M = ilu0(A)
+        assert_(iterations(gmres, A, b, M) < iterations(gmres, A, b))
+        x, info = gmres(A, b, M=M, tol=1e-10)
+        assert_array_almost_equal(A * x, b)
+
+    def test_errors(self):
+        A = csr_matrix(array([[0.,1],[1,0]]))
+        assert_raises(LinAlgError, ilu0, A)
+        assert_raises(ValueError, ilu0, csr_matrix((2,3)))
+        assert_raises(TypeError, ilu0, self.A.astype(complex))
+
+
+class TestILUT(TestCase):
+    def setUp(self):
+        np.random.seed(1234)
+        n = 50
+        self.A = csr_matrix(rand(n, n, density=0.1) + 4*eye(n))
+
+    def test_exact(self):
+        A = self.A
+        L, U = lu_factors(ilut(A, drop_tol=0, fill_factor=1000))
+        assert_array_almost_equal(dot(L, U), A.todense().A)
+
+    def test_fill(self):
+        A = self.A
+        n = A.shape[0]
+        fill = int(np.ceil(2.0 * A.nnz / n))
+        F = ilut(A, drop_tol=0, fill_factor=2).factor
+        assert_(F.has_sorted_indices)
+        for i in range(n):
+            row = F.indices[F.indptr[i]:F.indptr[i+1]]
+            assert_(np.sum(row < i) <= fill)
+            assert_(np.sum(row > i) <= fill)
+            assert_(i in row)
+
+        F2 = ilut(A, drop_tol=1e-1).factor
+        assert_(F2.nnz < ilut(A, drop_tol=0).factor.nnz)
+
+    def test_preconditioner(self):
+        A = poisson2d(20)
+        b = np.ones(A.shape[0])
+        assert_(iterations(gmres, A, b, ilut(A)) <
+                iterations(gmres, A, b, ilu0(A)))
+
+    def test_dtypes(self):
+        for dtype in [np.float32, np.float64, np.int32]:
+            # the int32 cast rounds the off-diagonal entries to zero
+            A = self.A.astype(dtype)
+            M = ilut(A, drop_tol=0, fill_factor=1000)
+            assert_equal(M.dtype.char, 'f' if dtype == np.float32 else 'd')
+            b = np.ones(A.shape[0])
+            assert_array_almost_equal(A * M.matvec(b), b, decimal=4)
+
+
+class TestIC0(TestCase):
+    def test_pattern(self):
+        A = poisson2d(10)
+        M = ic0(A)
+        L = M.factor.todense().A
+        D = A.todense().A
+        mask = tril(D) != 0
+        assert_array_almost_equal(dot(L, L.T)[mask], D[mask])
+        assert_(np.all(triu(L, 1) == 0))
+
+    def test_preconditioner(self):
+        A = poisson2d(20)
+        b = np.ones(A.shape[0])
+        M = ic0(A)
+        assert_(iterations(cg, A, b, M) < iterations(cg, A, b))
+        b2 = np.arange(A.shape[0], dtype=float)
+        assert_array_almost_equal(M.matvec(b2), M.rmatvec(b2))
+
+    def test_errors(self):
+        A = csr_matrix(array([[1.,2],[2,1]]))
+        assert_raises(LinAlgError, ic0, A)
+        A = csr_matrix(array([[1.,0],[1,0]]))
+        assert_raises(LinAlgError, ic0, A)
+
+
+if __name__ == "__main__":
+    run_module_suite()
@@ -0,0 +1,133 @@
+""" Test functions for the compiled Krylov solvers
+"""
+
+import numpy as np
+from numpy.testing import TestCase, run_module_suite, assert_equal, \
+        assert_array_equal, assert_array_almost_equal, assert_raises, assert_
+
+from scipy.sparse import csr_matrix, spdiags, kronsum, identity
+from scipy.sparse.linalg.interface import LinearOperator
+from scipy.sparse.linalg.isolve import native_solve, ilu0, ilut, ic0, \
+        IncompleteFactor
+
+
+def poisson2d(n, convection=0.0):
+    data = np.ones((3,n))
+    data[0,:] =  2
+    data[1,:] = -1 - convection
+    data[2,:] = -1 + convection
+    P = spdiags(data, [0,-1,1], n, n, format='csr')
+    return kronsum(P, P, format='csr')
+
+
+class TestNativeSolve(TestCase):
+    def setUp(self):
+        self.S = poisson2d(12)
+        self.U = poisson2d(12, convection=0.4)
+        self.b = np.sin(np.arange(1, self.S.shape[0] + 1))
+
+    def check(self, A, method, M=None, **kw):
+        b = self.b
+        x, info = native_solve(A, b, method, tol=1e-10, M=M, **kw)
+        assert_equal(info, 0)
+        assert_(np.linalg.norm(b - A*x) <= 1e-10 * np.linalg.norm(b))
+        return x
+
+    def test_methods(self):
+        for fmt in ['csr', 'csc', 'bsr', 'dia']:
+            self.check(self.S.asformat(fmt), 'cg')
+            self.check(self.S.asformat(fmt), 'cg', M=ic0(self.S))
+            for method in ['bicgstab', 'gmres']:
+                A = self.U.asformat(fmt)
+                self.check(A, method)
+                self.check(A, method, M=ilu0(self.U))
+                self.check(A, method, M=ilut(self.U))
+            self.check(self.U.asformat(fmt), 'gmres', restart=5)
+
+    def test_formats(self):
+        # the iterates do not depend on the format of A
+        expected = self.check(self.U, 'gmres')
+        for fmt in ['csc', 'bsr', 'dia']:
+            assert_array_almost_equal(self.check(self.U.asformat(fmt), 'gmres'),
+                                      expected, decimal=12)
+
+    def test_callback(self):
+        A, b = self.U, self.b
+        for method in ['bicgstab', 'gmres']:
+            x, info = native_solve(A, b, method, tol=1e-10)
+            for interval in [1, 3, 7]:
+                xs = []
+                def callback(xk):
+                    xs.append(xk.copy())
+                x2, info2 = native_solve(A, b, method, tol=1e-10,
+                                         callback=callback,
+                                         callback_interval=interval)
+                # chunked solves give the same iterates
+                assert_array_equal(x2, x)
+                assert_array_equal(xs[-1], x)
+                assert_(len(xs) > 1)
+
+    def test_preconditioner(self):
+        A, b = self.S, self.b
+        counts = []
+        for M in [None, ic0(A)]:
+            its = [0]
+            def callback(xk):
+                its[0] += 1
+            native_solve(A, b, 'cg', tol=1e-10, M=M, callback=callback)
+            counts.append(its[0])
+        assert_(counts[1] < counts[0])
+
+    def test_maxiter(self):
+        A, b = self.U, self.b
+        x, info = native_solve(A, b, 'gmres', tol=1e-10, maxiter=5)
+        assert_equal(info, 5)
+        x, info = native_solve(A, b, 'gmres', x0=x, tol=1e-10)
+        assert_equal(info, 0)
+        for method in ['cg', 'bicgstab', 'gmres']:
+            x, info = native_solve(A, b, method, tol=1e-10, maxiter=0)
+            assert_(info > 0)
+
+    def test_singular_preconditioner(self):
+        A, b = self.S, self.b
+        D = A.diagonal()
+        D[3] = 0
+        F = csr_matrix(spdiags(D, 0, len(D), len(D)))
+        for cholesky in [False, True]:
+            M = IncompleteFactor(F, cholesky=cholesky)
+            for method in ['cg', 'bicgstab', 'gmres']:
+                x, info = native_solve(A, b, method, M=M)
+                assert_(info < 0)
+
+    def test_shapes_and_dtypes(self):
+        A = self.S
+        b = np.matrix(self.b).T
+        x, info = native_solve(A, b, 'cg')
+        assert_(isinstance(x, np.matrix))
+        assert_equal(x.shape, b.shape)
+
+        x, info = native_solve(A.astype(np.float32), self.b.astype(np.float32),
+                               'cg', tol=1e-4)
+        assert_equal(info, 0)
+        assert_equal(x.dtype, np.float32)
+
+        x, info = native_solve(A.astype(np.int32), self.b, 'cg')
+        assert_equal(x.dtype, np.float64)
+
+        x, info = native_solve(identity(4, format='csr'), np.zeros(4), 'cg')
+        assert_equal(info, 0)
+        assert_array_equal(x, np.zeros(4))
+
+    def test_errors(self):
+        A, b = self.S, self.b
+        assert_raises(ValueError, native_solve, A, b, 'qmr')
+        assert_raises(TypeError, native_solve, A.tocoo(), b)
+        assert_raises(TypeError, native_solve, A.astype(complex), b)
+        L = LinearOperator(A.shape, lambda x: x)
+        assert_raises(TypeError, native_solve, A, b, M=L)
+        assert_raises(ValueError, native_solve, A, b[:-1])
+        assert_raises(ValueError, native_solve, A[:-1,:], b[:-1])
+
+
+if __name__ == "__main__":
+    run_module_suite()
@@ -0,0 +1,293 @@
+"""Sparse Sliced ELLpack format"""
+
+__docformat__ = "restructuredtext en"
+
+__all__ = ['sell_matrix', 'isspmatrix_sell']
+
+import numpy as np
+
+from base import isspmatrix, _formats
+from data import _data_matrix
+from sputils import isshape, upcast, getdtype, get_index_dtype
+from sparsetools import csr_tosell, sell_matvec, sell_matvecs
+
+class sell_matrix(_data_matrix):
+    """Sparse matrix with Sliced ELLpack (SELL-C-sigma) storage
+
+    Rows are sorted by length within windows of sigma rows and then cut
+    into slices of slice_height rows.  Each slice is padded to its
+    longest row and stored column by column, which keeps the padding
+    small for irregular matrices and makes matrix-vector products
+    vectorisable.
+
+    This can be instantiated in several ways:
+        sell_matrix(D, slice_height=8, sigma=256)
+            with a dense matrix
+
+        sell_matrix(S, slice_height=8, sigma=256)
+            with another sparse matrix S (equivalent to S.tosell())
+
+        sell_matrix((M, N), [dtype])
+            to construct an empty matrix with shape (M, N),
+            dtype is optional, defaulting to dtype='d'.
+
+        sell_matrix((data, indices, slice_ptr, perm, row_lengths),
+                    shape=(M, N), slice_height=8)
+            where the entries of stored row k = s*slice_height + r are
+            ``data[slice_ptr[s] + j*slice_height + r]`` for
+            ``j < row_lengths[k]``, and ``perm[k]`` is their row
+
+    Notes
+    -----
+    The format is intended for matrix-vector products, for instance
+    through scipy.sparse.linalg.aslinearoperator.  Other operations
+    convert to CSR first.
+
+    Slice heights of 4, 8, 16 and 32 use unrolled kernels.  sigma = 1
+    keeps the original row order.  The sigma the rows were sorted with is
+    kept as the sigma attribute (None for a matrix built from arrays), and
+    asking for another slice height or sigma sorts the rows again.
+
+    Examples
+    --------
+
+    >>> from scipy.sparse import *
+    >>> from scipy import *
+    >>> A = sell_matrix(array([[1,0,0],[0,2,3],[4,5,6]]), slice_height=2)
+    >>> A * array([1,1,1])
+    array([ 1,  5, 15])
+
+    """
+
+    def __init__(self, arg1, shape=None, dtype=None, copy=False,
+                 slice_height=None, sigma=None):
+        _data_matrix.__init__(self)
+        self.format = 'sell'
+
+        if slice_height is None:
+            if isspmatrix_sell(arg1):
+                slice_height = arg1.slice_height
+            else:
+                slice_height = 8
+        if slice_height < 1:
+            raise ValueError('slice_height must be positive')
+
+        if isspmatrix_sell(arg1) and slice_height == arg1.slice_height \
+                and sigma in (None, arg1.sigma):
+            if copy:
+                arg1 = arg1.copy()
+            self._set_self(arg1)
+        elif isspmatrix(arg1):
+            self._from_csr(arg1.tocsr(), slice_height, sigma)
+        elif isinstance(arg1, tuple):
+            if isshape(arg1):
+                # It's a tuple of matrix dimensions (M, N)
+                # create empty matrix
+                self.shape = arg1   #spmatrix checks for errors here
+                self.slice_height = slice_height
+                self.sigma = sigma
+                M, N = self.shape
+                n_slice = (M + slice_height - 1) // slice_height
+                idx_dtype = get_index_dtype(maxval=max(M,N))
+                self.data        = np.zeros(0, getdtype(dtype, default=float))
+                self.indices     = np.zeros(0, dtype=idx_dtype)
+                self.slice_ptr   = np.zeros(n_slice + 1, dtype=idx_dtype)
+                self.perm        = np.arange(M, dtype=idx_dtype)
+                self.row_lengths = np.zeros(M, dtype=idx_dtype)
+            else:
+                try:
+                    data, indices, slice_ptr, perm, row_lengths = arg1
+                except:
+                    raise ValueError('unrecognized form for sell_matrix constructor')
+                else:
+                    if shape is None:
+                        raise ValueError('expected a shape argument')
+                    self.data        = np.array(data, dtype=dtype, copy=copy)
+                    self.indices     = np.array(indices, copy=copy)
+                    self.slice_ptr   = np.array(slice_ptr, copy=copy)
+                    self.perm        = np.array(perm, copy=copy)
+                    self.row_lengths = np.array(row_lengths, copy=copy)
+                    self.shape        = shape
+                    self.slice_height = slice_height
+                    self.sigma        = sigma
+        else:
+            #must be dense, convert to CSR first
+            try:
+                arg1 = np.asarray(arg1)
+            except:
+                raise ValueError("unrecognized form for" \
+                        " %s_matrix constructor" % self.format)
+            from coo import coo_matrix
+            self._from_csr(coo_matrix(arg1, dtype=dtype).tocsr(),
+                           slice_height, sigma)
+
+        if dtype is not None:
+            self.data = self.data.astype(dtype)
+
+        self.check_format()
+
+    def _set_self(self, other):
+        self.data         = other.data
+        self.indices      = other.indices
+        self.slice_ptr    = other.slice_ptr
+        self.perm         = other.perm
+        self.row_lengths  = other.row_lengths
+        self.shape        = other.shape
+        self.slice_height = other.slice_height
+        self.sigma        = other.sigma
+
+    def _from_csr(self, A, C, sigma):
+        if sigma is None:
+            sigma = 256
+        M,N = A.shape
+        lengths = np.diff(A.indptr)
+
+        # sort rows by decreasing length within windows of sigma rows
+        if sigma > 1:
+            window = np.arange(M) // sigma
+            perm = np.lexsort((-lengths, window))
+        else:
+            perm = np.arange(M)
+        row_lengths = lengths[perm]
+
+        n_slice = (M + C - 1) // C
+        padded = np.zeros(n_slice * C, dtype=lengths.dtype)
+        padded[:M] = row_lengths
+        widths = padded.reshape(n_slice, C).max(axis=1)
+
+        # the padding may push the slice pointer past the range of A.indptr
+        idx_dtype = get_index_dtype(maxval=max(M, N,
+                                        C * widths.sum(dtype=np.int64)))
+        perm        = perm.astype(idx_dtype)
+        row_lengths = row_lengths.astype(idx_dtype)
+        slice_ptr = np.zeros(n_slice + 1, dtype=idx_dtype)
+        np.cumsum(C * widths.astype(idx_dtype), out=slice_ptr[1:])
+
+        indices = np.empty(slice_ptr[-1], dtype=idx_dtype)
+        data    = np.empty(slice_ptr[-1], dtype=A.dtype)
+        csr_tosell(M, N, C, np.asarray(A.indptr, dtype=idx_dtype),
+                   np.asarray(A.indices, dtype=idx_dtype), A.data, perm,
+                   slice_ptr, indices, data)
+
+        self.data         = data
+        self.indices      = indices
+        self.slice_ptr    = slice_ptr
+        self.perm         = perm
+        self.row_lengths  = row_lengths
+        self.shape        = (M,N)
+        self.slice_height = C
+        self.sigma        = sigma
+
+    def check_format(self):
+        """check whether the matrix format is valid"""
+        M = self.shape[0]
+        n_slice = (M + self.slice_height - 1) // self.slice_height
+
+        # use 32-bit indices whenever the dimensions and storage allow
+        idx_dtype = get_index_dtype(maxval=max(self.shape +
+                                               (len(self.indices),)))
+        for name in ['indices', 'slice_ptr', 'perm', 'row_lengths']:
+            a = np.asarray(getattr(self, name), dtype=idx_dtype)
+            if a.ndim != 1:
+                raise ValueError('%s array must have rank 1' % name)
+            setattr(self, name, a)
+        if len(self.slice_ptr) != n_slice + 1:
+            raise ValueError('slice_ptr should have %d entries' % (n_slice + 1))
+        if len(self.perm) != M or len(self.row_lengths) != M:
+            raise ValueError('perm and row_lengths should have %d entries' % M)
+        if len(self.data) != self.slice_ptr[-1] or \
+                len(self.indices) != self.slice_ptr[-1]:
+            raise ValueError('data and indices should have %d entries' \
+                    % self.slice_ptr[-1])
+
+    def __repr__(self):
+        nnz = self.getnnz()
+        format = self.getformat()
+        return "<%dx%d sparse matrix of type '%s'\n" \
+               "\twith %d stored elements (slice height %d) in %s format>" % \
+               ( self.shape +  (self.dtype.type, nnz, self.slice_height, \
+                 _formats[format][1],) )
+
+    def getnnz(self):
+        """number of nonzero values
+
+        explicit zero values are included in this number, padding is not
+        """
+        return int(self.row_lengths.sum())
+
+    nnz = property(fget=getnnz)
+
+    def _mul_vector(self, other):
+        M,N = self.shape
+
+        y = np.zeros( M, dtype=upcast(self.dtype,other.dtype) )
+
+        sell_matvec(M, N, self.slice_height, self.slice_ptr, self.indices,
+                    self.data, self.perm, self.row_lengths, other, y)
+
+        return y
+
+    def _mul_multivector(self, other):
+        M,N = self.shape
+        n_vecs = other.shape[1] #number of column vectors
+
+        result = np.zeros( (M,n_vecs), dtype=upcast(self.dtype,other.dtype) )
+
+        sell_matvecs(M, N, n_vecs, self.slice_height, self.slice_ptr,
+                     self.indices, self.data, self.perm, self.row_lengths,
+                     other.ravel(), result.ravel())
+
+        return result
+
+    def tosell(self, slice_height=None, sigma=None, copy=False):
+        if (slice_height is None or slice_height == self.slice_height) \
+                and sigma in (None, self.sigma):
+            if copy:
+                return self.copy()
+            else:
+                return self
+        return sell_matrix(self, slice_height=slice_height, sigma=sigma)
+
+    def tocsr(self):
+        return self.tocoo().tocsr()
+
+    def tocsc(self):
+        return self.tocoo().tocsc()
+
+    def tocoo(self):
+        M,N = self.shape
+        C = self.slice_height
+
+        # position of every stored value within its slice
+        slice_sizes = np.diff(self.slice_ptr)
+        s = np.arange(len(slice_sizes)).repeat(slice_sizes)
+        offset = np.arange(len(self.data)) - self.slice_ptr[s]
+        k = C * s + offset % C
+
+        lengths = np.zeros(C * len(slice_sizes), dtype=self.row_lengths.dtype)
+        lengths[:M] = self.row_lengths
+        mask = (offset // C) < lengths[k]
+
+        row  = self.perm[k[mask]]
+        col  = self.indices[mask]
+        data = self.data[mask]
+
+        from coo import coo_matrix
+        return coo_matrix((data,(row,col)), shape=self.shape)
+
+    # needed by _data_matrix
+    def _with_data(self, data, copy=True):
+        """Returns a matrix with the same sparsity structure as self,
+        but with different data.  By default the structure arrays are copied.
+        """
+        arrays = (self.indices, self.slice_ptr, self.perm, self.row_lengths)
+        if copy:
+            arrays = tuple([a.copy() for a in arrays])
+        return sell_matrix((data,) + arrays, shape=self.shape,
+                           slice_height=self.slice_height, sigma=self.sigma)
+
+
+from sputils import _isinstance
+
+def isspmatrix_sell(x):
+    return _isinstance(x, sell_matrix)
@@ -8,3 +8,25 @@ from dia import *
 from bsr import *
 from csgraph import *
 
+
+_num_threads = 1
+
+def set_num_threads(n):
+    """Set the number of threads used by sparse matrix-vector and
+    matrix-matrix products.
+
+    n = 1 (the default) uses the serial kernels and n = 0 lets the
+    threaded kernels use every available processor.  Threads are only
+    used when sparsetools was built with OpenMP.  Returns the previous
+    value.
+    """
+    global _num_threads
+    n = int(n)
+    if n < 0:
+        raise ValueError('number of threads must be nonnegative')
+    old, _num_threads = _num_threads, n
+    return old
+
+def get_num_threads():
+    """Number of threads set by set_num_threads"""
+    return _num_threads
@@ -7,6 +7,7 @@
 
 #include "csr.h"
 #include "dense.h"
+#include "fixed_size.h"
 
 
 template <class I, class T>
@@ -249,21 +250,42 @@ void bsr_transpose(const I n_brow,
 
 
 
+/*
+ * Block products C += A*B for bsr_matmat_pass2, with A R-by-N and
+ * B N-by-C, for block sizes known at run time and at compile time
+ */
 template <class I, class T>
-void bsr_matmat_pass2(const I n_brow,  const I n_bcol, 
-                      const I R,       const I C,       const I N,
-      	              const I Ap[],    const I Aj[],    const T Ax[],
-      	              const I Bp[],    const I Bj[],    const T Bx[],
-      	                    I Cp[],          I Cj[],          T Cx[])
+class bsr_block_gemm
 {
-    assert(R > 0 && C > 0 && N > 0);
+    public:
+        bsr_block_gemm(const I R, const I C, const I N) : R(R), C(C), N(N) {}
+        inline void operator()(const T * A, const T * B, T * X) const
+        {
+            gemm(R, C, N, A, B, X);
+        }
+    private:
+        const I R, C, N;
+};
 
-    if( R == 1 && N == 1 && C == 1 ){
-        // Use CSR for 1x1 blocksize
-        csr_matmat_pass2(n_brow, n_bcol, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx);
-        return;
-    }
+template <class T, int R, int C, int N>
+class bsr_block_gemm_fixed
+{
+    public:
+        inline void operator()(const T * A, const T * B, T * X) const
+        {
+            matmat<R,N,C>(A, B, X);
+        }
+};
 
+
+template <class I, class T, class block_gemm>
+void bsr_matmat_pass2_blocks(const I n_brow,  const I n_bcol, 
+                             const I R,       const I C,       const I N,
+      	                     const I Ap[],    const I Aj[],    const T Ax[],
+      	                     const I Bp[],    const I Bj[],    const T Bx[],
+      	                           I Cp[],          I Cj[],          T Cx[],
+                             const block_gemm& mult)
+{
     const I RC = R*C;
     const I RN = R*N;
     const I NC = N*C;
@@ -302,7 +324,7 @@ void bsr_matmat_pass2(const I n_brow,  const I n_bcol,
                 const T * A = Ax + jj*RN;
                 const T * B = Bx + kk*NC;
 
-                gemm(R, C, N, A, B, mats[k]);
+                mult(A, B, mats[k]);
             }
         }         
 
@@ -316,6 +338,40 @@ void bsr_matmat_pass2(const I n_brow,  const I n_bcol,
 }
 
 
+template <class I, class T>
+void bsr_matmat_pass2(const I n_brow,  const I n_bcol, 
+                      const I R,       const I C,       const I N,
+      	              const I Ap[],    const I Aj[],    const T Ax[],
+      	              const I Bp[],    const I Bj[],    const T Bx[],
+      	                    I Cp[],          I Cj[],          T Cx[])
+{
+    assert(R > 0 && C > 0 && N > 0);
+
+    if( R == 1 && N == 1 && C == 1 ){
+        // Use CSR for 1x1 blocksize
+        csr_matmat_pass2(n_brow, n_bcol, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx);
+        return;
+    }
+
+#define F(X) bsr_matmat_pass2_blocks(n_brow, n_bcol, R, C, N, Ap, Aj, Ax, \
+                                     Bp, Bj, Bx, Cp, Cj, Cx, \
+                                     bsr_block_gemm_fixed<T,X,X,X>()); return;
+    if( R == C && C == N ){
+        switch(R){
+            case 2: F(2)
+            case 3: F(3)
+            case 4: F(4)
+            case 6: F(6)
+            case 8: F(8)
+        }
+    }
+#undef F
+
+    bsr_matmat_pass2_blocks(n_brow, n_bcol, R, C, N, Ap, Aj, Ax, Bp, Bj, Bx,
+                            Cp, Cj, Cx, bsr_block_gemm<I,T>(R, C, N));
+}
+
+
 
 
 template <class I, class T>
@@ -657,6 +713,62 @@ void bsr_minus_bsr(const I n_row, const I n_col, const I R, const I C,
 //}
 
 
+/*
+ * bsr_matvec and bsr_matvecs for block sizes known at compile time.
+ *
+ * With R and C constant the block loops are fully unrolled and the
+ * row sums stay in registers, which lets the compiler vectorize them.
+ */
+template <class I, class T, int R, int C>
+void bsr_matvec_fixed(const I n_brow,
+	                  const I n_bcol, 
+	                  const I Ap[], 
+	                  const I Aj[], 
+	                  const T Ax[],
+	                  const T Xx[],
+	                        T Yx[])
+{
+    for(I i = 0; i < n_brow; i++){
+        T * y = Yx + R * i;
+        T sums[R];
+        for(int r = 0; r < R; r++){
+            sums[r] = y[r];
+        }
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            const I j = Aj[jj];
+            matvec<R,C,1,1>(Ax + R*C*jj, Xx + C*j, sums); // sums += A*x
+        }
+        for(int r = 0; r < R; r++){
+            y[r] = sums[r];
+        }
+    }
+}
+
+template <class I, class T, int R, int C>
+void bsr_matvecs_fixed(const I n_brow,
+	                   const I n_bcol, 
+                       const I n_vecs,
+	                   const I Ap[], 
+	                   const I Aj[], 
+	                   const T Ax[],
+	                   const T Xx[],
+	                         T Yx[])
+{
+    for(I i = 0; i < n_brow; i++){
+        T * y = Yx + n_vecs * R * i;
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            const T * A = Ax + R * C * jj;
+            const T * x = Xx + n_vecs * C * Aj[jj];
+            for(int r = 0; r < R; r++){
+                for(int c = 0; c < C; c++){
+                    axpy(n_vecs, A[C * r + c], x + n_vecs * c, y + n_vecs * r);
+                }
+            }
+        }
+    }
+}
+
+
 template <class I, class T>
 void bsr_matvec(const I n_brow,
 	            const I n_bcol, 
@@ -676,6 +788,18 @@ void bsr_matvec(const I n_brow,
         return;
     }
 
+#define F(X) bsr_matvec_fixed<I,T,X,X>(n_brow, n_bcol, Ap, Aj, Ax, Xx, Yx); return;
+    if( R == C ){
+        switch(R){
+            case 2: F(2)
+            case 3: F(3)
+            case 4: F(4)
+            case 6: F(6)
+            case 8: F(8)
+        }
+    }
+#undef F
+
     const I RC = R*C;
     for(I i = 0; i < n_brow; i++){
         T * y = Yx + R * i;
@@ -728,6 +852,18 @@ void bsr_matvecs(const I n_brow,
         return;
     }
 
+#define F(X) bsr_matvecs_fixed<I,T,X,X>(n_brow, n_bcol, n_vecs, Ap, Aj, Ax, Xx, Yx); return;
+    if( R == C ){
+        switch(R){
+            case 2: F(2)
+            case 3: F(3)
+            case 4: F(4)
+            case 6: F(6)
+            case 8: F(8)
+        }
+    }
+#undef F
+
     const I A_bs = R*C;      //Ax blocksize
     const I Y_bs = n_vecs*R; //Yx blocksize
     const I X_bs = C*n_vecs; //Xx blocksize
@@ -98,6 +98,48 @@ def bsr_diagonal(*args):
         npy_cdouble_wrapper Ax, npy_cdouble_wrapper Yx)
     bsr_diagonal(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, signed char Ax, 
+        signed char Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned char Ax, 
+        unsigned char Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, short Ax, 
+        short Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned short Ax, 
+        unsigned short Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, int Ax, 
+        int Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned int Ax, 
+        unsigned int Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, long long Ax, 
+        long long Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned long long Ax, 
+        unsigned long long Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, float Ax, 
+        float Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, double Ax, 
+        double Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, long double Ax, 
+        long double Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Yx)
+    bsr_diagonal(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Yx)
     """
   return _bsr.bsr_diagonal(*args)
 
@@ -131,6 +173,48 @@ def bsr_scale_rows(*args):
         npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx)
     bsr_scale_rows(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, signed char Ax, 
+        signed char Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned char Ax, 
+        unsigned char Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, short Ax, 
+        short Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned short Ax, 
+        unsigned short Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, int Ax, 
+        int Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned int Ax, 
+        unsigned int Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, long long Ax, 
+        long long Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned long long Ax, 
+        unsigned long long Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, float Ax, 
+        float Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, double Ax, 
+        double Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, long double Ax, 
+        long double Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx)
+    bsr_scale_rows(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx)
     """
   return _bsr.bsr_scale_rows(*args)
 
@@ -164,6 +248,48 @@ def bsr_scale_columns(*args):
         npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx)
     bsr_scale_columns(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, signed char Ax, 
+        signed char Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned char Ax, 
+        unsigned char Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, short Ax, 
+        short Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned short Ax, 
+        unsigned short Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, int Ax, 
+        int Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned int Ax, 
+        unsigned int Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, long long Ax, 
+        long long Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned long long Ax, 
+        unsigned long long Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, float Ax, 
+        float Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, double Ax, 
+        double Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, long double Ax, 
+        long double Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx)
+    bsr_scale_columns(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx)
     """
   return _bsr.bsr_scale_columns(*args)
 
@@ -198,6 +324,52 @@ def bsr_transpose(*args):
     bsr_transpose(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, int Bp, int Bj, 
         npy_clongdouble_wrapper Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, signed char Ax, 
+        long long Bp, long long Bj, signed char Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned char Ax, 
+        long long Bp, long long Bj, unsigned char Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, short Ax, 
+        long long Bp, long long Bj, short Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned short Ax, 
+        long long Bp, long long Bj, unsigned short Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, int Ax, 
+        long long Bp, long long Bj, int Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned int Ax, 
+        long long Bp, long long Bj, unsigned int Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, long long Ax, 
+        long long Bp, long long Bj, long long Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned long long Ax, 
+        long long Bp, long long Bj, 
+        unsigned long long Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, float Ax, 
+        long long Bp, long long Bj, float Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, double Ax, 
+        long long Bp, long long Bj, double Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, long double Ax, 
+        long long Bp, long long Bj, long double Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        long long Bp, long long Bj, 
+        npy_cfloat_wrapper Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        long long Bp, long long Bj, 
+        npy_cdouble_wrapper Bx)
+    bsr_transpose(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        long long Bp, long long Bj, 
+        npy_clongdouble_wrapper Bx)
     """
   return _bsr.bsr_transpose(*args)
 
@@ -247,6 +419,72 @@ def bsr_matmat_pass2(*args):
         int Aj, npy_clongdouble_wrapper Ax, int Bp, 
         int Bj, npy_clongdouble_wrapper Bx, int Cp, 
         int Cj, npy_clongdouble_wrapper Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        signed char Ax, long long Bp, long long Bj, 
+        signed char Bx, long long Cp, long long Cj, 
+        signed char Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        unsigned char Ax, long long Bp, long long Bj, 
+        unsigned char Bx, long long Cp, long long Cj, 
+        unsigned char Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        short Ax, long long Bp, long long Bj, 
+        short Bx, long long Cp, long long Cj, short Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        unsigned short Ax, long long Bp, long long Bj, 
+        unsigned short Bx, long long Cp, long long Cj, 
+        unsigned short Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        int Ax, long long Bp, long long Bj, int Bx, 
+        long long Cp, long long Cj, int Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        unsigned int Ax, long long Bp, long long Bj, 
+        unsigned int Bx, long long Cp, long long Cj, 
+        unsigned int Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        long long Ax, long long Bp, long long Bj, 
+        long long Bx, long long Cp, long long Cj, 
+        long long Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        unsigned long long Ax, long long Bp, long long Bj, 
+        unsigned long long Bx, long long Cp, 
+        long long Cj, unsigned long long Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        float Ax, long long Bp, long long Bj, 
+        float Bx, long long Cp, long long Cj, float Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        double Ax, long long Bp, long long Bj, 
+        double Bx, long long Cp, long long Cj, double Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        long double Ax, long long Bp, long long Bj, 
+        long double Bx, long long Cp, long long Cj, 
+        long double Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long Bp, long long Bj, 
+        npy_cfloat_wrapper Bx, long long Cp, 
+        long long Cj, npy_cfloat_wrapper Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Cj, npy_cdouble_wrapper Cx)
+    bsr_matmat_pass2(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long N, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Cj, npy_clongdouble_wrapper Cx)
     """
   return _bsr.bsr_matmat_pass2(*args)
 
@@ -284,6 +522,49 @@ def bsr_matvec(*args):
     bsr_matvec(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
         npy_clongdouble_wrapper Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, signed char Ax, 
+        signed char Xx, signed char Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, short Ax, 
+        short Xx, short Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, int Ax, 
+        int Xx, int Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, long long Ax, 
+        long long Xx, long long Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned long long Ax, 
+        unsigned long long Xx, unsigned long long Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, float Ax, 
+        float Xx, float Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, double Ax, 
+        double Xx, double Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, long double Ax, 
+        long double Xx, long double Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    bsr_matvec(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
     """
   return _bsr.bsr_matvec(*args)
 
@@ -326,6 +607,55 @@ def bsr_matvecs(*args):
     bsr_matvecs(int n_brow, int n_bcol, int n_vecs, int R, int C, int Ap, 
         int Aj, npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
         npy_clongdouble_wrapper Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        signed char Ax, signed char Xx, signed char Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        unsigned char Ax, unsigned char Xx, 
+        unsigned char Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        short Ax, short Xx, short Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        unsigned short Ax, unsigned short Xx, 
+        unsigned short Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        int Ax, int Xx, int Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        unsigned int Ax, unsigned int Xx, 
+        unsigned int Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        long long Ax, long long Xx, long long Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        unsigned long long Ax, unsigned long long Xx, 
+        unsigned long long Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        float Ax, float Xx, float Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        double Ax, double Xx, double Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        long double Ax, long double Xx, long double Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    bsr_matvecs(long long n_brow, long long n_bcol, long long n_vecs, 
+        long long R, long long C, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
     """
   return _bsr.bsr_matvecs(*args)
 
@@ -373,6 +703,66 @@ def bsr_elmul_bsr(*args):
     bsr_elmul_bsr(int n_row, int n_col, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, int Bp, int Bj, 
         npy_clongdouble_wrapper Bx, int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, signed char Ax, 
+        long long Bp, long long Bj, signed char Bx, 
+        long long Cp, long long Cj, signed char Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned char Ax, 
+        long long Bp, long long Bj, unsigned char Bx, 
+        long long Cp, long long Cj, unsigned char Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, short Ax, 
+        long long Bp, long long Bj, short Bx, long long Cp, 
+        long long Cj, short Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned short Ax, 
+        long long Bp, long long Bj, unsigned short Bx, 
+        long long Cp, long long Cj, unsigned short Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, int Ax, 
+        long long Bp, long long Bj, int Bx, long long Cp, 
+        long long Cj, int Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned int Ax, 
+        long long Bp, long long Bj, unsigned int Bx, 
+        long long Cp, long long Cj, unsigned int Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, long long Ax, 
+        long long Bp, long long Bj, long long Bx, 
+        long long Cp, long long Cj, long long Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned long long Ax, 
+        long long Bp, long long Bj, unsigned long long Bx, 
+        long long Cp, long long Cj, 
+        unsigned long long Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, float Ax, 
+        long long Bp, long long Bj, float Bx, long long Cp, 
+        long long Cj, float Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, double Ax, 
+        long long Bp, long long Bj, double Bx, long long Cp, 
+        long long Cj, double Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, long double Ax, 
+        long long Bp, long long Bj, long double Bx, 
+        long long Cp, long long Cj, long double Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        long long Bp, long long Bj, npy_cfloat_wrapper Bx, 
+        long long Cp, long long Cj, 
+        npy_cfloat_wrapper Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        long long Bp, long long Bj, npy_cdouble_wrapper Bx, 
+        long long Cp, long long Cj, 
+        npy_cdouble_wrapper Cx)
+    bsr_elmul_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        long long Bp, long long Bj, 
+        npy_clongdouble_wrapper Bx, long long Cp, 
+        long long Cj, npy_clongdouble_wrapper Cx)
     """
   return _bsr.bsr_elmul_bsr(*args)
 
@@ -420,6 +810,66 @@ def bsr_eldiv_bsr(*args):
     bsr_eldiv_bsr(int n_row, int n_col, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, int Bp, int Bj, 
         npy_clongdouble_wrapper Bx, int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, signed char Ax, 
+        long long Bp, long long Bj, signed char Bx, 
+        long long Cp, long long Cj, signed char Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned char Ax, 
+        long long Bp, long long Bj, unsigned char Bx, 
+        long long Cp, long long Cj, unsigned char Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, short Ax, 
+        long long Bp, long long Bj, short Bx, long long Cp, 
+        long long Cj, short Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned short Ax, 
+        long long Bp, long long Bj, unsigned short Bx, 
+        long long Cp, long long Cj, unsigned short Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, int Ax, 
+        long long Bp, long long Bj, int Bx, long long Cp, 
+        long long Cj, int Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned int Ax, 
+        long long Bp, long long Bj, unsigned int Bx, 
+        long long Cp, long long Cj, unsigned int Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, long long Ax, 
+        long long Bp, long long Bj, long long Bx, 
+        long long Cp, long long Cj, long long Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned long long Ax, 
+        long long Bp, long long Bj, unsigned long long Bx, 
+        long long Cp, long long Cj, 
+        unsigned long long Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, float Ax, 
+        long long Bp, long long Bj, float Bx, long long Cp, 
+        long long Cj, float Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, double Ax, 
+        long long Bp, long long Bj, double Bx, long long Cp, 
+        long long Cj, double Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, long double Ax, 
+        long long Bp, long long Bj, long double Bx, 
+        long long Cp, long long Cj, long double Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        long long Bp, long long Bj, npy_cfloat_wrapper Bx, 
+        long long Cp, long long Cj, 
+        npy_cfloat_wrapper Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        long long Bp, long long Bj, npy_cdouble_wrapper Bx, 
+        long long Cp, long long Cj, 
+        npy_cdouble_wrapper Cx)
+    bsr_eldiv_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        long long Bp, long long Bj, 
+        npy_clongdouble_wrapper Bx, long long Cp, 
+        long long Cj, npy_clongdouble_wrapper Cx)
     """
   return _bsr.bsr_eldiv_bsr(*args)
 
@@ -467,6 +917,66 @@ def bsr_plus_bsr(*args):
     bsr_plus_bsr(int n_row, int n_col, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, int Bp, int Bj, 
         npy_clongdouble_wrapper Bx, int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, signed char Ax, 
+        long long Bp, long long Bj, signed char Bx, 
+        long long Cp, long long Cj, signed char Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned char Ax, 
+        long long Bp, long long Bj, unsigned char Bx, 
+        long long Cp, long long Cj, unsigned char Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, short Ax, 
+        long long Bp, long long Bj, short Bx, long long Cp, 
+        long long Cj, short Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned short Ax, 
+        long long Bp, long long Bj, unsigned short Bx, 
+        long long Cp, long long Cj, unsigned short Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, int Ax, 
+        long long Bp, long long Bj, int Bx, long long Cp, 
+        long long Cj, int Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned int Ax, 
+        long long Bp, long long Bj, unsigned int Bx, 
+        long long Cp, long long Cj, unsigned int Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, long long Ax, 
+        long long Bp, long long Bj, long long Bx, 
+        long long Cp, long long Cj, long long Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned long long Ax, 
+        long long Bp, long long Bj, unsigned long long Bx, 
+        long long Cp, long long Cj, 
+        unsigned long long Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, float Ax, 
+        long long Bp, long long Bj, float Bx, long long Cp, 
+        long long Cj, float Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, double Ax, 
+        long long Bp, long long Bj, double Bx, long long Cp, 
+        long long Cj, double Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, long double Ax, 
+        long long Bp, long long Bj, long double Bx, 
+        long long Cp, long long Cj, long double Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        long long Bp, long long Bj, npy_cfloat_wrapper Bx, 
+        long long Cp, long long Cj, 
+        npy_cfloat_wrapper Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        long long Bp, long long Bj, npy_cdouble_wrapper Bx, 
+        long long Cp, long long Cj, 
+        npy_cdouble_wrapper Cx)
+    bsr_plus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        long long Bp, long long Bj, 
+        npy_clongdouble_wrapper Bx, long long Cp, 
+        long long Cj, npy_clongdouble_wrapper Cx)
     """
   return _bsr.bsr_plus_bsr(*args)
 
@@ -514,6 +1024,66 @@ def bsr_minus_bsr(*args):
     bsr_minus_bsr(int n_row, int n_col, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, int Bp, int Bj, 
         npy_clongdouble_wrapper Bx, int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, signed char Ax, 
+        long long Bp, long long Bj, signed char Bx, 
+        long long Cp, long long Cj, signed char Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned char Ax, 
+        long long Bp, long long Bj, unsigned char Bx, 
+        long long Cp, long long Cj, unsigned char Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, short Ax, 
+        long long Bp, long long Bj, short Bx, long long Cp, 
+        long long Cj, short Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned short Ax, 
+        long long Bp, long long Bj, unsigned short Bx, 
+        long long Cp, long long Cj, unsigned short Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, int Ax, 
+        long long Bp, long long Bj, int Bx, long long Cp, 
+        long long Cj, int Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned int Ax, 
+        long long Bp, long long Bj, unsigned int Bx, 
+        long long Cp, long long Cj, unsigned int Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, long long Ax, 
+        long long Bp, long long Bj, long long Bx, 
+        long long Cp, long long Cj, long long Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned long long Ax, 
+        long long Bp, long long Bj, unsigned long long Bx, 
+        long long Cp, long long Cj, 
+        unsigned long long Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, float Ax, 
+        long long Bp, long long Bj, float Bx, long long Cp, 
+        long long Cj, float Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, double Ax, 
+        long long Bp, long long Bj, double Bx, long long Cp, 
+        long long Cj, double Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, long double Ax, 
+        long long Bp, long long Bj, long double Bx, 
+        long long Cp, long long Cj, long double Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        long long Bp, long long Bj, npy_cfloat_wrapper Bx, 
+        long long Cp, long long Cj, 
+        npy_cfloat_wrapper Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        long long Bp, long long Bj, npy_cdouble_wrapper Bx, 
+        long long Cp, long long Cj, 
+        npy_cdouble_wrapper Cx)
+    bsr_minus_bsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        long long Bp, long long Bj, 
+        npy_clongdouble_wrapper Bx, long long Cp, 
+        long long Cj, npy_clongdouble_wrapper Cx)
     """
   return _bsr.bsr_minus_bsr(*args)
 
@@ -547,6 +1117,34 @@ def bsr_sort_indices(*args):
         npy_cdouble_wrapper Ax)
     bsr_sort_indices(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, signed char Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned char Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, short Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned short Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, int Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned int Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, long long Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, unsigned long long Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, float Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, double Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, long double Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax)
+    bsr_sort_indices(long long n_brow, long long n_bcol, long long R, long long C, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax)
     """
   return _bsr.bsr_sort_indices(*args)
 
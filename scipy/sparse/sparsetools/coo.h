@@ -3,6 +3,9 @@
 
 #include <algorithm>
 #include <set>
+#include <vector>
+
+#include "parallel.h"
 
 /*
  * Compute B = A for COO matrix A, CSR matrix B
@@ -89,6 +92,222 @@ void coo_tocsc(const I n_row,
       	             T Bx[])
 { coo_tocsr<I,T>(n_col, n_row, nnz, Aj, Ai, Ax, Bp, Bi, Bx); }
 
+/*
+ * Stable counting sort of n (key, other, value) triples by key.
+ *
+ * Input Arguments:
+ *   I  n               - number of triples
+ *   I  n_keys          - keys lie in 0..n_keys-1
+ *   I  keys[n]         - sort keys
+ *   I  other[n]        - second index carried along with each key
+ *   T  vals[n]         - values carried along with each key
+ *   I  n_threads       - number of threads (<= 0 means the default)
+ *
+ * Output Arguments:
+ *   I  key_ptr[n_keys+1] - the triples with key k end up at positions
+ *                          key_ptr[k] to key_ptr[k+1]-1
+ *   I  out_keys[n]     - sorted keys (may be NULL)
+ *   I  out_other[n]    - second indices in sorted order
+ *   T  out_vals[n]     - values in sorted order
+ *
+ * Note:
+ *   The input is cut into one contiguous chunk per thread.  Each thread
+ *   counts its chunk, the counts are turned into per-(key, thread) write
+ *   offsets, and each thread scatters its chunk.  Triples with equal keys
+ *   keep their input order for any thread count.
+ *
+ *   Every chunk needs a histogram of n_keys entries, so the thread count
+ *   is reduced until each chunk holds at least n_keys triples.
+ *
+ *   Complexity: Linear.  Specifically O(n + n_keys * n_threads)
+ */
+template <class I, class T>
+void counting_sort_by_key(const I n,
+                          const I n_keys,
+                          const I keys[],
+                          const I other[],
+                          const T vals[],
+                                I key_ptr[],
+                                I out_keys[],
+                                I out_other[],
+                                T out_vals[],
+                          const I n_threads)
+{
+    key_ptr[0] = 0;
+    if(n_keys == 0){
+        return;
+    }
+
+    I t = sparsetools_num_threads(n_threads, n);
+    t = std::max((I) 1, std::min(t, n / std::max(n_keys, (I) 1)));
+
+    std::vector<I> counts((std::size_t) t * n_keys, 0);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        const I start = (I)((long long) n * p / t);
+        const I end   = (I)((long long) n * (p + 1) / t);
+        I * count = &counts[0] + (std::size_t) p * n_keys;
+        for(I m = start; m < end; m++){
+            count[keys[m]]++;
+        }
+    }
+
+    // counts[p][k] becomes the number of triples with key k in chunks
+    // before p, and key_ptr[k+1] the number of triples with key k
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static))
+    for(I k = 0; k < n_keys; k++){
+        I run = 0;
+        for(I p = 0; p < t; p++){
+            I c = counts[(std::size_t) p * n_keys + k];
+            counts[(std::size_t) p * n_keys + k] = run;
+            run += c;
+        }
+        key_ptr[k+1] = run;
+    }
+
+    for(I k = 0; k < n_keys; k++){
+        key_ptr[k+1] += key_ptr[k];
+    }
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        const I start = (I)((long long) n * p / t);
+        const I end   = (I)((long long) n * (p + 1) / t);
+        I * offset = &counts[0] + (std::size_t) p * n_keys;
+        for(I m = start; m < end; m++){
+            const I k = keys[m];
+            const I dest = key_ptr[k] + offset[k]++;
+            if(out_keys != NULL){
+                out_keys[dest] = k;
+            }
+            out_other[dest] = other[m];
+            out_vals[dest]  = vals[m];
+        }
+    }
+}
+
+
+/*
+ * Compute B = A for COO matrix A, CSR matrix B with sorted column
+ * indices and duplicate entries summed
+ *
+ *
+ * Input Arguments:
+ *   I  n_row      - number of rows in A
+ *   I  n_col      - number of columns in A
+ *   I  nnz        - number of nonzeros in A
+ *   I  Ai[nnz(A)] - row indices
+ *   I  Aj[nnz(A)] - column indices
+ *   T  Ax[nnz(A)] - nonzeros
+ *   I  n_threads  - number of threads (<= 0 means the default)
+ * Output Arguments:
+ *   I Bp[n_row+1] - row pointer
+ *   I Bj[nnz(A)]  - column indices
+ *   T Bx[nnz(A)]  - nonzeros
+ *
+ * Note:
+ *   Output arrays Bp, Bj, and Bx must be preallocated.  Only the first
+ *   Bp[n_row] entries of Bj and Bx are used.
+ *
+ * Note:
+ *   Input:  row and column indices *are not* assumed to be ordered
+ *   Output: column indices *will be* in sorted order and duplicate
+ *           entries are summed in their input order, so the result does
+ *           not depend on n_threads.  Explicit zeros are retained.
+ *
+ *   This replaces coo_tocsr, csr_sort_indices and csr_sum_duplicates
+ *   with two counting sort passes (by column, then stably by row) and
+ *   a merge, all multithreaded.  Temporary storage is two index arrays
+ *   and one value array of length nnz(A).
+ *
+ *   Complexity: Linear.  Specifically O(nnz(A) + (n_row + n_col) * n_threads)
+ *
+ */
+template <class I, class T>
+void coo_tocsr_canonical(const I n_row,
+                         const I n_col,
+                         const I nnz,
+                         const I Ai[],
+                         const I Aj[],
+                         const T Ax[],
+                               I Bp[],
+                               I Bj[],
+                               T Bx[],
+                         const I n_threads)
+{
+    std::vector<I> Ti(nnz), Tj(nnz);
+    std::vector<T> Tx(nnz);
+    I * Ti_ptr = nnz > 0 ? &Ti[0] : NULL;
+    I * Tj_ptr = nnz > 0 ? &Tj[0] : NULL;
+    T * Tx_ptr = nnz > 0 ? &Tx[0] : NULL;
+
+    // sort by column into (Ti, Bj, Bx), then stably by row into (Tj, Tx)
+    std::vector<I> Tp(std::max(n_row, n_col) + 1);
+    counting_sort_by_key(nnz, n_col, Aj, Ai, Ax, &Tp[0],
+                         Bj, Ti_ptr, Bx, n_threads);
+    counting_sort_by_key(nnz, n_row, Ti_ptr, Bj, Bx, &Tp[0],
+                         (I *) NULL, Tj_ptr, Tx_ptr, n_threads);
+
+    // count distinct columns in each row
+    const I t = sparsetools_num_threads(n_threads, n_row);
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_row, &Tp[0], t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        for(I i = bounds[p]; i < bounds[p+1]; i++){
+            I length = 0;
+            for(I jj = Tp[i]; jj < Tp[i+1]; jj++){
+                if(jj == Tp[i] || Tj[jj] != Tj[jj-1]){
+                    length++;
+                }
+            }
+            Bp[i+1] = length;
+        }
+    }
+
+    Bp[0] = 0;
+    for(I i = 0; i < n_row; i++){
+        Bp[i+1] += Bp[i];
+    }
+
+    // sum duplicates into Bj, Bx
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        for(I i = bounds[p]; i < bounds[p+1]; i++){
+            I dest = Bp[i];
+            I jj = Tp[i];
+            while(jj < Tp[i+1]){
+                const I j = Tj[jj];
+                T x = Tx[jj];
+                jj++;
+                while(jj < Tp[i+1] && Tj[jj] == j){
+                    x += Tx[jj];
+                    jj++;
+                }
+                Bj[dest] = j;
+                Bx[dest] = x;
+                dest++;
+            }
+        }
+    }
+}
+
+template <class I, class T>
+void coo_tocsc_canonical(const I n_row,
+                         const I n_col,
+                         const I nnz,
+                         const I Ai[],
+                         const I Aj[],
+                         const T Ax[],
+                               I Bp[],
+                               I Bi[],
+                               T Bx[],
+                         const I n_threads)
+{ coo_tocsr_canonical<I,T>(n_col, n_row, nnz, Aj, Ai, Ax, Bp, Bi, Bx, n_threads); }
+
+
 /*
  * Compute B += A for COO matrix A, dense matrix B
  *
@@ -4,12 +4,27 @@
 
 %{
 #include "coo.h"
+#include "mmio.h"
 %}
 
 %include "coo.h" 
 
+/* helpers of the MatrixMarket kernels */
+%ignore mm_is_space;
+%ignore mm_skip_space;
+%ignore mm_at_token_end;
+%ignore mm_parse_integer;
+%ignore mm_parse_double;
+%ignore mm_next_line;
+%ignore mm_is_entry;
+%ignore mm_append_integer;
+
+%include "mmio.h"
+
 INSTANTIATE_ALL(coo_tocsr)
 INSTANTIATE_ALL(coo_tocsc)
+INSTANTIATE_ALL(coo_tocsr_canonical)
+INSTANTIATE_ALL(coo_tocsc_canonical)
 INSTANTIATE_ALL(coo_todense)
 
 INSTANTIATE_ALL(coo_matvec)
@@ -17,3 +32,18 @@ INSTANTIATE_ALL(coo_matvec)
 INSTANTIATE_INDEX(coo_count_diagonals)
 
 
+/*
+ * MatrixMarket values are read and written as int, long long or double
+ */
+%define INSTANTIATE_MM( f_name )
+%template(f_name)   f_name<int,int>;
+%template(f_name)   f_name<int,long long>;
+%template(f_name)   f_name<int,double>;
+%template(f_name)   f_name<long long,int>;
+%template(f_name)   f_name<long long,long long>;
+%template(f_name)   f_name<long long,double>;
+%enddef
+
+INSTANTIATE_MM(mm_parse_entries)
+INSTANTIATE_MM(mm_format_entries)
+
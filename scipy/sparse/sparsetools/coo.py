@@ -67,10 +67,6 @@ except AttributeError:
 
 
 
-def coo_count_diagonals(*args):
-  """coo_count_diagonals(int nnz, int Ai, int Aj) -> int"""
-  return _coo.coo_count_diagonals(*args)
-
 
 def coo_tocsr(*args):
   """
@@ -102,6 +98,48 @@ def coo_tocsr(*args):
         int Bp, int Bj, npy_cdouble_wrapper Bx)
     coo_tocsr(int n_row, int n_col, int nnz, int Ai, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, signed char Ax, long long Bp, 
+        long long Bj, signed char Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned char Ax, long long Bp, 
+        long long Bj, unsigned char Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, short Ax, long long Bp, 
+        long long Bj, short Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned short Ax, 
+        long long Bp, long long Bj, unsigned short Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, int Ax, long long Bp, 
+        long long Bj, int Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned int Ax, long long Bp, 
+        long long Bj, unsigned int Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, long long Ax, long long Bp, 
+        long long Bj, long long Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned long long Ax, 
+        long long Bp, long long Bj, unsigned long long Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, float Ax, long long Bp, 
+        long long Bj, float Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, double Ax, long long Bp, 
+        long long Bj, double Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, long double Ax, long long Bp, 
+        long long Bj, long double Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_cfloat_wrapper Ax, 
+        long long Bp, long long Bj, npy_cfloat_wrapper Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_cdouble_wrapper Ax, 
+        long long Bp, long long Bj, npy_cdouble_wrapper Bx)
+    coo_tocsr(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_clongdouble_wrapper Ax, 
+        long long Bp, long long Bj, npy_clongdouble_wrapper Bx)
     """
   return _coo.coo_tocsr(*args)
 
@@ -135,9 +173,227 @@ def coo_tocsc(*args):
         int Bp, int Bi, npy_cdouble_wrapper Bx)
     coo_tocsc(int n_row, int n_col, int nnz, int Ai, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, signed char Ax, long long Bp, 
+        long long Bi, signed char Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned char Ax, long long Bp, 
+        long long Bi, unsigned char Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, short Ax, long long Bp, 
+        long long Bi, short Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned short Ax, 
+        long long Bp, long long Bi, unsigned short Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, int Ax, long long Bp, 
+        long long Bi, int Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned int Ax, long long Bp, 
+        long long Bi, unsigned int Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, long long Ax, long long Bp, 
+        long long Bi, long long Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned long long Ax, 
+        long long Bp, long long Bi, unsigned long long Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, float Ax, long long Bp, 
+        long long Bi, float Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, double Ax, long long Bp, 
+        long long Bi, double Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, long double Ax, long long Bp, 
+        long long Bi, long double Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_cfloat_wrapper Ax, 
+        long long Bp, long long Bi, npy_cfloat_wrapper Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_cdouble_wrapper Ax, 
+        long long Bp, long long Bi, npy_cdouble_wrapper Bx)
+    coo_tocsc(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_clongdouble_wrapper Ax, 
+        long long Bp, long long Bi, npy_clongdouble_wrapper Bx)
     """
   return _coo.coo_tocsc(*args)
 
+def coo_tocsr_canonical(*args):
+  """
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, signed char Ax, 
+        int Bp, int Bj, signed char Bx, int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, unsigned char Ax, 
+        int Bp, int Bj, unsigned char Bx, 
+        int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, short Ax, 
+        int Bp, int Bj, short Bx, int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, unsigned short Ax, 
+        int Bp, int Bj, unsigned short Bx, 
+        int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, int Ax, 
+        int Bp, int Bj, int Bx, int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, unsigned int Ax, 
+        int Bp, int Bj, unsigned int Bx, 
+        int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, long long Ax, 
+        int Bp, int Bj, long long Bx, int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, unsigned long long Ax, 
+        int Bp, int Bj, unsigned long long Bx, 
+        int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, float Ax, 
+        int Bp, int Bj, float Bx, int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, double Ax, 
+        int Bp, int Bj, double Bx, int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, long double Ax, 
+        int Bp, int Bj, long double Bx, int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, npy_cfloat_wrapper Ax, 
+        int Bp, int Bj, npy_cfloat_wrapper Bx, 
+        int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, npy_cdouble_wrapper Ax, 
+        int Bp, int Bj, npy_cdouble_wrapper Bx, 
+        int n_threads)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, npy_clongdouble_wrapper Ax, 
+        int Bp, int Bj, npy_clongdouble_wrapper Bx, 
+        int n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, signed char Ax, long long Bp, 
+        long long Bj, signed char Bx, long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned char Ax, long long Bp, 
+        long long Bj, unsigned char Bx, 
+        long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, short Ax, long long Bp, 
+        long long Bj, short Bx, long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned short Ax, 
+        long long Bp, long long Bj, unsigned short Bx, 
+        long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, int Ax, long long Bp, 
+        long long Bj, int Bx, long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned int Ax, long long Bp, 
+        long long Bj, unsigned int Bx, long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, long long Ax, long long Bp, 
+        long long Bj, long long Bx, long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned long long Ax, 
+        long long Bp, long long Bj, unsigned long long Bx, 
+        long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, float Ax, long long Bp, 
+        long long Bj, float Bx, long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, double Ax, long long Bp, 
+        long long Bj, double Bx, long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, long double Ax, long long Bp, 
+        long long Bj, long double Bx, long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_cfloat_wrapper Ax, 
+        long long Bp, long long Bj, npy_cfloat_wrapper Bx, 
+        long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_cdouble_wrapper Ax, 
+        long long Bp, long long Bj, npy_cdouble_wrapper Bx, 
+        long long n_threads)
+    coo_tocsr_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_clongdouble_wrapper Ax, 
+        long long Bp, long long Bj, npy_clongdouble_wrapper Bx, 
+        long long n_threads)
+    """
+  return _coo.coo_tocsr_canonical(*args)
+
+def coo_tocsc_canonical(*args):
+  """
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, signed char Ax, 
+        int Bp, int Bi, signed char Bx, int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, unsigned char Ax, 
+        int Bp, int Bi, unsigned char Bx, 
+        int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, short Ax, 
+        int Bp, int Bi, short Bx, int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, unsigned short Ax, 
+        int Bp, int Bi, unsigned short Bx, 
+        int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, int Ax, 
+        int Bp, int Bi, int Bx, int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, unsigned int Ax, 
+        int Bp, int Bi, unsigned int Bx, 
+        int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, long long Ax, 
+        int Bp, int Bi, long long Bx, int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, unsigned long long Ax, 
+        int Bp, int Bi, unsigned long long Bx, 
+        int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, float Ax, 
+        int Bp, int Bi, float Bx, int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, double Ax, 
+        int Bp, int Bi, double Bx, int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, long double Ax, 
+        int Bp, int Bi, long double Bx, int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, npy_cfloat_wrapper Ax, 
+        int Bp, int Bi, npy_cfloat_wrapper Bx, 
+        int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, npy_cdouble_wrapper Ax, 
+        int Bp, int Bi, npy_cdouble_wrapper Bx, 
+        int n_threads)
+    coo_tocsc_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, npy_clongdouble_wrapper Ax, 
+        int Bp, int Bi, npy_clongdouble_wrapper Bx, 
+        int n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, signed char Ax, long long Bp, 
+        long long Bi, signed char Bx, long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned char Ax, long long Bp, 
+        long long Bi, unsigned char Bx, 
+        long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, short Ax, long long Bp, 
+        long long Bi, short Bx, long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned short Ax, 
+        long long Bp, long long Bi, unsigned short Bx, 
+        long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, int Ax, long long Bp, 
+        long long Bi, int Bx, long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned int Ax, long long Bp, 
+        long long Bi, unsigned int Bx, long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, long long Ax, long long Bp, 
+        long long Bi, long long Bx, long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned long long Ax, 
+        long long Bp, long long Bi, unsigned long long Bx, 
+        long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, float Ax, long long Bp, 
+        long long Bi, float Bx, long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, double Ax, long long Bp, 
+        long long Bi, double Bx, long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, long double Ax, long long Bp, 
+        long long Bi, long double Bx, long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_cfloat_wrapper Ax, 
+        long long Bp, long long Bi, npy_cfloat_wrapper Bx, 
+        long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_cdouble_wrapper Ax, 
+        long long Bp, long long Bi, npy_cdouble_wrapper Bx, 
+        long long n_threads)
+    coo_tocsc_canonical(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_clongdouble_wrapper Ax, 
+        long long Bp, long long Bi, npy_clongdouble_wrapper Bx, 
+        long long n_threads)
+    """
+  return _coo.coo_tocsc_canonical(*args)
+
 def coo_todense(*args):
   """
     coo_todense(int n_row, int n_col, int nnz, int Ai, int Aj, signed char Ax, 
@@ -168,6 +424,39 @@ def coo_todense(*args):
         npy_cdouble_wrapper Bx)
     coo_todense(int n_row, int n_col, int nnz, int Ai, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, signed char Ax, signed char Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned char Ax, unsigned char Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, short Ax, short Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned short Ax, 
+        unsigned short Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, int Ax, int Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned int Ax, unsigned int Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, long long Ax, long long Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, unsigned long long Ax, 
+        unsigned long long Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, float Ax, float Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, double Ax, double Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, long double Ax, long double Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Bx)
+    coo_todense(long long n_row, long long n_col, long long nnz, long long Ai, 
+        long long Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Bx)
     """
   return _coo.coo_todense(*args)
 
@@ -197,6 +486,94 @@ def coo_matvec(*args):
         npy_cdouble_wrapper Yx)
     coo_matvec(int nnz, int Ai, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, signed char Ax, 
+        signed char Xx, signed char Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, short Ax, 
+        short Xx, short Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, int Ax, 
+        int Xx, int Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, long long Ax, 
+        long long Xx, long long Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, unsigned long long Ax, 
+        unsigned long long Xx, unsigned long long Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, float Ax, 
+        float Xx, float Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, double Ax, 
+        double Xx, double Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, long double Ax, 
+        long double Xx, long double Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    coo_matvec(long long nnz, long long Ai, long long Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
     """
   return _coo.coo_matvec(*args)
 
+def coo_count_diagonals(*args):
+  """
+    coo_count_diagonals(int nnz, int Ai, int Aj) -> int
+    coo_count_diagonals(long long nnz, long long Ai, long long Aj) -> long long
+    """
+  return _coo.coo_count_diagonals(*args)
+
+def mm_parse_entries(*args):
+  """
+    mm_parse_entries(int n_row, int n_col, int n_indices, int n_values, 
+        int max_entries, int n_text, unsigned char text, 
+        int Ai, int Aj, int Ax, int n_threads) -> int
+    mm_parse_entries(int n_row, int n_col, int n_indices, int n_values, 
+        int max_entries, int n_text, unsigned char text, 
+        int Ai, int Aj, long long Ax, int n_threads) -> int
+    mm_parse_entries(int n_row, int n_col, int n_indices, int n_values, 
+        int max_entries, int n_text, unsigned char text, 
+        int Ai, int Aj, double Ax, int n_threads) -> int
+    mm_parse_entries(long long n_row, long long n_col, long long n_indices, 
+        long long n_values, long long max_entries, 
+        long long n_text, unsigned char text, long long Ai, 
+        long long Aj, int Ax, long long n_threads) -> long long
+    mm_parse_entries(long long n_row, long long n_col, long long n_indices, 
+        long long n_values, long long max_entries, 
+        long long n_text, unsigned char text, long long Ai, 
+        long long Aj, long long Ax, long long n_threads) -> long long
+    mm_parse_entries(long long n_row, long long n_col, long long n_indices, 
+        long long n_values, long long max_entries, 
+        long long n_text, unsigned char text, long long Ai, 
+        long long Aj, double Ax, long long n_threads) -> long long
+    """
+  return _coo.mm_parse_entries(*args)
+
+def mm_format_entries(*args):
+  """
+    mm_format_entries(int n_entries, int n_indices, int n_values, int Ai, 
+        int Aj, int Ax, int precision, int scientific, 
+        int n_threads)
+    mm_format_entries(int n_entries, int n_indices, int n_values, int Ai, 
+        int Aj, long long Ax, int precision, int scientific, 
+        int n_threads)
+    mm_format_entries(int n_entries, int n_indices, int n_values, int Ai, 
+        int Aj, double Ax, int precision, int scientific, 
+        int n_threads)
+    mm_format_entries(long long n_entries, long long n_indices, long long n_values, 
+        long long Ai, long long Aj, int Ax, 
+        long long precision, long long scientific, 
+        long long n_threads)
+    mm_format_entries(long long n_entries, long long n_indices, long long n_values, 
+        long long Ai, long long Aj, long long Ax, 
+        long long precision, long long scientific, 
+        long long n_threads)
+    mm_format_entries(long long n_entries, long long n_indices, long long n_values, 
+        long long Ai, long long Aj, double Ax, 
+        long long precision, long long scientific, 
+        long long n_threads)
+    """
+  return _coo.mm_format_entries(*args)
+
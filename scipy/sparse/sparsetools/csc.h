@@ -3,6 +3,7 @@
 
 
 #include "csr.h"
+#include "triangular.h"
 
 
 /*
@@ -87,6 +88,113 @@ void csc_matvecs(const I n_row,
 
 
 
+/*
+ * Most entries csc_matvecs_threads allocates for the private copies of Y
+ * (128MB of doubles), whatever the number of threads
+ */
+#define CSC_MATVECS_SCRATCH ((std::size_t) 1 << 24)
+
+
+/*
+ * Compute Y += A*X for CSC matrix A and dense block vectors X,Y using
+ * up to n_threads threads (n_threads <= 0 selects the default number).
+ *
+ * Columns are split into chunks of balanced nnz(A) + columns.  The first
+ * chunk accumulates into Y directly and the others into private buffers,
+ * which are then added to Y in chunk order.  The result depends only on
+ * the number of threads, not on scheduling.
+ *
+ * Input Arguments:
+ *   I  n_row            - number of rows in A
+ *   I  n_col            - number of columns in A
+ *   I  n_vecs           - number of column vectors in X and Y
+ *   I  Ap[n_col+1]      - column pointer
+ *   I  Ai[nnz(A)]       - row indices
+ *   T  Ax[nnz(A)]       - nonzeros
+ *   T  Xx[n_col,n_vecs] - input vector
+ *   I  n_threads        - number of threads
+ *
+ * Output Arguments:
+ *   T  Yx[n_row,n_vecs] - output vector
+ *
+ * Note:
+ *   Output array Yx must be preallocated
+ *
+ *   Uses (n_threads - 1) * n_row * n_vecs temporary storage, with fewer
+ *   threads (down to one) when that would exceed CSC_MATVECS_SCRATCH
+ * 
+ */
+template <class I, class T>
+void csc_matvecs_threads(const I n_row,
+	                     const I n_col, 
+                         const I n_vecs,
+	                     const I Ap[], 
+	                     const I Ai[], 
+	                     const T Ax[],
+	                     const T Xx[],
+	                           T Yx[],
+	                     const I n_threads)
+{
+    // every thread but the first needs its own copy of Y
+    const std::size_t len = (std::size_t) n_row * (std::size_t) n_vecs;
+    const std::size_t extra = CSC_MATVECS_SCRATCH / std::max(len, (std::size_t) 1);
+    const I t = (I) std::min((std::size_t) sparsetools_num_threads(n_threads, n_col),
+                             extra + 1);
+    if(t <= 1){
+        csc_matvecs(n_row, n_col, n_vecs, Ap, Ai, Ax, Xx, Yx);
+        return;
+    }
+
+    std::vector<I> bounds(t + 1);
+    std::vector<T> acc((std::size_t)(t - 1) * len, 0);
+    balanced_row_partition(n_col, Ap, t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        const I start = bounds[p];
+        T * y = (p == 0) ? Yx : &acc[(std::size_t)(p - 1) * len];
+        csc_matvecs(n_row, bounds[p+1] - start, n_vecs, Ap + start, Ai, Ax,
+                    Xx + (std::size_t) n_vecs * start, y);
+    }
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t))
+    for(I i = 0; i < n_row; i++){
+        for(I v = 0; v < n_vecs; v++){
+            const std::size_t k = (std::size_t) n_vecs * i + v;
+            T sum = Yx[k];
+            for(I p = 1; p < t; p++){
+                sum += acc[(std::size_t)(p - 1) * len + k];
+            }
+            Yx[k] = sum;
+        }
+    }
+}
+
+
+/*
+ * Compute Y += A*X for CSC matrix A and dense vectors X,Y using up to
+ * n_threads threads.  See csc_matvecs_threads.
+ *
+ */
+template <class I, class T>
+void csc_matvec_threads(const I n_row,
+	                    const I n_col, 
+	                    const I Ap[], 
+	                    const I Ai[], 
+	                    const T Ax[],
+	                    const T Xx[],
+	                          T Yx[],
+	                    const I n_threads)
+{
+    if(sparsetools_num_threads(n_threads, n_col) <= 1){
+        csc_matvec(n_row, n_col, Ap, Ai, Ax, Xx, Yx);
+        return;
+    }
+    csc_matvecs_threads(n_row, n_col, (I) 1, Ap, Ai, Ax, Xx, Yx, n_threads);
+}
+
+
+
 
 /*
  * Derived methods
@@ -112,6 +220,19 @@ void csc_tocsr(const I n_row,
                      T Bx[])
 { csr_tocsc<I,T>(n_col, n_row, Ap, Ai, Ax, Bp, Bj, Bx); }
 
+
+template <class I, class T>
+void csc_tocsr_threads(const I n_row,
+                       const I n_col, 
+                       const I Ap[], 
+                       const I Ai[], 
+                       const T Ax[],
+                             I Bp[],
+                             I Bj[],
+                             T Bx[],
+                       const I n_threads)
+{ csr_tocsc_threads<I,T>(n_col, n_row, Ap, Ai, Ax, Bp, Bj, Bx, n_threads); }
+
     
 template <class I>
 void csc_matmat_pass1(const I n_row,
@@ -137,6 +258,32 @@ void csc_matmat_pass2(const I n_row,
       	                    T Cx[])
 { csr_matmat_pass2(n_col, n_row, Bp, Bi, Bx, Ap, Ai, Ax, Cp, Ci, Cx); }
 
+template <class I>
+void csc_matmat_pass1_threads(const I n_row,
+                              const I n_col, 
+                              const I Ap[], 
+                              const I Ai[], 
+                              const I Bp[],
+                              const I Bi[],
+                                    I Cp[],
+                              const I n_threads)
+{ csr_matmat_pass1_threads(n_col, n_row, Bp, Bi, Ap, Ai, Cp, n_threads); }
+
+template <class I, class T>
+void csc_matmat_pass2_threads(const I n_row,
+      	                      const I n_col, 
+      	                      const I Ap[], 
+      	                      const I Ai[], 
+      	                      const T Ax[],
+      	                      const I Bp[],
+      	                      const I Bi[],
+      	                      const T Bx[],
+      	                            I Cp[],
+      	                            I Ci[],
+      	                            T Cx[],
+      	                      const I n_threads)
+{ csr_matmat_pass2_threads(n_col, n_row, Bp, Bi, Bx, Ap, Ai, Ax, Cp, Ci, Cx, n_threads); }
+
 
 
 
@@ -179,5 +326,25 @@ void csc_minus_csc(const I n_row, const I n_col,
 }
 
 
+/*
+ * Solve A*X = B or A.T*X = B for a triangular CSC matrix A.  The CSC
+ * arrays of A are the CSR arrays of A.T.  See csr_triangular_solve.
+ */
+template <class I, class T>
+I csc_triangular_solve(const I n_row,
+                       const I n_vecs,
+                       const I Ap[],
+                       const I Ai[],
+                       const T Ax[],
+                       const I lower,
+                       const I unit_diagonal,
+                       const I trans,
+                             T Yx[])
+{
+    return csr_triangular_solve(n_row, n_vecs, Ap, Ai, Ax, (I) !lower,
+                                unit_diagonal, (I) !trans, Yx);
+}
+
+
 
 #endif
@@ -9,15 +9,21 @@
 %include "csc.h" 
 
 INSTANTIATE_INDEX(csc_matmat_pass1);
+INSTANTIATE_INDEX(csc_matmat_pass1_threads);
 
 INSTANTIATE_ALL(csc_diagonal)
 INSTANTIATE_ALL(csc_tocsr)
+INSTANTIATE_ALL(csc_tocsr_threads)
 INSTANTIATE_ALL(csc_matmat_pass2)
+INSTANTIATE_ALL(csc_matmat_pass2_threads)
 INSTANTIATE_ALL(csc_matvec)
 INSTANTIATE_ALL(csc_matvecs)
+INSTANTIATE_ALL(csc_matvec_threads)
+INSTANTIATE_ALL(csc_matvecs_threads)
 INSTANTIATE_ALL(csc_elmul_csc)
 INSTANTIATE_ALL(csc_eldiv_csc)
 INSTANTIATE_ALL(csc_plus_csc)
 INSTANTIATE_ALL(csc_minus_csc)
+INSTANTIATE_ALL(csc_triangular_solve)
 
 
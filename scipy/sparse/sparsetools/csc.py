@@ -67,13 +67,25 @@ except AttributeError:
 
 
 
+
 def csc_matmat_pass1(*args):
   """
     csc_matmat_pass1(int n_row, int n_col, int Ap, int Ai, int Bp, int Bi, 
         int Cp)
+    csc_matmat_pass1(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long long Bp, long long Bi, long long Cp)
     """
   return _csc.csc_matmat_pass1(*args)
 
+def csc_matmat_pass1_threads(*args):
+  """
+    csc_matmat_pass1_threads(int n_row, int n_col, int Ap, int Ai, int Bp, int Bi, 
+        int Cp, int n_threads)
+    csc_matmat_pass1_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long long Bp, long long Bi, long long Cp, 
+        long long n_threads)
+    """
+  return _csc.csc_matmat_pass1_threads(*args)
 
 def csc_diagonal(*args):
   """
@@ -101,6 +113,34 @@ def csc_diagonal(*args):
         npy_cdouble_wrapper Yx)
     csc_diagonal(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, signed char Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, unsigned char Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, short Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, unsigned short Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, int Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, unsigned int Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, unsigned long long Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, float Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, double Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long double Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Yx)
+    csc_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Yx)
     """
   return _csc.csc_diagonal(*args)
 
@@ -134,9 +174,131 @@ def csc_tocsr(*args):
         int Bp, int Bj, npy_cdouble_wrapper Bx)
     csc_tocsr(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        signed char Ax, long long Bp, long long Bj, 
+        signed char Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned char Ax, long long Bp, long long Bj, 
+        unsigned char Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        short Ax, long long Bp, long long Bj, 
+        short Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned short Ax, long long Bp, long long Bj, 
+        unsigned short Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        int Ax, long long Bp, long long Bj, 
+        int Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned int Ax, long long Bp, long long Bj, 
+        unsigned int Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long long Ax, long long Bp, long long Bj, 
+        long long Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned long long Ax, long long Bp, 
+        long long Bj, unsigned long long Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        float Ax, long long Bp, long long Bj, 
+        float Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        double Ax, long long Bp, long long Bj, 
+        double Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long double Ax, long long Bp, long long Bj, 
+        long double Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bj, npy_cfloat_wrapper Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_cdouble_wrapper Bx)
+    csc_tocsr(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_clongdouble_wrapper Bx)
     """
   return _csc.csc_tocsr(*args)
 
+def csc_tocsr_threads(*args):
+  """
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, signed char Ax, 
+        int Bp, int Bj, signed char Bx, int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, unsigned char Ax, 
+        int Bp, int Bj, unsigned char Bx, int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, short Ax, int Bp, 
+        int Bj, short Bx, int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, unsigned short Ax, 
+        int Bp, int Bj, unsigned short Bx, int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, int Ax, int Bp, 
+        int Bj, int Bx, int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, unsigned int Ax, 
+        int Bp, int Bj, unsigned int Bx, int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, long long Ax, 
+        int Bp, int Bj, long long Bx, int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, unsigned long long Ax, 
+        int Bp, int Bj, unsigned long long Bx, 
+        int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, float Ax, int Bp, 
+        int Bj, float Bx, int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, double Ax, int Bp, 
+        int Bj, double Bx, int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, long double Ax, 
+        int Bp, int Bj, long double Bx, int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, npy_cfloat_wrapper Ax, 
+        int Bp, int Bj, npy_cfloat_wrapper Bx, 
+        int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, npy_cdouble_wrapper Ax, 
+        int Bp, int Bj, npy_cdouble_wrapper Bx, 
+        int n_threads)
+    csc_tocsr_threads(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
+        int Bp, int Bj, npy_clongdouble_wrapper Bx, 
+        int n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        signed char Ax, long long Bp, long long Bj, 
+        signed char Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned char Ax, long long Bp, long long Bj, 
+        unsigned char Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        short Ax, long long Bp, long long Bj, 
+        short Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned short Ax, long long Bp, long long Bj, 
+        unsigned short Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        int Ax, long long Bp, long long Bj, 
+        int Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned int Ax, long long Bp, long long Bj, 
+        unsigned int Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long long Ax, long long Bp, long long Bj, 
+        long long Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned long long Ax, long long Bp, 
+        long long Bj, unsigned long long Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        float Ax, long long Bp, long long Bj, 
+        float Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        double Ax, long long Bp, long long Bj, 
+        double Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long double Ax, long long Bp, long long Bj, 
+        long double Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bj, npy_cfloat_wrapper Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_cdouble_wrapper Bx, long long n_threads)
+    csc_tocsr_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_clongdouble_wrapper Bx, 
+        long long n_threads)
+    """
+  return _csc.csc_tocsr_threads(*args)
+
 def csc_matmat_pass2(*args):
   """
     csc_matmat_pass2(int n_row, int n_col, int Ap, int Ai, signed char Ax, 
@@ -177,9 +339,169 @@ def csc_matmat_pass2(*args):
     csc_matmat_pass2(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx, 
         int Cp, int Ci, npy_clongdouble_wrapper Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        signed char Ax, long long Bp, long long Bi, 
+        signed char Bx, long long Cp, long long Ci, 
+        signed char Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned char Ax, long long Bp, long long Bi, 
+        unsigned char Bx, long long Cp, long long Ci, 
+        unsigned char Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        short Ax, long long Bp, long long Bi, 
+        short Bx, long long Cp, long long Ci, short Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned short Ax, long long Bp, long long Bi, 
+        unsigned short Bx, long long Cp, 
+        long long Ci, unsigned short Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        int Ax, long long Bp, long long Bi, 
+        int Bx, long long Cp, long long Ci, int Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned int Ax, long long Bp, long long Bi, 
+        unsigned int Bx, long long Cp, long long Ci, 
+        unsigned int Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long long Ax, long long Bp, long long Bi, 
+        long long Bx, long long Cp, long long Ci, 
+        long long Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned long long Ax, long long Bp, 
+        long long Bi, unsigned long long Bx, long long Cp, 
+        long long Ci, unsigned long long Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        float Ax, long long Bp, long long Bi, 
+        float Bx, long long Cp, long long Ci, float Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        double Ax, long long Bp, long long Bi, 
+        double Bx, long long Cp, long long Ci, double Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long double Ax, long long Bp, long long Bi, 
+        long double Bx, long long Cp, long long Ci, 
+        long double Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bi, npy_cfloat_wrapper Bx, long long Cp, 
+        long long Ci, npy_cfloat_wrapper Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Ci, npy_cdouble_wrapper Cx)
+    csc_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Ci, npy_clongdouble_wrapper Cx)
     """
   return _csc.csc_matmat_pass2(*args)
 
+def csc_matmat_pass2_threads(*args):
+  """
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, signed char Ax, 
+        int Bp, int Bi, signed char Bx, int Cp, int Ci, 
+        signed char Cx, int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, unsigned char Ax, 
+        int Bp, int Bi, unsigned char Bx, int Cp, 
+        int Ci, unsigned char Cx, int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, short Ax, int Bp, 
+        int Bi, short Bx, int Cp, int Ci, short Cx, 
+        int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, unsigned short Ax, 
+        int Bp, int Bi, unsigned short Bx, int Cp, 
+        int Ci, unsigned short Cx, int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, int Ax, int Bp, 
+        int Bi, int Bx, int Cp, int Ci, int Cx, int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, unsigned int Ax, 
+        int Bp, int Bi, unsigned int Bx, int Cp, 
+        int Ci, unsigned int Cx, int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, long long Ax, 
+        int Bp, int Bi, long long Bx, int Cp, int Ci, 
+        long long Cx, int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, unsigned long long Ax, 
+        int Bp, int Bi, unsigned long long Bx, 
+        int Cp, int Ci, unsigned long long Cx, int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, float Ax, int Bp, 
+        int Bi, float Bx, int Cp, int Ci, float Cx, 
+        int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, double Ax, int Bp, 
+        int Bi, double Bx, int Cp, int Ci, double Cx, 
+        int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, long double Ax, 
+        int Bp, int Bi, long double Bx, int Cp, int Ci, 
+        long double Cx, int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, npy_cfloat_wrapper Ax, 
+        int Bp, int Bi, npy_cfloat_wrapper Bx, 
+        int Cp, int Ci, npy_cfloat_wrapper Cx, int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, npy_cdouble_wrapper Ax, 
+        int Bp, int Bi, npy_cdouble_wrapper Bx, 
+        int Cp, int Ci, npy_cdouble_wrapper Cx, 
+        int n_threads)
+    csc_matmat_pass2_threads(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
+        int Bp, int Bi, npy_clongdouble_wrapper Bx, 
+        int Cp, int Ci, npy_clongdouble_wrapper Cx, 
+        int n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        signed char Ax, long long Bp, long long Bi, 
+        signed char Bx, long long Cp, long long Ci, 
+        signed char Cx, long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned char Ax, long long Bp, long long Bi, 
+        unsigned char Bx, long long Cp, long long Ci, 
+        unsigned char Cx, long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        short Ax, long long Bp, long long Bi, 
+        short Bx, long long Cp, long long Ci, short Cx, 
+        long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned short Ax, long long Bp, long long Bi, 
+        unsigned short Bx, long long Cp, 
+        long long Ci, unsigned short Cx, long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        int Ax, long long Bp, long long Bi, 
+        int Bx, long long Cp, long long Ci, int Cx, 
+        long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned int Ax, long long Bp, long long Bi, 
+        unsigned int Bx, long long Cp, long long Ci, 
+        unsigned int Cx, long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long long Ax, long long Bp, long long Bi, 
+        long long Bx, long long Cp, long long Ci, 
+        long long Cx, long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned long long Ax, long long Bp, 
+        long long Bi, unsigned long long Bx, long long Cp, 
+        long long Ci, unsigned long long Cx, 
+        long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        float Ax, long long Bp, long long Bi, 
+        float Bx, long long Cp, long long Ci, float Cx, 
+        long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        double Ax, long long Bp, long long Bi, 
+        double Bx, long long Cp, long long Ci, double Cx, 
+        long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long double Ax, long long Bp, long long Bi, 
+        long double Bx, long long Cp, long long Ci, 
+        long double Cx, long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bi, npy_cfloat_wrapper Bx, long long Cp, 
+        long long Ci, npy_cfloat_wrapper Cx, 
+        long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Ci, npy_cdouble_wrapper Cx, 
+        long long n_threads)
+    csc_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Ci, npy_clongdouble_wrapper Cx, 
+        long long n_threads)
+    """
+  return _csc.csc_matmat_pass2_threads(*args)
+
 def csc_matvec(*args):
   """
     csc_matvec(int n_row, int n_col, int Ap, int Ai, signed char Ax, 
@@ -210,6 +532,41 @@ def csc_matvec(*args):
         npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
     csc_matvec(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        signed char Ax, signed char Xx, signed char Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned char Ax, unsigned char Xx, 
+        unsigned char Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        short Ax, short Xx, short Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned short Ax, unsigned short Xx, 
+        unsigned short Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        int Ax, int Xx, int Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned int Ax, unsigned int Xx, 
+        unsigned int Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long long Ax, long long Xx, long long Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned long long Ax, unsigned long long Xx, 
+        unsigned long long Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        float Ax, float Xx, float Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        double Ax, double Xx, double Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long double Ax, long double Xx, long double Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    csc_matvec(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
     """
   return _csc.csc_matvec(*args)
 
@@ -247,9 +604,215 @@ def csc_matvecs(*args):
     csc_matvecs(int n_row, int n_col, int n_vecs, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx, 
         npy_clongdouble_wrapper Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, signed char Ax, 
+        signed char Xx, signed char Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, short Ax, short Xx, 
+        short Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, int Ax, int Xx, 
+        int Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, long long Ax, long long Xx, 
+        long long Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, unsigned long long Ax, 
+        unsigned long long Xx, unsigned long long Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, float Ax, float Xx, 
+        float Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, double Ax, double Xx, 
+        double Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, long double Ax, 
+        long double Xx, long double Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    csc_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
     """
   return _csc.csc_matvecs(*args)
 
+def csc_matvec_threads(*args):
+  """
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, signed char Ax, 
+        signed char Xx, signed char Yx, int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx, int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, short Ax, short Xx, 
+        short Yx, int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx, int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, int Ax, int Xx, 
+        int Yx, int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx, int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, long long Ax, 
+        long long Xx, long long Yx, int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, unsigned long long Ax, 
+        unsigned long long Xx, unsigned long long Yx, 
+        int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, float Ax, float Xx, 
+        float Yx, int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, double Ax, double Xx, 
+        double Yx, int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, long double Ax, 
+        long double Xx, long double Yx, int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx, 
+        int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx, 
+        int n_threads)
+    csc_matvec_threads(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx, 
+        int n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        signed char Ax, signed char Xx, signed char Yx, 
+        long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned char Ax, unsigned char Xx, 
+        unsigned char Yx, long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        short Ax, short Xx, short Yx, long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned short Ax, unsigned short Xx, 
+        unsigned short Yx, long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        int Ax, int Xx, int Yx, long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned int Ax, unsigned int Xx, 
+        unsigned int Yx, long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long long Ax, long long Xx, long long Yx, 
+        long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned long long Ax, unsigned long long Xx, 
+        unsigned long long Yx, long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        float Ax, float Xx, float Yx, long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        double Ax, double Xx, double Yx, long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long double Ax, long double Xx, long double Yx, 
+        long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx, long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx, long long n_threads)
+    csc_matvec_threads(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx, 
+        long long n_threads)
+    """
+  return _csc.csc_matvec_threads(*args)
+
+def csc_matvecs_threads(*args):
+  """
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, signed char Ax, 
+        signed char Xx, signed char Yx, 
+        int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx, 
+        int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, short Ax, 
+        short Xx, short Yx, int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx, 
+        int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, int Ax, 
+        int Xx, int Yx, int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx, 
+        int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, long long Ax, 
+        long long Xx, long long Yx, int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, unsigned long long Ax, 
+        unsigned long long Xx, 
+        unsigned long long Yx, int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, float Ax, 
+        float Xx, float Yx, int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, double Ax, 
+        double Xx, double Yx, int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, long double Ax, 
+        long double Xx, long double Yx, 
+        int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx, int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx, int n_threads)
+    csc_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx, int n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, signed char Ax, 
+        signed char Xx, signed char Yx, long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx, long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, short Ax, short Xx, 
+        short Yx, long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx, long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, int Ax, int Xx, 
+        int Yx, long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx, long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, long long Ax, long long Xx, 
+        long long Yx, long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, unsigned long long Ax, 
+        unsigned long long Xx, unsigned long long Yx, 
+        long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, float Ax, float Xx, 
+        float Yx, long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, double Ax, double Xx, 
+        double Yx, long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, long double Ax, 
+        long double Xx, long double Yx, long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx, 
+        long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx, 
+        long long n_threads)
+    csc_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Ai, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx, 
+        long long n_threads)
+    """
+  return _csc.csc_matvecs_threads(*args)
+
 def csc_elmul_csc(*args):
   """
     csc_elmul_csc(int n_row, int n_col, int Ap, int Ai, signed char Ax, 
@@ -290,6 +853,58 @@ def csc_elmul_csc(*args):
     csc_elmul_csc(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx, 
         int Cp, int Ci, npy_clongdouble_wrapper Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        signed char Ax, long long Bp, long long Bi, 
+        signed char Bx, long long Cp, long long Ci, 
+        signed char Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned char Ax, long long Bp, long long Bi, 
+        unsigned char Bx, long long Cp, long long Ci, 
+        unsigned char Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        short Ax, long long Bp, long long Bi, 
+        short Bx, long long Cp, long long Ci, short Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned short Ax, long long Bp, long long Bi, 
+        unsigned short Bx, long long Cp, 
+        long long Ci, unsigned short Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        int Ax, long long Bp, long long Bi, 
+        int Bx, long long Cp, long long Ci, int Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned int Ax, long long Bp, long long Bi, 
+        unsigned int Bx, long long Cp, long long Ci, 
+        unsigned int Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long long Ax, long long Bp, long long Bi, 
+        long long Bx, long long Cp, long long Ci, 
+        long long Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned long long Ax, long long Bp, 
+        long long Bi, unsigned long long Bx, long long Cp, 
+        long long Ci, unsigned long long Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        float Ax, long long Bp, long long Bi, 
+        float Bx, long long Cp, long long Ci, float Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        double Ax, long long Bp, long long Bi, 
+        double Bx, long long Cp, long long Ci, double Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long double Ax, long long Bp, long long Bi, 
+        long double Bx, long long Cp, long long Ci, 
+        long double Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bi, npy_cfloat_wrapper Bx, long long Cp, 
+        long long Ci, npy_cfloat_wrapper Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Ci, npy_cdouble_wrapper Cx)
+    csc_elmul_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Ci, npy_clongdouble_wrapper Cx)
     """
   return _csc.csc_elmul_csc(*args)
 
@@ -333,6 +948,58 @@ def csc_eldiv_csc(*args):
     csc_eldiv_csc(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx, 
         int Cp, int Ci, npy_clongdouble_wrapper Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        signed char Ax, long long Bp, long long Bi, 
+        signed char Bx, long long Cp, long long Ci, 
+        signed char Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned char Ax, long long Bp, long long Bi, 
+        unsigned char Bx, long long Cp, long long Ci, 
+        unsigned char Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        short Ax, long long Bp, long long Bi, 
+        short Bx, long long Cp, long long Ci, short Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned short Ax, long long Bp, long long Bi, 
+        unsigned short Bx, long long Cp, 
+        long long Ci, unsigned short Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        int Ax, long long Bp, long long Bi, 
+        int Bx, long long Cp, long long Ci, int Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned int Ax, long long Bp, long long Bi, 
+        unsigned int Bx, long long Cp, long long Ci, 
+        unsigned int Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long long Ax, long long Bp, long long Bi, 
+        long long Bx, long long Cp, long long Ci, 
+        long long Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned long long Ax, long long Bp, 
+        long long Bi, unsigned long long Bx, long long Cp, 
+        long long Ci, unsigned long long Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        float Ax, long long Bp, long long Bi, 
+        float Bx, long long Cp, long long Ci, float Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        double Ax, long long Bp, long long Bi, 
+        double Bx, long long Cp, long long Ci, double Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long double Ax, long long Bp, long long Bi, 
+        long double Bx, long long Cp, long long Ci, 
+        long double Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bi, npy_cfloat_wrapper Bx, long long Cp, 
+        long long Ci, npy_cfloat_wrapper Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Ci, npy_cdouble_wrapper Cx)
+    csc_eldiv_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Ci, npy_clongdouble_wrapper Cx)
     """
   return _csc.csc_eldiv_csc(*args)
 
@@ -376,6 +1043,58 @@ def csc_plus_csc(*args):
     csc_plus_csc(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx, 
         int Cp, int Ci, npy_clongdouble_wrapper Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        signed char Ax, long long Bp, long long Bi, 
+        signed char Bx, long long Cp, long long Ci, 
+        signed char Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned char Ax, long long Bp, long long Bi, 
+        unsigned char Bx, long long Cp, long long Ci, 
+        unsigned char Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        short Ax, long long Bp, long long Bi, 
+        short Bx, long long Cp, long long Ci, short Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned short Ax, long long Bp, long long Bi, 
+        unsigned short Bx, long long Cp, 
+        long long Ci, unsigned short Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        int Ax, long long Bp, long long Bi, 
+        int Bx, long long Cp, long long Ci, int Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned int Ax, long long Bp, long long Bi, 
+        unsigned int Bx, long long Cp, long long Ci, 
+        unsigned int Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long long Ax, long long Bp, long long Bi, 
+        long long Bx, long long Cp, long long Ci, 
+        long long Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned long long Ax, long long Bp, 
+        long long Bi, unsigned long long Bx, long long Cp, 
+        long long Ci, unsigned long long Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        float Ax, long long Bp, long long Bi, 
+        float Bx, long long Cp, long long Ci, float Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        double Ax, long long Bp, long long Bi, 
+        double Bx, long long Cp, long long Ci, double Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long double Ax, long long Bp, long long Bi, 
+        long double Bx, long long Cp, long long Ci, 
+        long double Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bi, npy_cfloat_wrapper Bx, long long Cp, 
+        long long Ci, npy_cfloat_wrapper Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Ci, npy_cdouble_wrapper Cx)
+    csc_plus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Ci, npy_clongdouble_wrapper Cx)
     """
   return _csc.csc_plus_csc(*args)
 
@@ -419,6 +1138,147 @@ def csc_minus_csc(*args):
     csc_minus_csc(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx, 
         int Cp, int Ci, npy_clongdouble_wrapper Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        signed char Ax, long long Bp, long long Bi, 
+        signed char Bx, long long Cp, long long Ci, 
+        signed char Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned char Ax, long long Bp, long long Bi, 
+        unsigned char Bx, long long Cp, long long Ci, 
+        unsigned char Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        short Ax, long long Bp, long long Bi, 
+        short Bx, long long Cp, long long Ci, short Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned short Ax, long long Bp, long long Bi, 
+        unsigned short Bx, long long Cp, 
+        long long Ci, unsigned short Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        int Ax, long long Bp, long long Bi, 
+        int Bx, long long Cp, long long Ci, int Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned int Ax, long long Bp, long long Bi, 
+        unsigned int Bx, long long Cp, long long Ci, 
+        unsigned int Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long long Ax, long long Bp, long long Bi, 
+        long long Bx, long long Cp, long long Ci, 
+        long long Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        unsigned long long Ax, long long Bp, 
+        long long Bi, unsigned long long Bx, long long Cp, 
+        long long Ci, unsigned long long Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        float Ax, long long Bp, long long Bi, 
+        float Bx, long long Cp, long long Ci, float Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        double Ax, long long Bp, long long Bi, 
+        double Bx, long long Cp, long long Ci, double Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        long double Ax, long long Bp, long long Bi, 
+        long double Bx, long long Cp, long long Ci, 
+        long double Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bi, npy_cfloat_wrapper Bx, long long Cp, 
+        long long Ci, npy_cfloat_wrapper Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Ci, npy_cdouble_wrapper Cx)
+    csc_minus_csc(long long n_row, long long n_col, long long Ap, long long Ai, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Ci, npy_clongdouble_wrapper Cx)
     """
   return _csc.csc_minus_csc(*args)
 
+def csc_triangular_solve(*args):
+  """
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, signed char Ax, 
+        int lower, int unit_diagonal, int trans, 
+        signed char Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, unsigned char Ax, 
+        int lower, int unit_diagonal, int trans, 
+        unsigned char Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, short Ax, int lower, 
+        int unit_diagonal, int trans, short Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, unsigned short Ax, 
+        int lower, int unit_diagonal, int trans, 
+        unsigned short Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, int Ax, int lower, 
+        int unit_diagonal, int trans, int Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, unsigned int Ax, 
+        int lower, int unit_diagonal, int trans, 
+        unsigned int Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, long long Ax, 
+        int lower, int unit_diagonal, int trans, long long Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, unsigned long long Ax, 
+        int lower, int unit_diagonal, int trans, 
+        unsigned long long Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, float Ax, int lower, 
+        int unit_diagonal, int trans, float Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, double Ax, int lower, 
+        int unit_diagonal, int trans, double Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, long double Ax, 
+        int lower, int unit_diagonal, int trans, 
+        long double Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, npy_cfloat_wrapper Ax, 
+        int lower, int unit_diagonal, int trans, 
+        npy_cfloat_wrapper Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, npy_cdouble_wrapper Ax, 
+        int lower, int unit_diagonal, int trans, 
+        npy_cdouble_wrapper Yx) -> int
+    csc_triangular_solve(int n_row, int n_vecs, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
+        int lower, int unit_diagonal, 
+        int trans, npy_clongdouble_wrapper Yx) -> int
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        signed char Ax, long long lower, 
+        long long unit_diagonal, long long trans, signed char Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        unsigned char Ax, long long lower, 
+        long long unit_diagonal, long long trans, unsigned char Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        short Ax, long long lower, long long unit_diagonal, 
+        long long trans, short Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        unsigned short Ax, long long lower, 
+        long long unit_diagonal, long long trans, 
+        unsigned short Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        int Ax, long long lower, long long unit_diagonal, 
+        long long trans, int Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        unsigned int Ax, long long lower, 
+        long long unit_diagonal, long long trans, unsigned int Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        long long Ax, long long lower, long long unit_diagonal, 
+        long long trans, long long Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        unsigned long long Ax, long long lower, 
+        long long unit_diagonal, long long trans, 
+        unsigned long long Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        float Ax, long long lower, long long unit_diagonal, 
+        long long trans, float Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        double Ax, long long lower, long long unit_diagonal, 
+        long long trans, double Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        long double Ax, long long lower, 
+        long long unit_diagonal, long long trans, long double Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        npy_cfloat_wrapper Ax, long long lower, 
+        long long unit_diagonal, long long trans, 
+        npy_cfloat_wrapper Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        npy_cdouble_wrapper Ax, long long lower, 
+        long long unit_diagonal, long long trans, 
+        npy_cdouble_wrapper Yx) -> long long
+    csc_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Ai, 
+        npy_clongdouble_wrapper Ax, long long lower, 
+        long long unit_diagonal, long long trans, 
+        npy_clongdouble_wrapper Yx) -> long long
+    """
+  return _csc.csc_triangular_solve(*args)
+
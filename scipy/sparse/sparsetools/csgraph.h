@@ -2,11 +2,28 @@
 #define __CSGRAPH_H__
 
 #include <vector>
+#include <queue>
+#include <functional>
+#include <algorithm>
+
+#include "parallel.h"
+
+/*
+ * Graph algorithms on compressed sparse graphs
+ *
+ * A graph with n_nod nodes is stored as the CSR arrays (Ap, Aj) of its
+ * adjacency matrix: there is an edge i -> j for every entry j in row i.
+ * Every routine is linear in n_nod + nnz unless noted otherwise.
+ */
+
 
 /*
  * Determine connected compoments of a compressed sparse graph.
  * Note:
  *   Output array flag must be preallocated
+ *   The graph is assumed to be symmetric.  Nodes with empty rows get
+ *   flag -2, the others are labelled 0, 1, ... in the order of their
+ *   first node.
  */
 template <class I>
 I cs_graph_components(const I n_nod,
@@ -14,135 +31,745 @@ I cs_graph_components(const I n_nod,
 		      const I Aj[],
 		            I flag[])
 {
-  // pos is a work array: list of nodes (rows) to process.
-  std::vector<I> pos(n_nod,01);
+  // pos is a work array: queue of nodes (rows) to process.
+  std::vector<I> pos(n_nod);
   I n_comp = 0;
-  I n_tot, n_pos, n_pos_new, n_pos0, n_new, n_stop;
-  I icomp, ii, ir, ic;
 
-  n_stop = n_nod;
-  for (ir = 0; ir < n_nod; ir++) {
-    flag[ir] = -1;
-    if (Ap[ir+1] == Ap[ir]) {
-      n_stop--;
-      flag[ir] = -2;
-    }
+  for (I ir = 0; ir < n_nod; ir++) {
+    flag[ir] = (Ap[ir+1] == Ap[ir]) ? -2 : -1;
   }
 
-  n_tot = 0;
-  for (icomp = 0; icomp < n_nod; icomp++) {
-    // Find seed.
-    ii = 0;
-    while ((flag[ii] >= 0) || (flag[ii] == -2)) {
-      ii++;
-      if (ii >= n_nod) {
-	/* Sanity check, if this happens, the graph is corrupted. */
-	return -1;
-      }
-    }
+  // seeds are searched once, so the total cost is linear
+  for (I seed = 0; seed < n_nod; seed++) {
+    if (flag[seed] != -1) continue;
+
+    flag[seed] = n_comp;
+    pos[0] = seed;
+    I head = 0, tail = 1;
 
-    flag[ii] = icomp;
-    pos[0] = ii;
-    n_pos0 = 0;
-    n_pos_new = n_pos = 1;
-
-    for (ii = 0; ii < n_nod; ii++) {
-      n_new = 0;
-      for (ir = n_pos0; ir < n_pos; ir++) {
-	for (ic = Ap[pos[ir]]; ic < Ap[pos[ir]+1]; ic++) {
-	  if (flag[Aj[ic]] == -1) {
-	    flag[Aj[ic]] = icomp;
-	    pos[n_pos_new] = Aj[ic];
-	    n_pos_new++;
-	    n_new++;
-	  }
+    while (head < tail) {
+      const I ir = pos[head++];
+      for (I ic = Ap[ir]; ic < Ap[ir+1]; ic++) {
+	if (flag[Aj[ic]] == -1) {
+	  flag[Aj[ic]] = n_comp;
+	  pos[tail++] = Aj[ic];
 	}
       }
-      n_pos0 = n_pos;
-      n_pos = n_pos_new;
-      if (n_new == 0) break;
-    }
-    n_tot += n_pos;
-
-    if (n_tot == n_stop) {
-      n_comp = icomp + 1;
-      break;
     }
+    n_comp++;
   }
 
   return n_comp;
 }
 
-#endif
-#ifndef __CSGRAPH_H__
-#define __CSGRAPH_H__
 
-#include <vector>
+/*
+ * Root of node i in a union-find forest, with path halving
+ */
+template <class I>
+I cs_graph_find(I parent[], I i)
+{
+    while(parent[i] != i){
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
 
 /*
- * Determine connected compoments of a compressed sparse graph.
+ * Join the trees of nodes i and j.  The smaller root becomes the root
+ * of the union, so no node has a larger parent than itself.
+ */
+template <class I>
+void cs_graph_union(I parent[], const I i, const I j)
+{
+    const I ri = cs_graph_find(parent, i);
+    const I rj = cs_graph_find(parent, j);
+    if(ri < rj){
+        parent[rj] = ri;
+    } else if(rj < ri){
+        parent[ri] = rj;
+    }
+}
+
+
+/*
+ * Weakly connected components of a compressed sparse graph
+ *
+ * Input Arguments:
+ *   I  n_nod           - number of nodes
+ *   I  Ap[n_nod+1]     - row pointer
+ *   I  Aj[nnz]         - column indices
+ *   I  n_threads       - number of threads (<= 0 means the default)
+ *
+ * Output Arguments:
+ *   I  labels[n_nod]   - component of each node
+ *
+ * Returns:
+ *   The number of components
+ *
  * Note:
- *   Output array flag must be preallocated
+ *   Edge directions are ignored.  Components are numbered in the order
+ *   of their smallest node, for any number of threads.
+ *
+ *   Uses union-find.  Each thread builds a forest of the edges in its
+ *   chunk of rows, and the forests are then merged into the first one.
+ *   Every thread needs n_nod temporary entries, so the thread count is
+ *   reduced until each chunk holds about n_nod edges.
+ *
+ *   Complexity: O((nnz + n_nod * n_threads) * log(n_nod)) at worst,
+ *   close to linear in practice
+ *
  */
 template <class I>
-I cs_graph_components(const I n_nod,
-		      const I Ap[],
-		      const I Aj[],
-		            I flag[])
+I cs_graph_connected_components(const I n_nod,
+                                const I Ap[],
+                                const I Aj[],
+                                      I labels[],
+                                const I n_threads)
 {
-  // pos is a work array: list of nodes (rows) to process.
-  std::vector<I> pos(n_nod,01);
-  I n_comp;
-  I n_tot, n_pos, n_pos_new, n_pos0, n_new, n_stop;
-  I icomp, ii, ir, ic;
-
-  n_stop = n_nod;
-  for (ir = 0; ir < n_nod; ir++) {
-    flag[ir] = -1;
-    if ((Ap[ir+1] - Ap[ir]) == 0) n_stop--;
-  }
+    const I nnz = Ap[n_nod] - Ap[0];
 
-  n_tot = 0;
-  for (icomp = 0; icomp < n_nod; icomp++) {
-    // Find seed.
-    ii = 0;
-    while (flag[ii] >= 0) {
-      ii++;
-      if (ii >= n_nod) {
-	/* Sanity check, if this happens, the graph is corrupted. */
-	return -1;
-      }
+    I t = sparsetools_num_threads(n_threads, n_nod);
+    t = std::max((I) 1, std::min(t, nnz / std::max(n_nod, (I) 1)));
+
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_nod, Ap, t, &bounds[0]);
+
+    // thread 0 builds its forest in labels
+    std::vector<I> forests((std::size_t)(t - 1) * n_nod);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        I * parent = (p == 0) ? labels : &forests[(std::size_t)(p - 1) * n_nod];
+        for(I i = 0; i < n_nod; i++){
+            parent[i] = i;
+        }
+        for(I i = bounds[p]; i < bounds[p+1]; i++){
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                cs_graph_union(parent, i, Aj[jj]);
+            }
+        }
     }
-    flag[ii] = icomp;
-    pos[0] = ii;
-    n_pos0 = 0;
-    n_pos_new = n_pos = 1;
-
-    for (ii = 0; ii < n_nod; ii++) {
-      n_new = 0;
-      for (ir = n_pos0; ir < n_pos; ir++) {
-	for (ic = Ap[pos[ir]]; ic < Ap[pos[ir]+1]; ic++) {
-	  if (flag[Aj[ic]] == -1) {
-	    flag[Aj[ic]] = icomp;
-	    pos[n_pos_new] = Aj[ic];
-	    n_pos_new++;
-	    n_new++;
-	  }
-	}
-      }
-      n_pos0 = n_pos;
-      n_pos = n_pos_new;
-      if (n_new == 0) break;
+
+    for(I p = 1; p < t; p++){
+        const I * parent = &forests[(std::size_t)(p - 1) * n_nod];
+        for(I i = 0; i < n_nod; i++){
+            if(parent[i] != i){
+                cs_graph_union(labels, i, parent[i]);
+            }
+        }
     }
-    n_tot += n_pos;
 
-    if (n_tot == n_stop) {
-      n_comp = icomp + 1;
-      break;
+    // parents are never larger than their children, so the parent of
+    // node i already holds its component label when i is reached
+    I n_comp = 0;
+    for(I i = 0; i < n_nod; i++){
+        const I parent = labels[i];
+        labels[i] = (parent == i) ? n_comp++ : labels[parent];
     }
-  }
 
-  return n_comp;
+    return n_comp;
+}
+
+
+/*
+ * Strongly connected components of a compressed sparse graph
+ *
+ * Input Arguments:
+ *   I  n_nod           - number of nodes
+ *   I  Ap[n_nod+1]     - row pointer
+ *   I  Aj[nnz]         - column indices
+ *
+ * Output Arguments:
+ *   I  labels[n_nod]   - component of each node
+ *
+ * Returns:
+ *   The number of components
+ *
+ * Note:
+ *   Tarjan's algorithm with an explicit stack, so deep graphs cannot
+ *   overflow the call stack.  Components are numbered in reverse
+ *   topological order: an edge between two components always goes
+ *   from the higher label to the lower one.
+ *
+ */
+template <class I>
+I cs_graph_strong_components(const I n_nod,
+                             const I Ap[],
+                             const I Aj[],
+                                   I labels[])
+{
+    std::vector<I> index(n_nod, -1);
+    std::vector<I> lowlink(n_nod);
+    std::vector<char> on_stack(n_nod, 0);
+    std::vector<I> stack;
+    std::vector<I> call_node, call_edge;   // the DFS call stack
+
+    I counter = 0;
+    I n_comp  = 0;
+
+    for(I root = 0; root < n_nod; root++){
+        if(index[root] != -1) continue;
+
+        index[root] = lowlink[root] = counter++;
+        stack.push_back(root);
+        on_stack[root] = 1;
+        call_node.push_back(root);
+        call_edge.push_back(Ap[root]);
+
+        while(!call_node.empty()){
+            const I v  = call_node.back();
+            const I jj = call_edge.back();
+
+            if(jj < Ap[v+1]){
+                const I w = Aj[jj];
+                call_edge.back()++;
+                if(index[w] == -1){
+                    index[w] = lowlink[w] = counter++;
+                    stack.push_back(w);
+                    on_stack[w] = 1;
+                    call_node.push_back(w);
+                    call_edge.push_back(Ap[w]);
+                } else if(on_stack[w]){
+                    lowlink[v] = std::min(lowlink[v], index[w]);
+                }
+                continue;
+            }
+
+            call_node.pop_back();
+            call_edge.pop_back();
+
+            if(lowlink[v] == index[v]){
+                I w;
+                do {
+                    w = stack.back();
+                    stack.pop_back();
+                    on_stack[w] = 0;
+                    labels[w] = n_comp;
+                } while(w != v);
+                n_comp++;
+            }
+
+            if(!call_node.empty()){
+                const I u = call_node.back();
+                lowlink[u] = std::min(lowlink[u], lowlink[v]);
+            }
+        }
+    }
+
+    return n_comp;
+}
+
+
+/*
+ * Breadth-first traversal of a compressed sparse graph
+ *
+ * Input Arguments:
+ *   I  n_nod                - number of nodes
+ *   I  Ap[n_nod+1]          - row pointer
+ *   I  Aj[nnz]              - column indices
+ *   I  i_start              - first node
+ *
+ * Output Arguments:
+ *   I  order[n_nod]         - nodes in the order they are reached
+ *   I  predecessors[n_nod]  - node from which each node was reached
+ *   I  levels[n_nod]        - number of edges from i_start
+ *
+ * Returns:
+ *   The number of nodes reached, which are order[0] to order[n-1]
+ *
+ * Note:
+ *   Nodes that are not reached (and i_start) have predecessor -1 and
+ *   level -1 (level 0 for i_start).  Neighbours are visited in the
+ *   order of the column indices.
+ *
+ */
+template <class I>
+I cs_graph_breadth_first(const I n_nod,
+                         const I Ap[],
+                         const I Aj[],
+                         const I i_start,
+                               I order[],
+                               I predecessors[],
+                               I levels[])
+{
+    std::fill(predecessors, predecessors + n_nod, -1);
+    std::fill(levels, levels + n_nod, -1);
+
+    levels[i_start] = 0;
+    order[0] = i_start;
+    I head = 0, tail = 1;
+
+    while(head < tail){
+        const I i = order[head++];
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            const I j = Aj[jj];
+            if(levels[j] == -1){
+                levels[j] = levels[i] + 1;
+                predecessors[j] = i;
+                order[tail++] = j;
+            }
+        }
+    }
+
+    return tail;
+}
+
+
+/*
+ * Depth-first traversal of a compressed sparse graph
+ *
+ * Input Arguments:
+ *   I  n_nod                - number of nodes
+ *   I  Ap[n_nod+1]          - row pointer
+ *   I  Aj[nnz]              - column indices
+ *   I  i_start              - first node
+ *
+ * Output Arguments:
+ *   I  order[n_nod]         - nodes in preorder
+ *   I  predecessors[n_nod]  - node from which each node was reached
+ *
+ * Returns:
+ *   The number of nodes reached, which are order[0] to order[n-1]
+ *
+ * Note:
+ *   Nodes that are not reached (and i_start) have predecessor -1.
+ *   The order is that of the recursive algorithm visiting neighbours
+ *   in the order of the column indices, but uses an explicit stack.
+ *
+ */
+template <class I>
+I cs_graph_depth_first(const I n_nod,
+                       const I Ap[],
+                       const I Aj[],
+                       const I i_start,
+                             I order[],
+                             I predecessors[])
+{
+    std::fill(predecessors, predecessors + n_nod, -1);
+    std::vector<char> visited(n_nod, 0);
+    std::vector<I> stack_node, stack_edge;
+
+    I n_reached = 0;
+    visited[i_start] = 1;
+    order[n_reached++] = i_start;
+    stack_node.push_back(i_start);
+    stack_edge.push_back(Ap[i_start]);
+
+    while(!stack_node.empty()){
+        const I i = stack_node.back();
+        I jj = stack_edge.back();
+
+        while(jj < Ap[i+1] && visited[Aj[jj]]){
+            jj++;
+        }
+
+        if(jj == Ap[i+1]){
+            stack_node.pop_back();
+            stack_edge.pop_back();
+            continue;
+        }
+
+        const I j = Aj[jj];
+        stack_edge.back() = jj + 1;
+
+        visited[j] = 1;
+        predecessors[j] = i;
+        order[n_reached++] = j;
+        stack_node.push_back(j);
+        stack_edge.push_back(Ap[j]);
+    }
+
+    return n_reached;
+}
+
+
+/*
+ * Single source shortest paths in a compressed sparse graph with
+ * nonnegative edge weights (Dijkstra's algorithm)
+ *
+ * Input Arguments:
+ *   I  n_nod                - number of nodes
+ *   I  Ap[n_nod+1]          - row pointer
+ *   I  Aj[nnz]              - column indices
+ *   T  Ax[nnz]              - edge weights
+ *   I  i_start              - source node
+ *
+ * Output Arguments:
+ *   T  dist[n_nod]          - length of the shortest path to each node
+ *   I  predecessors[n_nod]  - previous node on that path
+ *
+ * Returns:
+ *   The number of nodes reached
+ *
+ * Note:
+ *   dist must be preallocated.  Entries of nodes that are not reached
+ *   are left unchanged, so callers typically fill dist with infinity.
+ *   Nodes that are not reached (and i_start) have predecessor -1.
+ *
+ *   Uses a binary heap with lazy deletion, so it holds at most
+ *   nnz + 1 entries.
+ *
+ *   Complexity: O((n_nod + nnz) * log(nnz))
+ *
+ */
+template <class I, class T>
+I cs_graph_dijkstra(const I n_nod,
+                    const I Ap[],
+                    const I Aj[],
+                    const T Ax[],
+                    const I i_start,
+                          T dist[],
+                          I predecessors[])
+{
+    typedef std::pair<T,I> entry;
+    std::priority_queue< entry, std::vector<entry>, std::greater<entry> > heap;
+
+    std::fill(predecessors, predecessors + n_nod, -1);
+    std::vector<char> reached(n_nod, 0), done(n_nod, 0);
+
+    I n_reached = 1;
+    reached[i_start] = 1;
+    dist[i_start] = 0;
+    heap.push(entry(dist[i_start], i_start));
+
+    while(!heap.empty()){
+        const I i = heap.top().second;
+        heap.pop();
+        if(done[i]) continue;
+        done[i] = 1;
+
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            const I j = Aj[jj];
+            const T d = dist[i] + Ax[jj];
+            if(!reached[j] || d < dist[j]){
+                if(!reached[j]){
+                    reached[j] = 1;
+                    n_reached++;
+                }
+                dist[j] = d;
+                predecessors[j] = i;
+                heap.push(entry(d, j));
+            }
+        }
+    }
+
+    return n_reached;
+}
+
+
+/*
+ * Breadth-first level structure rooted at node root, restricted to the
+ * nodes i with region[i] == r
+ *
+ * Nodes are visited if mark[i] != stamp, and are then marked with stamp;
+ * giving every search a new stamp avoids clearing mark.  On return
+ * order[level_ptr[k]] to order[level_ptr[k+1]-1] are the nodes of level k,
+ * and level_ptr[n_levels] is the number of nodes reached.
+ *
+ * Returns the number of levels.
+ */
+template <class I>
+I cs_graph_level_structure(const I Ap[],
+                           const I Aj[],
+                           const I region[],
+                           const I r,
+                           const I root,
+                                 I mark[],
+                           const I stamp,
+                                 I order[],
+                                 I level_ptr[])
+{
+    mark[root] = stamp;
+    order[0] = root;
+    level_ptr[0] = 0;
+
+    I n_levels = 0;
+    I head = 0, tail = 1;
+
+    while(head < tail){
+        level_ptr[++n_levels] = tail;
+        const I level_end = tail;
+        for(; head < level_end; head++){
+            const I i = order[head];
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                const I j = Aj[jj];
+                if(mark[j] != stamp && region[j] == r){
+                    mark[j] = stamp;
+                    order[tail++] = j;
+                }
+            }
+        }
+    }
+    level_ptr[n_levels] = tail;
+
+    return n_levels;
+}
+
+
+/*
+ * Find a node of large eccentricity in the part of region r that
+ * contains root (George and Liu's pseudo-peripheral node finder).
+ *
+ * Starting from root, repeatedly moves to a node of smallest degree in
+ * the last level while that makes the level structure deeper.  On
+ * return order, level_ptr and n_levels hold the level structure of the
+ * returned node, and stamp has been advanced past the stamps used.
+ */
+template <class I>
+I cs_graph_pseudo_peripheral_node(const I Ap[],
+                                  const I Aj[],
+                                  const I degree[],
+                                  const I region[],
+                                  const I r,
+                                        I root,
+                                        I mark[],
+                                        I &stamp,
+                                        I order[],
+                                        I level_ptr[],
+                                        I &n_levels)
+{
+    n_levels = cs_graph_level_structure(Ap, Aj, region, r, root,
+                                        mark, stamp++, order, level_ptr);
+
+    for(;;){
+        I best = order[level_ptr[n_levels - 1]];
+        for(I k = level_ptr[n_levels - 1]; k < level_ptr[n_levels]; k++){
+            if(degree[order[k]] < degree[best]){
+                best = order[k];
+            }
+        }
+
+        // the eccentricity of best is at least that of root
+        const I depth = n_levels;
+        n_levels = cs_graph_level_structure(Ap, Aj, region, r, best,
+                                            mark, stamp++, order, level_ptr);
+        if(n_levels <= depth){
+            return best;
+        }
+        root = best;
+    }
+}
+
+
+/*
+ * Number of neighbours of each node, not counting self loops
+ */
+template <class I>
+void cs_graph_degrees(const I n_nod,
+                      const I Ap[],
+                      const I Aj[],
+                            I degree[])
+{
+    for(I i = 0; i < n_nod; i++){
+        degree[i] = 0;
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            if(Aj[jj] != i){
+                degree[i]++;
+            }
+        }
+    }
+}
+
+template <class I>
+struct cs_graph_degree_less {
+    const I * degree;
+    cs_graph_degree_less(const I * d) : degree(d) {}
+    bool operator()(const I a, const I b) const {
+        return degree[a] < degree[b] || (degree[a] == degree[b] && a < b);
+    }
+};
+
+
+/*
+ * Reverse Cuthill-McKee ordering of a compressed sparse graph
+ *
+ * Input Arguments:
+ *   I  n_nod           - number of nodes
+ *   I  Ap[n_nod+1]     - row pointer
+ *   I  Aj[nnz]         - column indices
+ *
+ * Output Arguments:
+ *   I  perm[n_nod]     - node placed at each position
+ *
+ * Note:
+ *   The graph must be symmetric.  Renumbering the nodes so that node
+ *   perm[k] becomes node k gives a matrix of small bandwidth.
+ *
+ *   Each component is numbered by a breadth-first search from a
+ *   pseudo-peripheral node, visiting the neighbours of a node in order
+ *   of increasing degree, and the whole numbering is then reversed.
+ *
+ *   Complexity: O(n_nod + nnz) for each step of the pseudo-peripheral
+ *   node search (usually a few), plus sorting the neighbours by degree.
+ *
+ */
+template <class I>
+void cs_graph_reverse_cuthill_mckee(const I n_nod,
+                                    const I Ap[],
+                                    const I Aj[],
+                                          I perm[])
+{
+    if(n_nod == 0) return;
+
+    std::vector<I> degree(n_nod), region(n_nod, 0), mark(n_nod, -1);
+    std::vector<I> order(n_nod), level_ptr(n_nod + 1);
+    cs_graph_degrees(n_nod, Ap, Aj, &degree[0]);
+
+    const cs_graph_degree_less<I> by_degree(&degree[0]);
+    I stamp = 0;
+    I n_done = 0;
+
+    for(I seed = 0; seed < n_nod; seed++){
+        // numbered nodes are moved out of region 0
+        if(region[seed] != 0) continue;
+
+        I n_levels;
+        const I start = cs_graph_pseudo_peripheral_node(Ap, Aj, &degree[0],
+                                &region[0], (I) 0, seed, &mark[0], stamp,
+                                &order[0], &level_ptr[0], n_levels);
+
+        // Cuthill-McKee numbering of the component
+        const I first = n_done;
+        perm[n_done++] = start;
+        region[start] = 1;
+        for(I head = first; head < n_done; head++){
+            const I i = perm[head];
+            const I tail = n_done;
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                const I j = Aj[jj];
+                if(region[j] == 0){
+                    region[j] = 1;
+                    perm[n_done++] = j;
+                }
+            }
+            std::sort(perm + tail, perm + n_done, by_degree);
+        }
+    }
+
+    std::reverse(perm, perm + n_nod);
+}
+
+
+/*
+ * Nested dissection ordering of a compressed sparse graph
+ *
+ * Input Arguments:
+ *   I  n_nod           - number of nodes
+ *   I  Ap[n_nod+1]     - row pointer
+ *   I  Aj[nnz]         - column indices
+ *
+ * Output Arguments:
+ *   I  perm[n_nod]     - node placed at each position
+ *
+ * Note:
+ *   The graph must be symmetric.  Renumbering the nodes so that node
+ *   perm[k] becomes node k reduces the fill of a Cholesky or LU
+ *   factorisation.
+ *
+ *   The graph is split recursively by the middle level of a level
+ *   structure rooted at a pseudo-peripheral node.  The separator is
+ *   numbered after the two parts, which are split in turn until they
+ *   have no more than 32 nodes or are too shallow to split; those are
+ *   numbered in breadth-first order.  Disconnected parts are split
+ *   into their components first.
+ *
+ *   Complexity: O((n_nod + nnz) * depth) where the depth of the
+ *   dissection is usually O(log(n_nod))
+ *
+ */
+template <class I>
+void cs_graph_nested_dissection(const I n_nod,
+                                const I Ap[],
+                                const I Aj[],
+                                      I perm[])
+{
+    if(n_nod == 0) return;
+
+    const I leaf_size = 32;
+
+    std::vector<I> degree(n_nod), region(n_nod, 0), mark(n_nod, -1);
+    std::vector<I> order(n_nod), level_ptr(n_nod + 1);
+    cs_graph_degrees(n_nod, Ap, Aj, &degree[0]);
+
+    for(I i = 0; i < n_nod; i++){
+        perm[i] = i;
+    }
+
+    // ranges of perm still to be ordered, each holding one region
+    std::vector< std::pair<I,I> > ranges(1, std::make_pair((I) 0, n_nod));
+
+    I stamp = 0;
+    I n_regions = 1;
+
+    while(!ranges.empty()){
+        const I b = ranges.back().first;
+        const I e = ranges.back().second;
+        ranges.pop_back();
+
+        const I r = region[perm[b]];
+
+        I n_levels;
+        cs_graph_pseudo_peripheral_node(Ap, Aj, &degree[0], &region[0], r,
+                                        perm[b], &mark[0], stamp,
+                                        &order[0], &level_ptr[0], n_levels);
+        const I n_reached = level_ptr[n_levels];
+
+        if(n_reached < e - b){
+            // split off the component, which was marked with stamp - 1
+            I n = b;
+            for(I k = b; k < e; k++){
+                if(mark[perm[k]] == stamp - 1){
+                    std::swap(perm[n++], perm[k]);
+                }
+            }
+            for(I k = n; k < e; k++){
+                region[perm[k]] = n_regions;
+            }
+            n_regions++;
+            ranges.push_back(std::make_pair(n, e));
+            ranges.push_back(std::make_pair(b, n));
+            continue;
+        }
+
+        if(e - b <= leaf_size || n_levels < 3){
+            std::copy(order.begin(), order.begin() + n_reached, perm + b);
+            continue;
+        }
+
+        // separator: the level holding the median node, leaving both
+        // parts nonempty
+        I m = 1;
+        while(m < n_levels - 2 && level_ptr[m+1] <= n_reached / 2){
+            m++;
+        }
+
+        // parts A (levels < m) and B (levels > m), then the separator
+        I * out = perm + b;
+        out = std::copy(order.begin(), order.begin() + level_ptr[m], out);
+        out = std::copy(order.begin() + level_ptr[m+1],
+                        order.begin() + n_reached, out);
+        std::copy(order.begin() + level_ptr[m],
+                  order.begin() + level_ptr[m+1], out);
+
+        const I a_end = b + level_ptr[m];
+        const I b_end = a_end + (n_reached - level_ptr[m+1]);
+
+        for(I k = b; k < a_end; k++){
+            region[perm[k]] = n_regions;
+        }
+        for(I k = a_end; k < b_end; k++){
+            region[perm[k]] = n_regions + 1;
+        }
+        for(I k = b_end; k < e; k++){
+            region[perm[k]] = -1;
+        }
+        n_regions += 2;
+
+        ranges.push_back(std::make_pair(a_end, b_end));
+        ranges.push_back(std::make_pair(b, a_end));
+    }
 }
 
 #endif
@@ -10,15 +10,13 @@
 %include "csgraph.h" 
 
 INSTANTIATE_INDEX(cs_graph_components)
-/* -*- C -*- */
-%module csgraph
-
-%include "sparsetools.i"
-
-%{
-#include "csgraph.h"
-%}
-
-%include "csgraph.h" 
-
-INSTANTIATE_INDEX(cs_graph_components)
+INSTANTIATE_INDEX(cs_graph_connected_components)
+INSTANTIATE_INDEX(cs_graph_strong_components)
+INSTANTIATE_INDEX(cs_graph_breadth_first)
+INSTANTIATE_INDEX(cs_graph_depth_first)
+INSTANTIATE_INDEX(cs_graph_reverse_cuthill_mckee)
+INSTANTIATE_INDEX(cs_graph_nested_dissection)
+
+/* edge weights must be ordered, so only real weights are supported */
+%template(cs_graph_dijkstra)   cs_graph_dijkstra<int,double>;
+%template(cs_graph_dijkstra)   cs_graph_dijkstra<long long,double>;
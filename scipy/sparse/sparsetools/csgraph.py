@@ -67,8 +67,68 @@ except AttributeError:
 
 
 
+
 def cs_graph_components(*args):
-  """cs_graph_components(int n_nod, int Ap, int Aj, int flag) -> int"""
+  """
+    cs_graph_components(int n_nod, int Ap, int Aj, int flag) -> int
+    cs_graph_components(long long n_nod, long long Ap, long long Aj, long long flag) -> long long
+    """
   return _csgraph.cs_graph_components(*args)
 
+def cs_graph_connected_components(*args):
+  """
+    cs_graph_connected_components(int n_nod, int Ap, int Aj, int labels, int n_threads) -> int
+    cs_graph_connected_components(long long n_nod, long long Ap, long long Aj, long long labels, 
+        long long n_threads) -> long long
+    """
+  return _csgraph.cs_graph_connected_components(*args)
+
+def cs_graph_strong_components(*args):
+  """
+    cs_graph_strong_components(int n_nod, int Ap, int Aj, int labels) -> int
+    cs_graph_strong_components(long long n_nod, long long Ap, long long Aj, long long labels) -> long long
+    """
+  return _csgraph.cs_graph_strong_components(*args)
+
+def cs_graph_breadth_first(*args):
+  """
+    cs_graph_breadth_first(int n_nod, int Ap, int Aj, int i_start, int order, 
+        int predecessors, int levels) -> int
+    cs_graph_breadth_first(long long n_nod, long long Ap, long long Aj, long long i_start, 
+        long long order, long long predecessors, 
+        long long levels) -> long long
+    """
+  return _csgraph.cs_graph_breadth_first(*args)
+
+def cs_graph_depth_first(*args):
+  """
+    cs_graph_depth_first(int n_nod, int Ap, int Aj, int i_start, int order, 
+        int predecessors) -> int
+    cs_graph_depth_first(long long n_nod, long long Ap, long long Aj, long long i_start, 
+        long long order, long long predecessors) -> long long
+    """
+  return _csgraph.cs_graph_depth_first(*args)
+
+def cs_graph_reverse_cuthill_mckee(*args):
+  """
+    cs_graph_reverse_cuthill_mckee(int n_nod, int Ap, int Aj, int perm)
+    cs_graph_reverse_cuthill_mckee(long long n_nod, long long Ap, long long Aj, long long perm)
+    """
+  return _csgraph.cs_graph_reverse_cuthill_mckee(*args)
+
+def cs_graph_nested_dissection(*args):
+  """
+    cs_graph_nested_dissection(int n_nod, int Ap, int Aj, int perm)
+    cs_graph_nested_dissection(long long n_nod, long long Ap, long long Aj, long long perm)
+    """
+  return _csgraph.cs_graph_nested_dissection(*args)
+
+def cs_graph_dijkstra(*args):
+  """
+    cs_graph_dijkstra(int n_nod, int Ap, int Aj, double Ax, int i_start, 
+        double dist, int predecessors) -> int
+    cs_graph_dijkstra(long long n_nod, long long Ap, long long Aj, double Ax, 
+        long long i_start, double dist, long long predecessors) -> long long
+    """
+  return _csgraph.cs_graph_dijkstra(*args)
 
@@ -7,6 +7,7 @@
 #include <functional>
 
 #include "dense.h"
+#include "parallel.h"
 
 /*
  * Extract main diagonal of CSR matrix A
@@ -342,6 +343,139 @@ void csr_sort_indices(const I n_row,
     }    
 }
 
+/*
+ * Multithreaded csr_sort_indices
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows in A
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   T  Ax[nnz(A)]      - nonzeros 
+ *   I  n_threads       - number of threads (<= 0 means the default)
+ *
+ * Note:
+ *   Short rows are insertion sorted in place.  Longer rows are sorted
+ *   through one scratch buffer per thread, so nothing is allocated per
+ *   row.  The result matches csr_sort_indices when no row contains
+ *   duplicate column indices.
+ *
+ */
+template<class I, class T>
+void csr_sort_indices_threads(const I n_row,
+                              const I Ap[], 
+                                    I Aj[], 
+                                    T Ax[],
+                              const I n_threads)
+{
+    const I t = sparsetools_num_threads(n_threads, n_row);
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_row, Ap, t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        std::vector< std::pair<I,T> > temp;
+
+        for(I i = bounds[p]; i < bounds[p+1]; i++){
+            const I row_start = Ap[i];
+            const I row_end   = Ap[i+1];
+
+            if(row_end - row_start <= 16){
+                for(I jj = row_start + 1; jj < row_end; jj++){
+                    const I j = Aj[jj];
+                    const T x = Ax[jj];
+                    I kk = jj;
+                    while(kk > row_start && Aj[kk-1] > j){
+                        Aj[kk] = Aj[kk-1];
+                        Ax[kk] = Ax[kk-1];
+                        kk--;
+                    }
+                    Aj[kk] = j;
+                    Ax[kk] = x;
+                }
+                continue;
+            }
+
+            temp.clear();
+            for(I jj = row_start; jj < row_end; jj++){
+                temp.push_back(std::make_pair(Aj[jj],Ax[jj]));
+            }
+
+            std::sort(temp.begin(),temp.end(),kv_pair_less<I,T>);
+
+            for(I jj = row_start, n = 0; jj < row_end; jj++, n++){
+                Aj[jj] = temp[n].first;
+                Ax[jj] = temp[n].second;
+            }
+        }
+    }
+}
+
+
+/*
+ * Compute B = P*A*P^T for square CSR matrix A and permutation matrix P,
+ * that is B[k,l] = A[perm[k],perm[l]]
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows (and columns) in A
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   T  Ax[nnz(A)]      - nonzeros
+ *   I  perm[n_row]     - row and column of A placed at each position
+ *   I  n_threads       - number of threads (<= 0 means the default)
+ *
+ * Output Arguments:
+ *   I  Bp[n_row+1]     - row pointer
+ *   I  Bj[nnz(A)]      - column indices
+ *   T  Bx[nnz(A)]      - nonzeros
+ *
+ * Note:
+ *   Output arrays Bp, Bj, Bx must be preallocated
+ *   Rows of B have sorted indices.  For a CSC matrix A the same call
+ *   computes the CSC form of P*A*P^T.
+ *
+ *   Complexity: Linear, plus sorting the rows of B
+ *
+ */
+template <class I, class T>
+void csr_symmetric_permute(const I n_row,
+                           const I Ap[],
+                           const I Aj[],
+                           const T Ax[],
+                           const I perm[],
+                                 I Bp[],
+                                 I Bj[],
+                                 T Bx[],
+                           const I n_threads)
+{
+    std::vector<I> iperm(n_row);
+    for(I k = 0; k < n_row; k++){
+        iperm[perm[k]] = k;
+    }
+
+    Bp[0] = 0;
+    for(I k = 0; k < n_row; k++){
+        Bp[k+1] = Bp[k] + (Ap[perm[k]+1] - Ap[perm[k]]);
+    }
+
+    const I t = sparsetools_num_threads(n_threads, n_row);
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_row, Bp, t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        for(I k = bounds[p]; k < bounds[p+1]; k++){
+            const I i = perm[k];
+            I n = Bp[k];
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++, n++){
+                Bj[n] = iperm[Aj[jj]];
+                Bx[n] = Ax[jj];
+            }
+        }
+    }
+
+    csr_sort_indices_threads(n_row, Bp, Bj, Bx, n_threads);
+}
+
 
 
 
@@ -422,6 +556,103 @@ void csr_tocsc(const I n_row,
 }   
 
 
+/*
+ * Compute B = A for CSR matrix A, CSC matrix B using up to n_threads
+ * threads.  See csr_tocsc.
+ *
+ * Input Arguments:
+ *   I  n_row         - number of rows in A
+ *   I  n_col         - number of columns in A
+ *   I  Ap[n_row+1]   - row pointer
+ *   I  Aj[nnz(A)]    - column indices
+ *   T  Ax[nnz(A)]    - nonzeros
+ *   I  n_threads     - number of threads (<= 0 means the default)
+ *
+ * Output Arguments:
+ *   I  Bp[n_col+1] - column pointer
+ *   I  Bj[nnz(A)]  - row indices
+ *   T  Bx[nnz(A)]  - nonzeros
+ *
+ * Note:
+ *   The rows are split into balanced chunks, one per thread.  Each
+ *   thread counts the columns of its chunk, the counts are turned into
+ *   per-(column, thread) write offsets, and each thread scatters its own
+ *   rows.  Chunks are in row order, so the output is the same as that
+ *   of csr_tocsc for any thread count.
+ *
+ *   Every thread needs a histogram of n_col entries, so the thread
+ *   count is reduced until each chunk holds about n_col entries.
+ *
+ *   Complexity: Linear.  Specifically O(nnz(A) + n_row + n_col * n_threads)
+ *
+ */
+template <class I, class T>
+void csr_tocsc_threads(const I n_row,
+	                   const I n_col, 
+	                   const I Ap[], 
+	                   const I Aj[], 
+	                   const T Ax[],
+	                         I Bp[],
+	                         I Bi[],
+	                         T Bx[],
+	                   const I n_threads)
+{
+    const I nnz = Ap[n_row];
+
+    I t = sparsetools_num_threads(n_threads, n_row);
+    t = std::max((I) 1, std::min(t, nnz / std::max(n_col, (I) 1)));
+    if(t == 1){
+        csr_tocsc(n_row, n_col, Ap, Aj, Ax, Bp, Bi, Bx);
+        return;
+    }
+
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_row, Ap, t, &bounds[0]);
+
+    std::vector<I> counts((std::size_t) t * n_col, 0);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        I * count = &counts[0] + (std::size_t) p * n_col;
+        for(I jj = Ap[bounds[p]]; jj < Ap[bounds[p+1]]; jj++){
+            count[Aj[jj]]++;
+        }
+    }
+
+    // counts[p][col] becomes the number of entries of col in chunks
+    // before p, and Bp[col+1] the number of entries of col
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t))
+    for(I col = 0; col < n_col; col++){
+        I run = 0;
+        for(I p = 0; p < t; p++){
+            I c = counts[(std::size_t) p * n_col + col];
+            counts[(std::size_t) p * n_col + col] = run;
+            run += c;
+        }
+        Bp[col+1] = run;
+    }
+
+    Bp[0] = 0;
+    for(I col = 0; col < n_col; col++){
+        Bp[col+1] += Bp[col];
+    }
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        I * offset = &counts[0] + (std::size_t) p * n_col;
+        for(I row = bounds[p]; row < bounds[p+1]; row++){
+            for(I jj = Ap[row]; jj < Ap[row+1]; jj++){
+                const I col  = Aj[jj];
+                const I dest = Bp[col] + offset[col]++;
+
+                Bi[dest] = row;
+                Bx[dest] = Ax[jj];
+            }
+        }
+    }
+}
+
+
 
 /*
  * Compute B = A for CSR matrix A, ELL matrix B
@@ -618,6 +849,334 @@ void csr_matmat_pass2(const I n_row,
 }
 
 
+
+/*
+ * Multithreaded versions of csr_matmat_pass1 and csr_matmat_pass2.
+ *
+ * Rows of A are split into n_threads chunks of balanced nnz(A) + rows
+ * (n_threads <= 0 selects the default number), and every chunk has its
+ * own workspace.  A row whose number of products is small compared to
+ * n_col is accumulated in a hash table instead of the O(n_col) dense
+ * arrays, which are only allocated by threads that need them.  Output
+ * entries of each row are produced in the same order as the serial
+ * passes, so the result is identical to theirs.
+ */
+
+/*
+ * Number of products in row i of A*B, an upper bound on nnz(C[i,:])
+ */
+template <class I>
+I csr_matmat_row_products(const I i,
+                          const I Ap[],
+                          const I Aj[],
+                          const I Bp[])
+{
+    I products = 0;
+    for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+        const I j = Aj[jj];
+        products += Bp[j+1] - Bp[j];
+    }
+    return products;
+}
+
+/*
+ * Whether a row with the given number of products is accumulated in a
+ * hash table rather than in dense arrays of length n_col
+ */
+template <class I>
+bool csr_matmat_use_hash(const I products, const I n_col)
+{
+    return products < n_col / 16;
+}
+
+/*
+ * Open addressing table of column indices with linear probing.
+ * Returns the slot holding k, or the empty (-1) slot to put it in.
+ */
+template <class I>
+I csr_matmat_hash_slot(const I keys[], const I mask, const I k)
+{
+    I h = (I)(((size_t) k * (size_t) 2654435761UL) & (size_t) mask);
+    while(keys[h] != -1 && keys[h] != k){
+        h = (h + 1) & mask;
+    }
+    return h;
+}
+
+template <class I>
+I csr_matmat_hash_size(const I products)
+{
+    I size = 1;
+    while(size < 2 * products){
+        size *= 2;
+    }
+    return size;
+}
+
+/*
+ * Cp[i+1] = nnz(C[i,:]) for rows start to end-1; returns their sum
+ */
+template <class I>
+I csr_matmat_pass1_rows(const I start,
+                        const I end,
+                        const I n_col,
+                        const I Ap[],
+                        const I Aj[],
+                        const I Bp[],
+                        const I Bj[],
+                              I Cp[])
+{
+    std::vector<I> mask;
+    std::vector<I> keys;
+    I total = 0;
+
+    for(I i = start; i < end; i++){
+        const I products = csr_matmat_row_products(i, Ap, Aj, Bp);
+        I row_nnz = 0;
+
+        if(csr_matmat_use_hash(products, n_col)){
+            const I size = csr_matmat_hash_size(products);
+            keys.assign(size, -1);
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                I j = Aj[jj];
+                for(I kk = Bp[j]; kk < Bp[j+1]; kk++){
+                    I h = csr_matmat_hash_slot(&keys[0], size - 1, Bj[kk]);
+                    if(keys[h] == -1){
+                        keys[h] = Bj[kk];
+                        row_nnz++;
+                    }
+                }
+            }
+        } else {
+            if(mask.empty())
+                mask.assign(n_col, -1);
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                I j = Aj[jj];
+                for(I kk = Bp[j]; kk < Bp[j+1]; kk++){
+                    I k = Bj[kk];
+                    if(mask[k] != i){
+                        mask[k] = i;
+                        row_nnz++;
+                    }
+                }
+            }
+        }
+
+        Cp[i+1] = row_nnz;
+        total += row_nnz;
+    }
+    return total;
+}
+
+/*
+ * Turn the row counts Cp[1..n_row] into a row pointer, with the chunk
+ * sums computed by each thread
+ */
+template <class I>
+void csr_matmat_prefix_sum(const I n_row,
+                           const I t,
+                           const I bounds[],
+                                 I chunk_nnz[],
+                                 I Cp[])
+{
+    I nnz = 0;
+    for(I p = 0; p < t; p++){
+        I temp = chunk_nnz[p];
+        chunk_nnz[p] = nnz;
+        nnz += temp;
+    }
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        I sum = chunk_nnz[p];
+        for(I i = bounds[p]; i < bounds[p+1]; i++){
+            sum += Cp[i+1];
+            Cp[i+1] = sum;
+        }
+    }
+    Cp[0] = 0;
+}
+
+template <class I>
+void csr_matmat_pass1_threads(const I n_row,
+                              const I n_col, 
+                              const I Ap[], 
+                              const I Aj[], 
+                              const I Bp[],
+                              const I Bj[],
+                                    I Cp[],
+                              const I n_threads)
+{
+    const I t = sparsetools_num_threads(n_threads, n_row);
+    if(t <= 1){
+        csr_matmat_pass1(n_row, n_col, Ap, Aj, Bp, Bj, Cp);
+        return;
+    }
+
+    std::vector<I> bounds(t + 1);
+    std::vector<I> chunk_nnz(t);
+    balanced_row_partition(n_row, Ap, t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        chunk_nnz[p] = csr_matmat_pass1_rows(bounds[p], bounds[p+1], n_col,
+                                             Ap, Aj, Bp, Bj, Cp);
+    }
+
+    csr_matmat_prefix_sum(n_row, t, &bounds[0], &chunk_nnz[0], Cp);
+}
+
+/*
+ * Entries of rows start to end-1 of C, row i written from Cp[i] on.
+ * The number of nonzeros kept in row i is stored in lengths[i].
+ */
+template <class I, class T>
+void csr_matmat_pass2_rows(const I start,
+                           const I end,
+                           const I n_col, 
+                           const I Ap[], 
+                           const I Aj[], 
+                           const T Ax[],
+                           const I Bp[],
+                           const I Bj[],
+                           const T Bx[],
+                           const I Cp[],
+                                 I Cj[],
+                                 T Cx[],
+                                 I lengths[])
+{
+    std::vector<I> next;
+    std::vector<T> sums;
+    std::vector<I> keys;
+    std::vector<T> vals;
+    std::vector<I> order;
+
+    for(I i = start; i < end; i++){
+        const I products = csr_matmat_row_products(i, Ap, Aj, Bp);
+        I nnz = Cp[i];
+
+        if(csr_matmat_use_hash(products, n_col)){
+            const I size = csr_matmat_hash_size(products);
+            keys.assign(size, -1);
+            vals.resize(size);
+            order.clear();
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                I j = Aj[jj];
+                T v = Ax[jj];
+                for(I kk = Bp[j]; kk < Bp[j+1]; kk++){
+                    I h = csr_matmat_hash_slot(&keys[0], size - 1, Bj[kk]);
+                    if(keys[h] == -1){
+                        keys[h] = Bj[kk];
+                        vals[h] = v*Bx[kk];
+                        order.push_back(h);
+                    } else {
+                        vals[h] += v*Bx[kk];
+                    }
+                }
+            }
+            // most recently inserted first, as in csr_matmat_pass2
+            for(I n = (I) order.size() - 1; n >= 0; n--){
+                I h = order[n];
+                if(vals[h] != 0){
+                    Cj[nnz] = keys[h];
+                    Cx[nnz] = vals[h];
+                    nnz++;
+                }
+            }
+        } else {
+            if(next.empty()){
+                next.assign(n_col, -1);
+                sums.assign(n_col, 0);
+            }
+            I head   = -2;
+            I length =  0;
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                I j = Aj[jj];
+                T v = Ax[jj];
+                for(I kk = Bp[j]; kk < Bp[j+1]; kk++){
+                    I k = Bj[kk];
+                    sums[k] += v*Bx[kk];
+                    if(next[k] == -1){
+                        next[k] = head;
+                        head  = k;
+                        length++;
+                    }
+                }
+            }
+            for(I jj = 0; jj < length; jj++){
+                if(sums[head] != 0){
+                    Cj[nnz] = head;
+                    Cx[nnz] = sums[head];
+                    nnz++;
+                }
+                I temp = head;
+                head = next[head];
+                next[temp] = -1;
+                sums[temp] =  0;
+            }
+        }
+
+        lengths[i] = nnz - Cp[i];
+    }
+}
+
+/*
+ * Cp[] must hold the row pointer computed by csr_matmat_pass1 (or its
+ * threaded version).  On return it is updated for the explicit zeros
+ * that were dropped, exactly as csr_matmat_pass2 computes it.
+ */
+template <class I, class T>
+void csr_matmat_pass2_threads(const I n_row,
+      	                      const I n_col, 
+      	                      const I Ap[], 
+      	                      const I Aj[], 
+      	                      const T Ax[],
+      	                      const I Bp[],
+      	                      const I Bj[],
+      	                      const T Bx[],
+      	                            I Cp[],
+      	                            I Cj[],
+      	                            T Cx[],
+      	                      const I n_threads)
+{
+    const I t = sparsetools_num_threads(n_threads, n_row);
+    if(t <= 1){
+        csr_matmat_pass2(n_row, n_col, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx);
+        return;
+    }
+
+    std::vector<I> bounds(t + 1);
+    std::vector<I> lengths(n_row);
+    balanced_row_partition(n_row, Ap, t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        csr_matmat_pass2_rows(bounds[p], bounds[p+1], n_col, Ap, Aj, Ax,
+                              Bp, Bj, Bx, Cp, Cj, Cx, &lengths[0]);
+    }
+
+    // squeeze out the slots of dropped zeros, if there were any
+    I nnz = 0;
+    for(I i = 0; i < n_row; i++){
+        nnz += lengths[i];
+    }
+    if(nnz == Cp[n_row])
+        return;
+
+    nnz = 0;
+    for(I i = 0; i < n_row; i++){
+        const I row_start = Cp[i];
+        Cp[i] = nnz;
+        for(I jj = row_start; jj < row_start + lengths[i]; jj++){
+            Cj[nnz] = Cj[jj];
+            Cx[nnz] = Cx[jj];
+            nnz++;
+        }
+    }
+    Cp[n_row] = nnz;
+}
+
+
 /*
  * Compute C = A (binary_op) B for CSR matrices that are not
  * necessarily canonical CSR format.  Specifically, this method
@@ -857,36 +1416,604 @@ void csr_binop_csr(const I n_row,
 
 
 
-/* element-wise binary operations*/
+/*
+ * Row i of the linear combination of CSR matrices in
+ * csr_linear_combination_elmul.  The columns are merged across all
+ * operands at once.  If Cj is NULL the entries are only counted.
+ *
+ * Returns the number of entries in row i of the result.
+ */
 template <class I, class T>
-void csr_elmul_csr(const I n_row, const I n_col, 
-                   const I Ap[], const I Aj[], const T Ax[],
-                   const I Bp[], const I Bj[], const T Bx[],
-                         I Cp[],       I Cj[],       T Cx[])
+I csr_linear_combination_row(const I i,
+                             const I n_row,
+                             const I n_ops,
+                             const I offsets[],
+                             const I Ap[],
+                             const I Aj[],
+                             const T Ax[],
+                             const T Xx[],
+                             const I Bp[],
+                             const I Bj[],
+                             const T Bx[],
+                                   I pos[],
+                                   I Cj[],
+                                   T Cx[])
 {
-    csr_binop_csr(n_row,n_col,Ap,Aj,Ax,Bp,Bj,Bx,Cp,Cj,Cx,std::multiplies<T>());
-}
+    for(I k = 0; k < n_ops; k++){
+        pos[k] = Ap[k * (n_row + 1) + i];
+    }
+    I B_pos = (Bp == NULL) ? 0 : Bp[i];
+    I B_end = (Bp == NULL) ? 0 : Bp[i+1];
 
-template <class I, class T>
-void csr_eldiv_csr(const I n_row, const I n_col, 
-                   const I Ap[], const I Aj[], const T Ax[],
-                   const I Bp[], const I Bj[], const T Bx[],
-                         I Cp[],       I Cj[],       T Cx[])
-{
-    csr_binop_csr(n_row,n_col,Ap,Aj,Ax,Bp,Bj,Bx,Cp,Cj,Cx,std::divides<T>());
-}
+    I nnz = 0;
+    for(;;){
+        if(Bp != NULL && B_pos == B_end){
+            break; // the rest of the row is masked out
+        }
 
+        // next column of the result
+        I j = -1;
+        for(I k = 0; k < n_ops; k++){
+            if(pos[k] < Ap[k * (n_row + 1) + i + 1]){
+                const I c = Aj[offsets[k] + pos[k]];
+                if(j == -1 || c < j){
+                    j = c;
+                }
+            }
+        }
+        if(j == -1){
+            break;
+        }
 
-template <class I, class T>
-void csr_plus_csr(const I n_row, const I n_col, 
-                  const I Ap[], const I Aj[], const T Ax[],
-                  const I Bp[], const I Bj[], const T Bx[],
-                        I Cp[],       I Cj[],       T Cx[])
-{
-    csr_binop_csr(n_row,n_col,Ap,Aj,Ax,Bp,Bj,Bx,Cp,Cj,Cx,std::plus<T>());
+        T sum = 0;
+        for(I k = 0; k < n_ops; k++){
+            const I end = Ap[k * (n_row + 1) + i + 1];
+            const I * aj = Aj + offsets[k];
+            const T * ax = Ax + offsets[k];
+            for(; pos[k] < end && aj[pos[k]] == j; pos[k]++){
+                sum += Xx[k] * ax[pos[k]];
+            }
+        }
+
+        if(Bp != NULL){
+            while(B_pos < B_end && Bj[B_pos] < j){
+                B_pos++;
+            }
+            T b = 0;
+            for(; B_pos < B_end && Bj[B_pos] == j; B_pos++){
+                b += Bx[B_pos];
+            }
+            sum = sum * b;
+        }
+
+        if(sum != 0){
+            if(Cj != NULL){
+                Cj[nnz] = j;
+                Cx[nnz] = sum;
+            }
+            nnz++;
+        }
+    }
+
+    return nnz;
 }
 
-template <class I, class T>
+
+/*
+ * Compute C = (sum_k Xx[k] * A_k) .* B for CSR matrices A_k, B, C
+ *
+ * Input Arguments:
+ *   I  n_row                   - number of rows in each matrix
+ *   I  n_col                   - number of columns in each matrix
+ *   I  n_ops                   - number of matrices A_k
+ *   I  offsets[n_ops]          - start of A_k in Aj and Ax
+ *   I  Ap[n_ops*(n_row+1)]     - row pointers of A_0, A_1, ...
+ *   I  Aj[sum nnz(A_k)]        - column indices of A_0, A_1, ...
+ *   T  Ax[sum nnz(A_k)]        - nonzeros of A_0, A_1, ...
+ *   T  Xx[n_ops]               - coefficients
+ *   I  Bp[n_row+1]             - row pointer
+ *   I  Bj[nnz(B)]              - column indices
+ *   T  Bx[nnz(B)]              - nonzeros
+ *   I  n_threads               - number of threads (<= 0 means the default)
+ *
+ * Output Arguments:
+ *   vec<I> Cp                  - row pointer
+ *   vec<I> Cj                  - column indices
+ *   vec<T> Cx                  - nonzeros
+ *
+ * Note:
+ *   Output arrays Cp, Cj, and Cx will be allocated within in the method
+ *   The row pointer of A_k holds positions relative to offsets[k].
+ *
+ *   Input:  rows of A_k and B must have sorted indices, duplicates
+ *           are summed
+ *   Output: C is in canonical format and holds no zero entries
+ *
+ *   Each row of C is produced by one merge over all the operands, so no
+ *   intermediate matrices are formed.  Rows are counted in a first
+ *   pass, which lets C be allocated once at its exact size.
+ *
+ *   Complexity: O(n_ops * (n_row + sum nnz(A_k)) + nnz(B))
+ *
+ */
+template <class I, class T>
+void csr_linear_combination_elmul(const I n_row,
+                                  const I n_col,
+                                  const I n_ops,
+                                  const I offsets[],
+                                  const I Ap[],
+                                  const I Aj[],
+                                  const T Ax[],
+                                  const T Xx[],
+                                  const I Bp[],
+                                  const I Bj[],
+                                  const T Bx[],
+                                  std::vector<I>* Cp,
+                                  std::vector<I>* Cj,
+                                  std::vector<T>* Cx,
+                                  const I n_threads)
+{
+    // balance the threads by the number of entries read in each row
+    std::vector<I> cost(n_row + 1, 0);
+    for(I i = 0; i < n_row; i++){
+        I row_cost = (Bp == NULL) ? 0 : Bp[i+1] - Bp[i];
+        for(I k = 0; k < n_ops; k++){
+            row_cost += Ap[k * (n_row + 1) + i + 1] - Ap[k * (n_row + 1) + i];
+        }
+        cost[i+1] = cost[i] + row_cost;
+    }
+
+    const I t = sparsetools_num_threads(n_threads, n_row);
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_row, &cost[0], t, &bounds[0]);
+
+    Cp->resize(n_row + 1);
+    I * cp = &(*Cp)[0];
+    cp[0] = 0;
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        std::vector<I> pos(n_ops);
+        for(I i = bounds[p]; i < bounds[p+1]; i++){
+            cp[i+1] = csr_linear_combination_row(i, n_row, n_ops, offsets,
+                            Ap, Aj, Ax, Xx, Bp, Bj, Bx, &pos[0],
+                            (I *) NULL, (T *) NULL);
+        }
+    }
+    for(I i = 0; i < n_row; i++){
+        cp[i+1] += cp[i];
+    }
+
+    Cj->resize(cp[n_row]);
+    Cx->resize(cp[n_row]);
+    if(Cj->empty()) return;
+
+    I * cj = &(*Cj)[0];
+    T * cx = &(*Cx)[0];
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        std::vector<I> pos(n_ops);
+        for(I i = bounds[p]; i < bounds[p+1]; i++){
+            csr_linear_combination_row(i, n_row, n_ops, offsets,
+                    Ap, Aj, Ax, Xx, Bp, Bj, Bx, &pos[0],
+                    cj + cp[i], cx + cp[i]);
+        }
+    }
+}
+
+/*
+ * Compute C = sum_k Xx[k] * A_k for CSR matrices A_k, C
+ *
+ * See csr_linear_combination_elmul, without B.
+ *
+ */
+template <class I, class T>
+void csr_linear_combination(const I n_row,
+                            const I n_col,
+                            const I n_ops,
+                            const I offsets[],
+                            const I Ap[],
+                            const I Aj[],
+                            const T Ax[],
+                            const T Xx[],
+                            std::vector<I>* Cp,
+                            std::vector<I>* Cj,
+                            std::vector<T>* Cx,
+                            const I n_threads)
+{
+    csr_linear_combination_elmul(n_row, n_col, n_ops, offsets, Ap, Aj, Ax, Xx,
+                                 (const I *) NULL, (const I *) NULL,
+                                 (const T *) NULL, Cp, Cj, Cx, n_threads);
+}
+
+
+
+/*
+ * Compute the Kronecker product C = kron(A, B) for CSR matrices A, B, C
+ *
+ * Input Arguments:
+ *   I  n_rowA, n_colA          - dimensions of A
+ *   I  Ap[n_rowA+1]            - row pointer
+ *   I  Aj[nnz(A)]              - column indices
+ *   T  Ax[nnz(A)]              - nonzeros
+ *   I  n_rowB, n_colB          - dimensions of B
+ *   I  Bp[n_rowB+1]            - row pointer
+ *   I  Bj[nnz(B)]              - column indices
+ *   T  Bx[nnz(B)]              - nonzeros
+ *   I  n_threads               - number of threads (<= 0 means the default)
+ *
+ * Output Arguments:
+ *   vec<I> Cp                  - row pointer
+ *   vec<I> Cj                  - column indices
+ *   vec<T> Cx                  - nonzeros
+ *
+ * Note:
+ *   Output arrays Cp, Cj, and Cx will be allocated within in the method
+ *   C has n_rowA*n_rowB rows, row iA*n_rowB + iB holding the products
+ *   of row iA of A with row iB of B, so nnz(C) = nnz(A) * nnz(B) is
+ *   known before any entry is written.  C has sorted indices when A and
+ *   B do.  Duplicates and explicit zeros are kept.
+ *
+ *   Complexity: O(n_rowA*n_rowB + nnz(A)*nnz(B))
+ *
+ */
+template <class I, class T>
+void csr_kron(const I n_rowA,
+              const I n_colA,
+              const I Ap[],
+              const I Aj[],
+              const T Ax[],
+              const I n_rowB,
+              const I n_colB,
+              const I Bp[],
+              const I Bj[],
+              const T Bx[],
+              std::vector<I>* Cp,
+              std::vector<I>* Cj,
+              std::vector<T>* Cx,
+              const I n_threads)
+{
+    const I n_row = n_rowA * n_rowB;
+
+    Cp->resize(n_row + 1);
+    I * cp = &(*Cp)[0];
+    cp[0] = 0;
+    for(I iA = 0, r = 0; iA < n_rowA; iA++){
+        const I lenA = Ap[iA+1] - Ap[iA];
+        for(I iB = 0; iB < n_rowB; iB++, r++){
+            cp[r+1] = cp[r] + lenA * (Bp[iB+1] - Bp[iB]);
+        }
+    }
+
+    Cj->resize(cp[n_row]);
+    Cx->resize(cp[n_row]);
+    if(Cj->empty()) return;
+
+    I * cj = &(*Cj)[0];
+    T * cx = &(*Cx)[0];
+
+    const I t = sparsetools_num_threads(n_threads, n_row);
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_row, cp, t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        for(I r = bounds[p]; r < bounds[p+1]; r++){
+            const I iA = r / n_rowB;
+            const I iB = r % n_rowB;
+            I n = cp[r];
+            for(I jj = Ap[iA]; jj < Ap[iA+1]; jj++){
+                const I col = Aj[jj] * n_colB;
+                const T a   = Ax[jj];
+                for(I kk = Bp[iB]; kk < Bp[iB+1]; kk++){
+                    cj[n] = col + Bj[kk];
+                    cx[n] = a * Bx[kk];
+                    n++;
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * Row r = p*n_A + q of the Kronecker sum in csr_kronsum.  Row q of A,
+ * shifted to columns p*n_A.., is merged with row p of B spread to
+ * columns Bj*n_A + q.  If Cj is NULL the entries are only counted.
+ *
+ * Returns the number of entries in row r of the result.
+ */
+template <class I, class T>
+I csr_kronsum_row(const I p,
+                  const I q,
+                  const I n_A,
+                  const I Ap[],
+                  const I Aj[],
+                  const T Ax[],
+                  const I Bp[],
+                  const I Bj[],
+                  const T Bx[],
+                        I Cj[],
+                        T Cx[])
+{
+    const I shift = p * n_A;
+
+    I jj = Ap[q],  A_end = Ap[q+1];
+    I kk = Bp[p],  B_end = Bp[p+1];
+    I nnz = 0;
+
+    while(jj < A_end && kk < B_end){
+        const I A_j = shift + Aj[jj];
+        const I B_j = Bj[kk] * n_A + q;
+        if(A_j == B_j){
+            if(Cj != NULL){
+                Cj[nnz] = A_j;
+                Cx[nnz] = Ax[jj] + Bx[kk];
+            }
+            jj++; kk++;
+        } else if(A_j < B_j){
+            if(Cj != NULL){
+                Cj[nnz] = A_j;
+                Cx[nnz] = Ax[jj];
+            }
+            jj++;
+        } else {
+            if(Cj != NULL){
+                Cj[nnz] = B_j;
+                Cx[nnz] = Bx[kk];
+            }
+            kk++;
+        }
+        nnz++;
+    }
+    for(; jj < A_end; jj++, nnz++){
+        if(Cj != NULL){
+            Cj[nnz] = shift + Aj[jj];
+            Cx[nnz] = Ax[jj];
+        }
+    }
+    for(; kk < B_end; kk++, nnz++){
+        if(Cj != NULL){
+            Cj[nnz] = Bj[kk] * n_A + q;
+            Cx[nnz] = Bx[kk];
+        }
+    }
+
+    return nnz;
+}
+
+/*
+ * Compute the Kronecker sum C = kron(I_nB, A) + kron(B, I_nA) for
+ * square CSR matrices A, B, C
+ *
+ * Input Arguments:
+ *   I  n_A                     - dimension of A
+ *   I  Ap[n_A+1]               - row pointer
+ *   I  Aj[nnz(A)]              - column indices
+ *   T  Ax[nnz(A)]              - nonzeros
+ *   I  n_B                     - dimension of B
+ *   I  Bp[n_B+1]               - row pointer
+ *   I  Bj[nnz(B)]              - column indices
+ *   T  Bx[nnz(B)]              - nonzeros
+ *   I  n_threads               - number of threads (<= 0 means the default)
+ *
+ * Output Arguments:
+ *   vec<I> Cp                  - row pointer
+ *   vec<I> Cj                  - column indices
+ *   vec<T> Cx                  - nonzeros
+ *
+ * Note:
+ *   Output arrays Cp, Cj, and Cx will be allocated within in the method
+ *
+ *   Input:  rows of A and B must have sorted indices
+ *   Output: C has sorted indices; entries of the two products that
+ *           coincide (diagonal entries of both A and B) are summed
+ *
+ *   Neither Kronecker product is formed.  Rows are counted in a first
+ *   pass, which lets C be allocated once at its exact size.
+ *
+ *   Complexity: O(n_A*n_B + n_B*nnz(A) + n_A*nnz(B))
+ *
+ */
+template <class I, class T>
+void csr_kronsum(const I n_A,
+                 const I Ap[],
+                 const I Aj[],
+                 const T Ax[],
+                 const I n_B,
+                 const I Bp[],
+                 const I Bj[],
+                 const T Bx[],
+                 std::vector<I>* Cp,
+                 std::vector<I>* Cj,
+                 std::vector<T>* Cx,
+                 const I n_threads)
+{
+    const I n_row = n_A * n_B;
+    const I t = sparsetools_num_threads(n_threads, n_row);
+
+    Cp->resize(n_row + 1);
+    I * cp = &(*Cp)[0];
+    cp[0] = 0;
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I c = 0; c < t; c++){
+        const I start = (I)(((double) n_row * c) / t);
+        const I end   = (I)(((double) n_row * (c + 1)) / t);
+        for(I r = start; r < end; r++){
+            cp[r+1] = csr_kronsum_row(r / n_A, r % n_A, n_A, Ap, Aj, Ax,
+                                      Bp, Bj, Bx, (I *) NULL, (T *) NULL);
+        }
+    }
+    for(I r = 0; r < n_row; r++){
+        cp[r+1] += cp[r];
+    }
+
+    Cj->resize(cp[n_row]);
+    Cx->resize(cp[n_row]);
+    if(Cj->empty()) return;
+
+    I * cj = &(*Cj)[0];
+    T * cx = &(*Cx)[0];
+
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_row, cp, t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I c = 0; c < t; c++){
+        for(I r = bounds[c]; r < bounds[c+1]; r++){
+            csr_kronsum_row(r / n_A, r % n_A, n_A, Ap, Aj, Ax,
+                            Bp, Bj, Bx, cj + cp[r], cx + cp[r]);
+        }
+    }
+}
+
+
+/*
+ * Assemble a CSR matrix C from a grid of CSR blocks A_IJ
+ *
+ * Input Arguments:
+ *   I  n_brow                  - number of block rows
+ *   I  n_bcol                  - number of block columns
+ *   I  rows[n_brow+1]          - block row I is rows rows[I]..rows[I+1]-1 of C
+ *   I  cols[n_bcol+1]          - block column J is columns cols[J].. of C
+ *   I  offsets[n_brow*n_bcol]  - start of A_IJ in Aj and Ax, or -1 if
+ *                                A_IJ is zero
+ *   I  Ap[]                    - row pointers of the nonzero blocks
+ *   I  Aj[sum nnz(A_IJ)]       - column indices of the nonzero blocks
+ *   T  Ax[sum nnz(A_IJ)]       - nonzeros of the nonzero blocks
+ *   I  n_threads               - number of threads (<= 0 means the default)
+ *
+ * Output Arguments:
+ *   vec<I> Cp                  - row pointer
+ *   vec<I> Cj                  - column indices
+ *   vec<T> Cx                  - nonzeros
+ *
+ * Note:
+ *   Output arrays Cp, Cj, and Cx will be allocated within in the method
+ *   The nonzero blocks are stored in row-major order of the grid, with
+ *   the row pointer of A_IJ (rows[I+1] - rows[I] + 1 entries) holding
+ *   positions relative to offsets[I*n_bcol + J].
+ *
+ *   Row i of C is the concatenation of the matching rows of its blocks,
+ *   so C has sorted indices when every block does.  Duplicates and
+ *   explicit zeros are kept.
+ *
+ *   Complexity: O(n_row * n_bcol + nnz(C))
+ *
+ */
+template <class I, class T>
+void csr_bmat(const I n_brow,
+              const I n_bcol,
+              const I rows[],
+              const I cols[],
+              const I offsets[],
+              const I Ap[],
+              const I Aj[],
+              const T Ax[],
+              std::vector<I>* Cp,
+              std::vector<I>* Cj,
+              std::vector<T>* Cx,
+              const I n_threads)
+{
+    const I n_row = rows[n_brow];
+
+    // position of the row pointer of each block in Ap
+    std::vector<I> ptr(n_brow * n_bcol, -1);
+    for(I bi = 0, n = 0; bi < n_brow; bi++){
+        for(I bj = 0; bj < n_bcol; bj++){
+            if(offsets[bi * n_bcol + bj] >= 0){
+                ptr[bi * n_bcol + bj] = n;
+                n += rows[bi+1] - rows[bi] + 1;
+            }
+        }
+    }
+
+    Cp->resize(n_row + 1);
+    I * cp = &(*Cp)[0];
+    cp[0] = 0;
+    for(I bi = 0; bi < n_brow; bi++){
+        for(I i = rows[bi]; i < rows[bi+1]; i++){
+            I len = 0;
+            for(I bj = 0; bj < n_bcol; bj++){
+                const I k = ptr[bi * n_bcol + bj];
+                if(k >= 0){
+                    len += Ap[k + i - rows[bi] + 1] - Ap[k + i - rows[bi]];
+                }
+            }
+            cp[i+1] = cp[i] + len;
+        }
+    }
+
+    Cj->resize(cp[n_row]);
+    Cx->resize(cp[n_row]);
+    if(Cj->empty()) return;
+
+    I * cj = &(*Cj)[0];
+    T * cx = &(*Cx)[0];
+
+    const I t = sparsetools_num_threads(n_threads, n_row);
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_row, cp, t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        // block row of the first row in the chunk
+        I bi = std::upper_bound(rows, rows + n_brow + 1, bounds[p]) - rows - 1;
+        for(I i = bounds[p]; i < bounds[p+1]; i++){
+            while(rows[bi+1] <= i){
+                bi++;
+            }
+            I n = cp[i];
+            for(I bj = 0; bj < n_bcol; bj++){
+                const I k = ptr[bi * n_bcol + bj];
+                if(k < 0) continue;
+
+                const I * aj = Aj + offsets[bi * n_bcol + bj];
+                const T * ax = Ax + offsets[bi * n_bcol + bj];
+                const I shift = cols[bj];
+                for(I jj = Ap[k + i - rows[bi]]; jj < Ap[k + i - rows[bi] + 1]; jj++){
+                    cj[n] = aj[jj] + shift;
+                    cx[n] = ax[jj];
+                    n++;
+                }
+            }
+        }
+    }
+}
+
+
+/* element-wise binary operations*/
+template <class I, class T>
+void csr_elmul_csr(const I n_row, const I n_col, 
+                   const I Ap[], const I Aj[], const T Ax[],
+                   const I Bp[], const I Bj[], const T Bx[],
+                         I Cp[],       I Cj[],       T Cx[])
+{
+    csr_binop_csr(n_row,n_col,Ap,Aj,Ax,Bp,Bj,Bx,Cp,Cj,Cx,std::multiplies<T>());
+}
+
+template <class I, class T>
+void csr_eldiv_csr(const I n_row, const I n_col, 
+                   const I Ap[], const I Aj[], const T Ax[],
+                   const I Bp[], const I Bj[], const T Bx[],
+                         I Cp[],       I Cj[],       T Cx[])
+{
+    csr_binop_csr(n_row,n_col,Ap,Aj,Ax,Bp,Bj,Bx,Cp,Cj,Cx,std::divides<T>());
+}
+
+
+template <class I, class T>
+void csr_plus_csr(const I n_row, const I n_col, 
+                  const I Ap[], const I Aj[], const T Ax[],
+                  const I Bp[], const I Bj[], const T Bx[],
+                        I Cp[],       I Cj[],       T Cx[])
+{
+    csr_binop_csr(n_row,n_col,Ap,Aj,Ax,Bp,Bj,Bx,Cp,Cj,Cx,std::plus<T>());
+}
+
+template <class I, class T>
 void csr_minus_csr(const I n_row, const I n_col, 
                    const I Ap[], const I Aj[], const T Ax[],
                    const I Bp[], const I Bj[], const T Bx[],
@@ -1065,6 +2192,94 @@ void csr_matvecs(const I n_row,
 
 
 
+/*
+ * Compute Y += A*X for CSR matrix A and dense vectors X,Y using up to
+ * n_threads threads (n_threads <= 0 selects the default number).
+ *
+ * Rows are split into contiguous chunks of balanced nnz(A) + rows, and
+ * each output entry is computed by a single thread in the same order as
+ * csr_matvec, so the result is identical to the serial one.
+ *
+ * Input Arguments:
+ *   I  n_row         - number of rows in A
+ *   I  n_col         - number of columns in A
+ *   I  Ap[n_row+1]   - row pointer
+ *   I  Aj[nnz(A)]    - column indices
+ *   T  Ax[nnz(A)]    - nonzeros
+ *   T  Xx[n_col]     - input vector
+ *   I  n_threads     - number of threads
+ *
+ * Output Arguments:
+ *   T  Yx[n_row]     - output vector
+ *
+ * Note:
+ *   Output array Yx must be preallocated
+ *
+ *   Complexity: Linear.  Specifically O(nnz(A) + n_row)
+ *
+ */
+template <class I, class T>
+void csr_matvec_threads(const I n_row,
+	                    const I n_col, 
+	                    const I Ap[], 
+	                    const I Aj[], 
+	                    const T Ax[],
+	                    const T Xx[],
+	                          T Yx[],
+	                    const I n_threads)
+{
+    const I t = sparsetools_num_threads(n_threads, n_row);
+    if(t <= 1){
+        csr_matvec(n_row, n_col, Ap, Aj, Ax, Xx, Yx);
+        return;
+    }
+
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_row, Ap, t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        const I start = bounds[p];
+        csr_matvec(bounds[p+1] - start, n_col, Ap + start, Aj, Ax, Xx, Yx + start);
+    }
+}
+
+
+/*
+ * Compute Y += A*X for CSR matrix A and dense block vectors X,Y using
+ * up to n_threads threads.  See csr_matvec_threads.
+ *
+ */
+template <class I, class T>
+void csr_matvecs_threads(const I n_row,
+	                     const I n_col, 
+                         const I n_vecs,
+	                     const I Ap[], 
+	                     const I Aj[], 
+	                     const T Ax[],
+	                     const T Xx[],
+	                           T Yx[],
+	                     const I n_threads)
+{
+    const I t = sparsetools_num_threads(n_threads, n_row);
+    if(t <= 1){
+        csr_matvecs(n_row, n_col, n_vecs, Ap, Aj, Ax, Xx, Yx);
+        return;
+    }
+
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_row, Ap, t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        const I start = bounds[p];
+        csr_matvecs(bounds[p+1] - start, n_col, n_vecs, Ap + start, Aj, Ax, Xx,
+                    Yx + n_vecs * start);
+    }
+}
+
+
+
 
 template<class I, class T>
 void get_csr_submatrix(const I n_row,
@@ -1120,6 +2335,179 @@ void get_csr_submatrix(const I n_row,
 }
 
 
+
+/*
+ * Extract rows of CSR matrix A: B = A[rows,:]
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows in A
+ *   I  n_col           - number of columns in A
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   T  Ax[nnz(A)]      - nonzeros
+ *   I  n_idx           - number of rows of B
+ *   I  rows[n_idx]     - row of A copied to each row of B
+ *   I  n_threads       - number of threads (<= 0 means the default)
+ *
+ * Output Arguments:
+ *   vec<I> Bp          - row pointer
+ *   vec<I> Bj          - column indices
+ *   vec<T> Bx          - nonzeros
+ *
+ * Note:
+ *   Output arrays Bp, Bj, and Bx will be allocated within in the method
+ *   rows may repeat rows of A and must not be negative.  Each row of B
+ *   is a copy of its row of A, so sorted indices are preserved.
+ *
+ *   Complexity: Linear.  Specifically O(n_idx + nnz(B))
+ *
+ */
+template <class I, class T>
+void csr_row_index(const I n_row,
+                   const I n_col,
+                   const I Ap[],
+                   const I Aj[],
+                   const T Ax[],
+                   const I n_idx,
+                   const I rows[],
+                   std::vector<I>* Bp,
+                   std::vector<I>* Bj,
+                   std::vector<T>* Bx,
+                   const I n_threads)
+{
+    Bp->resize(n_idx + 1);
+    (*Bp)[0] = 0;
+    for(I k = 0; k < n_idx; k++){
+        (*Bp)[k+1] = (*Bp)[k] + (Ap[rows[k]+1] - Ap[rows[k]]);
+    }
+    Bj->resize((*Bp)[n_idx]);
+    Bx->resize((*Bp)[n_idx]);
+    if(Bj->empty()) return;
+
+    const I * bp = &(*Bp)[0];
+    I * bj = &(*Bj)[0];
+    T * bx = &(*Bx)[0];
+
+    const I t = sparsetools_num_threads(n_threads, n_idx);
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_idx, bp, t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        for(I k = bounds[p]; k < bounds[p+1]; k++){
+            const I row_start = Ap[rows[k]];
+            const I row_end   = Ap[rows[k]+1];
+            std::copy(Aj + row_start, Aj + row_end, bj + bp[k]);
+            std::copy(Ax + row_start, Ax + row_end, bx + bp[k]);
+        }
+    }
+}
+
+
+/*
+ * Extract columns of CSR matrix A: B = A[:,cols]
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows in A
+ *   I  n_col           - number of columns in A
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   T  Ax[nnz(A)]      - nonzeros
+ *   I  n_idx           - number of columns of B
+ *   I  cols[n_idx]     - column of A copied to each column of B
+ *   I  n_threads       - number of threads (<= 0 means the default)
+ *
+ * Output Arguments:
+ *   vec<I> Bp          - row pointer
+ *   vec<I> Bj          - column indices
+ *   vec<T> Bx          - nonzeros
+ *
+ * Note:
+ *   Output arrays Bp, Bj, and Bx will be allocated within in the method
+ *   cols may repeat columns of A and must not be negative.  Entries of
+ *   B follow the order of the entries of A within each row, so B has
+ *   sorted indices only if A does and cols is increasing.
+ *
+ *   The columns of B taken from each column of A are found through a
+ *   counting sort of cols.
+ *
+ *   Complexity: Linear.  Specifically O(n_col + n_idx + nnz(A) + nnz(B))
+ *
+ */
+template <class I, class T>
+void csr_column_index(const I n_row,
+                      const I n_col,
+                      const I Ap[],
+                      const I Aj[],
+                      const T Ax[],
+                      const I n_idx,
+                      const I cols[],
+                      std::vector<I>* Bp,
+                      std::vector<I>* Bj,
+                      std::vector<T>* Bx,
+                      const I n_threads)
+{
+    // columns of B taken from column j of A are
+    // col_order[col_ptr[j]] to col_order[col_ptr[j+1]-1]
+    std::vector<I> col_ptr(n_col + 1, 0), col_order(n_idx);
+    for(I k = 0; k < n_idx; k++){
+        col_ptr[cols[k]+1]++;
+    }
+    for(I j = 0; j < n_col; j++){
+        col_ptr[j+1] += col_ptr[j];
+    }
+    {
+        std::vector<I> next(col_ptr.begin(), col_ptr.end() - 1);
+        for(I k = 0; k < n_idx; k++){
+            col_order[next[cols[k]]++] = k;
+        }
+    }
+
+    const I t = sparsetools_num_threads(n_threads, n_row);
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_row, Ap, t, &bounds[0]);
+
+    Bp->resize(n_row + 1);
+    I * bp = &(*Bp)[0];
+    bp[0] = 0;
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        for(I i = bounds[p]; i < bounds[p+1]; i++){
+            I row_nnz = 0;
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                row_nnz += col_ptr[Aj[jj]+1] - col_ptr[Aj[jj]];
+            }
+            bp[i+1] = row_nnz;
+        }
+    }
+    for(I i = 0; i < n_row; i++){
+        bp[i+1] += bp[i];
+    }
+
+    Bj->resize(bp[n_row]);
+    Bx->resize(bp[n_row]);
+    if(Bj->empty()) return;
+
+    I * bj = &(*Bj)[0];
+    T * bx = &(*Bx)[0];
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        for(I i = bounds[p]; i < bounds[p+1]; i++){
+            I n = bp[i];
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                for(I k = col_ptr[Aj[jj]]; k < col_ptr[Aj[jj]+1]; k++){
+                    bj[n] = col_order[k];
+                    bx[n] = Ax[jj];
+                    n++;
+                }
+            }
+        }
+    }
+}
+
+
 /*
  * Count the number of occupied diagonals in CSR matrix A
  *
@@ -1145,6 +2533,38 @@ I csr_count_diagonals(const I n_row,
 }
 
 
+/*
+ * Value of A(i,j) for CSR matrix A, summing duplicate entries.  Rows
+ * with sorted indices are binary searched, others are scanned.
+ */
+template <class I, class T>
+T csr_sample_one(const I Ap[],
+                 const I Aj[],
+                 const T Ax[],
+                 const I i,
+                 const I j,
+                 const bool sorted)
+{
+    const I row_start = Ap[i];
+    const I row_end   = Ap[i+1];
+
+    T x = 0;
+    if(sorted){
+        I jj = std::lower_bound(Aj + row_start, Aj + row_end, j) - Aj;
+        for(; jj < row_end && Aj[jj] == j; jj++){
+            x += Ax[jj];
+        }
+    } else {
+        for(I jj = row_start; jj < row_end; jj++){
+            if(Aj[jj] == j){
+                x += Ax[jj];
+            }
+        }
+    }
+    return x;
+}
+
+
 /*
  * Sample the matrix at specific locations
  * 
@@ -1152,24 +2572,181 @@ I csr_count_diagonals(const I n_row,
  *    Bx[n] = A(Bi[n],Bj[n])
  *
  * Input Arguments:
- *   I  n_row         - number of rows in A
- *   I  n_col         - number of columns in A
- *   I  Ap[n_row+1]   - row pointer
- *   I  Aj[nnz(A)]    - column indices
- *   T  Ax[nnz(A)]    - nonzeros
- *   I  n_samples     - number of samples
- *   I  Bi[N]         - sample rows
- *   I  Bj[N]         - sample columns
+ *   I  n_row          - number of rows in A
+ *   I  n_col          - number of columns in A
+ *   I  Ap[n_row+1]    - row pointer
+ *   I  Aj[nnz(A)]     - column indices
+ *   T  Ax[nnz(A)]     - nonzeros
+ *   I  n_samples      - number of samples
+ *   I  Bi[N]          - sample rows
+ *   I  Bj[N]          - sample columns
+ *   I  sorted_indices - nonzero if the rows of A have sorted indices
+ *   I  n_threads      - number of threads (<= 0 means the default)
  *
  * Output Arguments:
- *   T  Bx[N]         - sample values
+ *   T  Bx[N]          - sample values
  *
  * Note:
- *   Output array Yx must be preallocated
+ *   Output array Bx must be preallocated
+ *   Negative sample indices count from the end.  Duplicate entries of
+ *   A are summed.
+ *
+ *   When there are few samples compared to rows, each sample is looked
+ *   up on its own: by binary search in sorted rows, by linear search
+ *   otherwise.  Otherwise the samples are grouped by row (counting
+ *   sort), and each row with k samples and L entries is searched by
+ *     - binary search per sample, if sorted and k*log2(L) <= L
+ *     - sorting its samples and merging them with the row, if sorted
+ *     - linear search per sample, if unsorted and k <= 4
+ *     - a hash table of the row, if unsorted
+ *   Rows are split between threads by number of samples.
+ *
+ *   Complexity: O(n_samples * log(nnz(A)) + n_row) when A is sorted,
+ *   O(n_samples + nnz(A) + n_row) otherwise, at worst
  *
- *   Complexity: varies 
+ */
+template <class I, class T>
+void csr_sample_values_threads(const I n_row,
+                               const I n_col,
+                               const I Ap[],
+                               const I Aj[],
+                               const T Ax[],
+                               const I n_samples,
+                               const I Bi[],
+                               const I Bj[],
+                                     T Bx[],
+                               const I sorted_indices,
+                               const I n_threads)
+{
+    const bool sorted = (sorted_indices != 0);
+
+    if(8 * (long long) n_samples < (long long) n_row){
+        const I t = sparsetools_num_threads(n_threads, n_samples);
+        (void) t; // only used by OpenMP
+        SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static))
+        for(I n = 0; n < n_samples; n++){
+            const I i = Bi[n] < 0 ? Bi[n] + n_row : Bi[n]; // sample row
+            const I j = Bj[n] < 0 ? Bj[n] + n_col : Bj[n]; // sample column
+            Bx[n] = csr_sample_one(Ap, Aj, Ax, i, j, sorted);
+        }
+        return;
+    }
+
+    // group the samples by row
+    std::vector<I> ptr(n_row + 1, 0), order(n_samples);
+    for(I n = 0; n < n_samples; n++){
+        ptr[(Bi[n] < 0 ? Bi[n] + n_row : Bi[n]) + 1]++;
+    }
+    for(I i = 0; i < n_row; i++){
+        ptr[i+1] += ptr[i];
+    }
+    for(I n = 0; n < n_samples; n++){
+        const I i = Bi[n] < 0 ? Bi[n] + n_row : Bi[n];
+        order[ptr[i]++] = n;
+    }
+    for(I i = n_row; i > 0; i--){
+        ptr[i] = ptr[i-1];
+    }
+    ptr[0] = 0;
+
+    const I t = sparsetools_num_threads(n_threads, n_row);
+    std::vector<I> bounds(t + 1);
+    balanced_row_partition(n_row, &ptr[0], t, &bounds[0]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        std::vector< std::pair<I,I> > samples;
+        std::vector<I> keys;
+        std::vector<T> vals;
+
+        for(I i = bounds[p]; i < bounds[p+1]; i++){
+            const I k = ptr[i+1] - ptr[i];
+            if(k == 0) continue;
+
+            const I * row_samples = &order[ptr[i]];
+            const I row_start = Ap[i];
+            const I row_end   = Ap[i+1];
+            const I L = row_end - row_start;
+
+            I log2L = 0;
+            while((I(1) << log2L) < L){
+                log2L++;
+            }
+
+            if(L == 0 || (sorted && (long long) k * log2L <= L)
+                      || (!sorted && k <= 4)){
+                for(I m = 0; m < k; m++){
+                    const I n = row_samples[m];
+                    const I j = Bj[n] < 0 ? Bj[n] + n_col : Bj[n];
+                    Bx[n] = csr_sample_one(Ap, Aj, Ax, i, j, sorted);
+                }
+            } else if(sorted){
+                // merge the sorted samples with the row
+                samples.resize(k);
+                for(I m = 0; m < k; m++){
+                    const I n = row_samples[m];
+                    samples[m].first  = Bj[n] < 0 ? Bj[n] + n_col : Bj[n];
+                    samples[m].second = n;
+                }
+                std::sort(samples.begin(), samples.end());
+
+                I jj = row_start;
+                for(I m = 0; m < k; m++){
+                    const I j = samples[m].first;
+                    while(jj < row_end && Aj[jj] < j){
+                        jj++;
+                    }
+                    T x = 0;
+                    for(I kk = jj; kk < row_end && Aj[kk] == j; kk++){
+                        x += Ax[kk];
+                    }
+                    Bx[samples[m].second] = x;
+                }
+            } else {
+                // open addressing hash table of the row, with at least
+                // twice as many slots as entries
+                const std::size_t size = std::size_t(1) << (log2L + 1);
+                const std::size_t mask = size - 1;
+                if(keys.size() < size){
+                    keys.resize(size);
+                    vals.resize(size);
+                }
+                std::fill(keys.begin(), keys.begin() + size, -1);
+
+                for(I jj = row_start; jj < row_end; jj++){
+                    std::size_t h = ((std::size_t) Aj[jj] * 2654435761u) & mask;
+                    while(keys[h] != -1 && keys[h] != Aj[jj]){
+                        h = (h + 1) & mask;
+                    }
+                    if(keys[h] == -1){
+                        keys[h] = Aj[jj];
+                        vals[h] = Ax[jj];
+                    } else {
+                        vals[h] += Ax[jj];
+                    }
+                }
+
+                for(I m = 0; m < k; m++){
+                    const I n = row_samples[m];
+                    const I j = Bj[n] < 0 ? Bj[n] + n_col : Bj[n];
+                    std::size_t h = ((std::size_t) j * 2654435761u) & mask;
+                    while(keys[h] != -1 && keys[h] != j){
+                        h = (h + 1) & mask;
+                    }
+                    Bx[n] = (keys[h] == j) ? vals[h] : T(0);
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * Sample the matrix at specific locations
  *
- *   TODO handle other cases with asymptotically optimal method
+ * Single threaded csr_sample_values_threads.  The rows of A are checked
+ * for sorted indices only when there are many samples, since the check
+ * costs O(nnz(A)).
  *
  */
 template <class I, class T>
@@ -1183,70 +2760,81 @@ void csr_sample_values(const I n_row,
                        const I Bj[],
                              T Bx[])
 {
-    // ideally we'd do the following
-    // Case 1: A is canonical and B is sorted by row and column
-    //   -> special purpose csr_binop_csr() (optimized form)
-    // Case 2: A is canonical and B is unsorted and max(log(Ap[i+1] - Ap[i])) > log(num_samples)
-    //   -> do binary searches for each sample
-    // Case 3: A is canonical and B is unsorted and max(log(Ap[i+1] - Ap[i])) < log(num_samples)
-    //   -> sort B by row and column and use Case 1
-    // Case 4: A is not canonical and num_samples ~ nnz
-    //   -> special purpose csr_binop_csr() (general form)
-    // Case 5: A is not canonical and num_samples << nnz
-    //   -> do linear searches for each sample
-
     const I nnz = Ap[n_row];
 
     const I threshold = nnz / 10; // constant is arbitrary
 
-    if (n_samples > threshold && csr_has_canonical_format(n_row, Ap, Aj))
-    {
-        for(I n = 0; n < n_samples; n++)
-        {
-            const I i = Bi[n] < 0 ? Bi[n] + n_row : Bi[n]; // sample row
-            const I j = Bj[n] < 0 ? Bj[n] + n_col : Bj[n]; // sample column
-   
-            const I row_start = Ap[i];
-            const I row_end   = Ap[i+1];
-            
-            if (row_start < row_end)
-            {
-                const I offset = std::lower_bound(Aj + row_start, Aj + row_end, j) - Aj;
-                
-                if (offset < row_end && Aj[offset] == j)
-                    Bx[n] = Ax[offset];
-                else
-                    Bx[n] = 0;
-            }
-            else
-            {
-                Bx[n] = 0;
-            }
-    
+    const I sorted = (n_samples > threshold &&
+                      csr_has_sorted_indices(n_row, Ap, Aj)) ? 1 : 0;
+
+    csr_sample_values_threads(n_row, n_col, Ap, Aj, Ax, n_samples, Bi, Bj, Bx,
+                              sorted, (I) 1);
+}
+
+
+/*
+ * Add values into the existing entries of a canonical CSR matrix
+ *
+ *    A(Bi[n],Bj[n]) += Bx[n]
+ *
+ * Input Arguments:
+ *   I  n_row         - number of rows in A
+ *   I  n_col         - number of columns in A
+ *   I  Ap[n_row+1]   - row pointer
+ *   I  Aj[nnz(A)]    - column indices
+ *   T  Ax[nnz(A)]    - nonzeros
+ *   I  n_samples     - number of values to add
+ *   I  Bi[N]         - rows
+ *   I  Bj[N]         - columns
+ *   T  Bx[N]         - values
+ *
+ * Output Arguments:
+ *   T  Ax[nnz(A)]    - nonzeros (modified inplace)
+ *   I  flag[N]       - 1 where A has no entry at (Bi[n],Bj[n]), else 0
+ *
+ * Returns:
+ *   The number of values that were not added (the sum of flag)
+ *
+ * Note:
+ *   A must be in canonical format (sorted indices, no duplicates).
+ *   Indices must be in range.  Values flagged as missing are left to
+ *   the caller, which typically adds them to the sparsity pattern.
+ *
+ *   Complexity: O(N * log(max row length))
+ *
+ */
+template <class I, class T>
+I csr_add_coo(const I n_row,
+              const I n_col,
+              const I Ap[],
+              const I Aj[],
+                    T Ax[],
+              const I n_samples,
+              const I Bi[],
+              const I Bj[],
+              const T Bx[],
+                    I flag[])
+{
+    I n_missing = 0;
+
+    for(I n = 0; n < n_samples; n++){
+        const I i = Bi[n];
+        const I j = Bj[n];
+
+        const I * row_start = Aj + Ap[i];
+        const I * row_end   = Aj + Ap[i+1];
+        const I * pos = std::lower_bound(row_start, row_end, j);
+
+        if(pos != row_end && *pos == j){
+            Ax[pos - Aj] += Bx[n];
+            flag[n] = 0;
+        } else {
+            flag[n] = 1;
+            n_missing++;
         }
     }
-    else
-    {
-        for(I n = 0; n < n_samples; n++)
-        {
-            const I i = Bi[n] < 0 ? Bi[n] + n_row : Bi[n]; // sample row
-            const I j = Bj[n] < 0 ? Bj[n] + n_col : Bj[n]; // sample column
-    
-            const I row_start = Ap[i];
-            const I row_end   = Ap[i+1];
-           
-            T x = 0;
-            
-            for(I jj = row_start; jj < row_end; jj++)
-            {
-                if (Aj[jj] == j)
-                    x += Ax[jj];
-            }
-    
-            Bx[n] = x;
-        }
 
-    }
+    return n_missing;
 }
 
 #endif
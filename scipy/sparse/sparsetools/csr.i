@@ -4,31 +4,67 @@
 
 %{
 #include "csr.h"
+#include "sell.h"
+#include "triangular.h"
+#include "ilu.h"
+#include "krylov.h"
 %}
 
 %include "csr.h" 
+%include "sell.h"
+%include "triangular.h"
+%include "ilu.h"
+%include "krylov.h"
 
 
 INSTANTIATE_INDEX(expandptr)
 INSTANTIATE_INDEX(csr_matmat_pass1)
+INSTANTIATE_INDEX(csr_matmat_pass1_threads)
 INSTANTIATE_INDEX(csr_count_blocks)
 INSTANTIATE_INDEX(csr_has_sorted_indices)
+INSTANTIATE_INDEX(csr_triangular_levels)
 
 INSTANTIATE_ALL(csr_diagonal)
 INSTANTIATE_ALL(csr_scale_rows)
 INSTANTIATE_ALL(csr_scale_columns)
 INSTANTIATE_ALL(csr_tocsc)
+INSTANTIATE_ALL(csr_tocsc_threads)
 INSTANTIATE_ALL(csr_tobsr)
 INSTANTIATE_ALL(csr_matmat_pass2)
+INSTANTIATE_ALL(csr_matmat_pass2_threads)
 INSTANTIATE_ALL(csr_matvec)
 INSTANTIATE_ALL(csr_matvecs)
+INSTANTIATE_ALL(csr_matvec_threads)
+INSTANTIATE_ALL(csr_matvecs_threads)
 INSTANTIATE_ALL(csr_elmul_csr)
 INSTANTIATE_ALL(csr_eldiv_csr)
 INSTANTIATE_ALL(csr_plus_csr)
 INSTANTIATE_ALL(csr_minus_csr)
+INSTANTIATE_ALL(csr_linear_combination)
+INSTANTIATE_ALL(csr_linear_combination_elmul)
+INSTANTIATE_ALL(csr_kron)
+INSTANTIATE_ALL(csr_kronsum)
+INSTANTIATE_ALL(csr_bmat)
 INSTANTIATE_ALL(csr_sort_indices)
+INSTANTIATE_ALL(csr_sort_indices_threads)
+INSTANTIATE_ALL(csr_symmetric_permute)
 INSTANTIATE_ALL(csr_eliminate_zeros)
 INSTANTIATE_ALL(csr_sum_duplicates)
 INSTANTIATE_ALL(get_csr_submatrix)
 INSTANTIATE_ALL(csr_sample_values)
+INSTANTIATE_ALL(csr_sample_values_threads)
+INSTANTIATE_ALL(csr_row_index)
+INSTANTIATE_ALL(csr_column_index)
+INSTANTIATE_ALL(csr_add_coo)
 
+INSTANTIATE_ALL(csr_tosell)
+INSTANTIATE_ALL(sell_matvec)
+INSTANTIATE_ALL(sell_matvecs)
+
+INSTANTIATE_ALL(csr_triangular_solve)
+INSTANTIATE_ALL(csr_triangular_solve_levels)
+
+INSTANTIATE_REAL(csr_ilu0)
+INSTANTIATE_REAL(csr_ic0)
+INSTANTIATE_REAL(csr_ilut)
+INSTANTIATE_REAL(krylov_solve)
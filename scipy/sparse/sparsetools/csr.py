@@ -67,25 +67,55 @@ except AttributeError:
 
 
 
+KRYLOV_HEADER = _csr.KRYLOV_HEADER
+
 def expandptr(*args):
-  """expandptr(int n_row, int Ap, int Bi)"""
+  """
+    expandptr(int n_row, int Ap, int Bi)
+    expandptr(long long n_row, long long Ap, long long Bi)
+    """
   return _csr.expandptr(*args)
 
 def csr_matmat_pass1(*args):
   """
     csr_matmat_pass1(int n_row, int n_col, int Ap, int Aj, int Bp, int Bj, 
         int Cp)
+    csr_matmat_pass1(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Bp, long long Bj, long long Cp)
     """
   return _csr.csr_matmat_pass1(*args)
 
+def csr_matmat_pass1_threads(*args):
+  """
+    csr_matmat_pass1_threads(int n_row, int n_col, int Ap, int Aj, int Bp, int Bj, 
+        int Cp, int n_threads)
+    csr_matmat_pass1_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Bp, long long Bj, long long Cp, 
+        long long n_threads)
+    """
+  return _csr.csr_matmat_pass1_threads(*args)
+
 def csr_count_blocks(*args):
-  """csr_count_blocks(int n_row, int n_col, int R, int C, int Ap, int Aj) -> int"""
+  """
+    csr_count_blocks(int n_row, int n_col, int R, int C, int Ap, int Aj) -> int
+    csr_count_blocks(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj) -> long long
+    """
   return _csr.csr_count_blocks(*args)
 
 def csr_has_sorted_indices(*args):
-  """csr_has_sorted_indices(int n_row, int Ap, int Aj) -> bool"""
+  """
+    csr_has_sorted_indices(int n_row, int Ap, int Aj) -> bool
+    csr_has_sorted_indices(long long n_row, long long Ap, long long Aj) -> bool
+    """
   return _csr.csr_has_sorted_indices(*args)
 
+def csr_triangular_levels(*args):
+  """
+    csr_triangular_levels(int n_row, int Ap, int Aj, int lower)
+    csr_triangular_levels(long long n_row, long long Ap, long long Aj, long long lower)
+    """
+  return _csr.csr_triangular_levels(*args)
 
 def csr_diagonal(*args):
   """
@@ -113,6 +143,34 @@ def csr_diagonal(*args):
         npy_cdouble_wrapper Yx)
     csr_diagonal(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, signed char Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, unsigned char Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, short Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, unsigned short Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, int Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, unsigned int Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, unsigned long long Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, float Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, double Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long double Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Yx)
+    csr_diagonal(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Yx)
     """
   return _csr.csr_diagonal(*args)
 
@@ -142,6 +200,34 @@ def csr_scale_rows(*args):
         npy_cdouble_wrapper Xx)
     csr_scale_rows(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, signed char Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, unsigned char Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, short Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, unsigned short Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, int Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, unsigned int Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, unsigned long long Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, float Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, double Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long double Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx)
+    csr_scale_rows(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx)
     """
   return _csr.csr_scale_rows(*args)
 
@@ -171,6 +257,34 @@ def csr_scale_columns(*args):
         npy_cdouble_wrapper Xx)
     csr_scale_columns(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, signed char Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, unsigned char Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, short Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, unsigned short Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, int Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, unsigned int Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, unsigned long long Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, float Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, double Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long double Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx)
+    csr_scale_columns(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx)
     """
   return _csr.csr_scale_columns(*args)
 
@@ -204,9 +318,131 @@ def csr_tocsc(*args):
         int Bp, int Bi, npy_cdouble_wrapper Bx)
     csr_tocsc(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long Bp, long long Bi, 
+        signed char Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long Bp, long long Bi, 
+        unsigned char Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long Bp, long long Bi, 
+        short Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long Bp, long long Bi, 
+        unsigned short Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long Bp, long long Bi, 
+        int Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long Bp, long long Bi, 
+        unsigned int Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Bp, long long Bi, 
+        long long Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long Bp, 
+        long long Bi, unsigned long long Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long Bp, long long Bi, 
+        float Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long Bp, long long Bi, 
+        double Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long Bp, long long Bi, 
+        long double Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bi, npy_cfloat_wrapper Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_cdouble_wrapper Bx)
+    csr_tocsc(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_clongdouble_wrapper Bx)
     """
   return _csr.csr_tocsc(*args)
 
+def csr_tocsc_threads(*args):
+  """
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
+        int Bp, int Bi, signed char Bx, int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, unsigned char Ax, 
+        int Bp, int Bi, unsigned char Bx, int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, short Ax, int Bp, 
+        int Bi, short Bx, int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, unsigned short Ax, 
+        int Bp, int Bi, unsigned short Bx, int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, int Ax, int Bp, 
+        int Bi, int Bx, int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, unsigned int Ax, 
+        int Bp, int Bi, unsigned int Bx, int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, long long Ax, 
+        int Bp, int Bi, long long Bx, int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, unsigned long long Ax, 
+        int Bp, int Bi, unsigned long long Bx, 
+        int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, float Ax, int Bp, 
+        int Bi, float Bx, int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, double Ax, int Bp, 
+        int Bi, double Bx, int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, long double Ax, 
+        int Bp, int Bi, long double Bx, int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int Bp, int Bi, npy_cfloat_wrapper Bx, 
+        int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int Bp, int Bi, npy_cdouble_wrapper Bx, 
+        int n_threads)
+    csr_tocsc_threads(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int Bp, int Bi, npy_clongdouble_wrapper Bx, 
+        int n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long Bp, long long Bi, 
+        signed char Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long Bp, long long Bi, 
+        unsigned char Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long Bp, long long Bi, 
+        short Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long Bp, long long Bi, 
+        unsigned short Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long Bp, long long Bi, 
+        int Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long Bp, long long Bi, 
+        unsigned int Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Bp, long long Bi, 
+        long long Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long Bp, 
+        long long Bi, unsigned long long Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long Bp, long long Bi, 
+        float Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long Bp, long long Bi, 
+        double Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long Bp, long long Bi, 
+        long double Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bi, npy_cfloat_wrapper Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_cdouble_wrapper Bx, long long n_threads)
+    csr_tocsc_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bi, npy_clongdouble_wrapper Bx, 
+        long long n_threads)
+    """
+  return _csr.csr_tocsc_threads(*args)
+
 def csr_tobsr(*args):
   """
     csr_tobsr(int n_row, int n_col, int R, int C, int Ap, int Aj, 
@@ -238,6 +474,49 @@ def csr_tobsr(*args):
     csr_tobsr(int n_row, int n_col, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, int Bp, int Bj, 
         npy_clongdouble_wrapper Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, signed char Ax, 
+        long long Bp, long long Bj, signed char Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned char Ax, 
+        long long Bp, long long Bj, unsigned char Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, short Ax, 
+        long long Bp, long long Bj, short Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned short Ax, 
+        long long Bp, long long Bj, unsigned short Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, int Ax, 
+        long long Bp, long long Bj, int Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned int Ax, 
+        long long Bp, long long Bj, unsigned int Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, long long Ax, 
+        long long Bp, long long Bj, long long Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, unsigned long long Ax, 
+        long long Bp, long long Bj, unsigned long long Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, float Ax, 
+        long long Bp, long long Bj, float Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, double Ax, 
+        long long Bp, long long Bj, double Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, long double Ax, 
+        long long Bp, long long Bj, long double Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        long long Bp, long long Bj, npy_cfloat_wrapper Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        long long Bp, long long Bj, npy_cdouble_wrapper Bx)
+    csr_tobsr(long long n_row, long long n_col, long long R, long long C, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        long long Bp, long long Bj, 
+        npy_clongdouble_wrapper Bx)
     """
   return _csr.csr_tobsr(*args)
 
@@ -281,9 +560,169 @@ def csr_matmat_pass2(*args):
     csr_matmat_pass2(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx, 
         int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long Bp, long long Bj, 
+        signed char Bx, long long Cp, long long Cj, 
+        signed char Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long Bp, long long Bj, 
+        unsigned char Bx, long long Cp, long long Cj, 
+        unsigned char Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long Bp, long long Bj, 
+        short Bx, long long Cp, long long Cj, short Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long Bp, long long Bj, 
+        unsigned short Bx, long long Cp, 
+        long long Cj, unsigned short Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long Bp, long long Bj, 
+        int Bx, long long Cp, long long Cj, int Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long Bp, long long Bj, 
+        unsigned int Bx, long long Cp, long long Cj, 
+        unsigned int Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Bp, long long Bj, 
+        long long Bx, long long Cp, long long Cj, 
+        long long Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long Bp, 
+        long long Bj, unsigned long long Bx, long long Cp, 
+        long long Cj, unsigned long long Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long Bp, long long Bj, 
+        float Bx, long long Cp, long long Cj, float Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long Bp, long long Bj, 
+        double Bx, long long Cp, long long Cj, double Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long Bp, long long Bj, 
+        long double Bx, long long Cp, long long Cj, 
+        long double Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bj, npy_cfloat_wrapper Bx, long long Cp, 
+        long long Cj, npy_cfloat_wrapper Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Cj, npy_cdouble_wrapper Cx)
+    csr_matmat_pass2(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Cj, npy_clongdouble_wrapper Cx)
     """
   return _csr.csr_matmat_pass2(*args)
 
+def csr_matmat_pass2_threads(*args):
+  """
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
+        int Bp, int Bj, signed char Bx, int Cp, int Cj, 
+        signed char Cx, int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, unsigned char Ax, 
+        int Bp, int Bj, unsigned char Bx, int Cp, 
+        int Cj, unsigned char Cx, int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, short Ax, int Bp, 
+        int Bj, short Bx, int Cp, int Cj, short Cx, 
+        int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, unsigned short Ax, 
+        int Bp, int Bj, unsigned short Bx, int Cp, 
+        int Cj, unsigned short Cx, int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, int Ax, int Bp, 
+        int Bj, int Bx, int Cp, int Cj, int Cx, int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, unsigned int Ax, 
+        int Bp, int Bj, unsigned int Bx, int Cp, 
+        int Cj, unsigned int Cx, int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, long long Ax, 
+        int Bp, int Bj, long long Bx, int Cp, int Cj, 
+        long long Cx, int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, unsigned long long Ax, 
+        int Bp, int Bj, unsigned long long Bx, 
+        int Cp, int Cj, unsigned long long Cx, int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, float Ax, int Bp, 
+        int Bj, float Bx, int Cp, int Cj, float Cx, 
+        int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, double Ax, int Bp, 
+        int Bj, double Bx, int Cp, int Cj, double Cx, 
+        int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, long double Ax, 
+        int Bp, int Bj, long double Bx, int Cp, int Cj, 
+        long double Cx, int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int Bp, int Bj, npy_cfloat_wrapper Bx, 
+        int Cp, int Cj, npy_cfloat_wrapper Cx, int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int Bp, int Bj, npy_cdouble_wrapper Bx, 
+        int Cp, int Cj, npy_cdouble_wrapper Cx, 
+        int n_threads)
+    csr_matmat_pass2_threads(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int Bp, int Bj, npy_clongdouble_wrapper Bx, 
+        int Cp, int Cj, npy_clongdouble_wrapper Cx, 
+        int n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long Bp, long long Bj, 
+        signed char Bx, long long Cp, long long Cj, 
+        signed char Cx, long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long Bp, long long Bj, 
+        unsigned char Bx, long long Cp, long long Cj, 
+        unsigned char Cx, long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long Bp, long long Bj, 
+        short Bx, long long Cp, long long Cj, short Cx, 
+        long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long Bp, long long Bj, 
+        unsigned short Bx, long long Cp, 
+        long long Cj, unsigned short Cx, long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long Bp, long long Bj, 
+        int Bx, long long Cp, long long Cj, int Cx, 
+        long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long Bp, long long Bj, 
+        unsigned int Bx, long long Cp, long long Cj, 
+        unsigned int Cx, long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Bp, long long Bj, 
+        long long Bx, long long Cp, long long Cj, 
+        long long Cx, long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long Bp, 
+        long long Bj, unsigned long long Bx, long long Cp, 
+        long long Cj, unsigned long long Cx, 
+        long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long Bp, long long Bj, 
+        float Bx, long long Cp, long long Cj, float Cx, 
+        long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long Bp, long long Bj, 
+        double Bx, long long Cp, long long Cj, double Cx, 
+        long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long Bp, long long Bj, 
+        long double Bx, long long Cp, long long Cj, 
+        long double Cx, long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bj, npy_cfloat_wrapper Bx, long long Cp, 
+        long long Cj, npy_cfloat_wrapper Cx, 
+        long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Cj, npy_cdouble_wrapper Cx, 
+        long long n_threads)
+    csr_matmat_pass2_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Cj, npy_clongdouble_wrapper Cx, 
+        long long n_threads)
+    """
+  return _csr.csr_matmat_pass2_threads(*args)
+
 def csr_matvec(*args):
   """
     csr_matvec(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
@@ -314,6 +753,41 @@ def csr_matvec(*args):
         npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
     csr_matvec(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, signed char Xx, signed char Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, unsigned char Xx, 
+        unsigned char Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, short Xx, short Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, unsigned short Xx, 
+        unsigned short Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, int Xx, int Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, unsigned int Xx, 
+        unsigned int Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Xx, long long Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, unsigned long long Xx, 
+        unsigned long long Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, float Xx, float Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, double Xx, double Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long double Xx, long double Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    csr_matvec(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
     """
   return _csr.csr_matvec(*args)
 
@@ -351,9 +825,215 @@ def csr_matvecs(*args):
     csr_matvecs(int n_row, int n_col, int n_vecs, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx, 
         npy_clongdouble_wrapper Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, signed char Ax, 
+        signed char Xx, signed char Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, short Ax, short Xx, 
+        short Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, int Ax, int Xx, 
+        int Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, long long Ax, long long Xx, 
+        long long Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, unsigned long long Ax, 
+        unsigned long long Xx, unsigned long long Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, float Ax, float Xx, 
+        float Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, double Ax, double Xx, 
+        double Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, long double Ax, 
+        long double Xx, long double Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    csr_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
     """
   return _csr.csr_matvecs(*args)
 
+def csr_matvec_threads(*args):
+  """
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
+        signed char Xx, signed char Yx, int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx, int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, short Ax, short Xx, 
+        short Yx, int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx, int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, int Ax, int Xx, 
+        int Yx, int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx, int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, long long Ax, 
+        long long Xx, long long Yx, int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, unsigned long long Ax, 
+        unsigned long long Xx, unsigned long long Yx, 
+        int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, float Ax, float Xx, 
+        float Yx, int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, double Ax, double Xx, 
+        double Yx, int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, long double Ax, 
+        long double Xx, long double Yx, int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx, 
+        int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx, 
+        int n_threads)
+    csr_matvec_threads(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx, 
+        int n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, signed char Xx, signed char Yx, 
+        long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, unsigned char Xx, 
+        unsigned char Yx, long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, short Xx, short Yx, long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, unsigned short Xx, 
+        unsigned short Yx, long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, int Xx, int Yx, long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, unsigned int Xx, 
+        unsigned int Yx, long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Xx, long long Yx, 
+        long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, unsigned long long Xx, 
+        unsigned long long Yx, long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, float Xx, float Yx, long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, double Xx, double Yx, long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long double Xx, long double Yx, 
+        long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx, long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx, long long n_threads)
+    csr_matvec_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx, 
+        long long n_threads)
+    """
+  return _csr.csr_matvec_threads(*args)
+
+def csr_matvecs_threads(*args):
+  """
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, signed char Ax, 
+        signed char Xx, signed char Yx, 
+        int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx, 
+        int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, short Ax, 
+        short Xx, short Yx, int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx, 
+        int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, int Ax, 
+        int Xx, int Yx, int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx, 
+        int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, long long Ax, 
+        long long Xx, long long Yx, int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, unsigned long long Ax, 
+        unsigned long long Xx, 
+        unsigned long long Yx, int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, float Ax, 
+        float Xx, float Yx, int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, double Ax, 
+        double Xx, double Yx, int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, long double Ax, 
+        long double Xx, long double Yx, 
+        int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx, int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx, int n_threads)
+    csr_matvecs_threads(int n_row, int n_col, int n_vecs, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx, int n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, signed char Ax, 
+        signed char Xx, signed char Yx, long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx, long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, short Ax, short Xx, 
+        short Yx, long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx, long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, int Ax, int Xx, 
+        int Yx, long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx, long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, long long Ax, long long Xx, 
+        long long Yx, long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, unsigned long long Ax, 
+        unsigned long long Xx, unsigned long long Yx, 
+        long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, float Ax, float Xx, 
+        float Yx, long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, double Ax, double Xx, 
+        double Yx, long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, long double Ax, 
+        long double Xx, long double Yx, long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx, 
+        long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx, 
+        long long n_threads)
+    csr_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx, 
+        long long n_threads)
+    """
+  return _csr.csr_matvecs_threads(*args)
+
 def csr_elmul_csr(*args):
   """
     csr_elmul_csr(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
@@ -394,6 +1074,58 @@ def csr_elmul_csr(*args):
     csr_elmul_csr(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx, 
         int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long Bp, long long Bj, 
+        signed char Bx, long long Cp, long long Cj, 
+        signed char Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long Bp, long long Bj, 
+        unsigned char Bx, long long Cp, long long Cj, 
+        unsigned char Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long Bp, long long Bj, 
+        short Bx, long long Cp, long long Cj, short Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long Bp, long long Bj, 
+        unsigned short Bx, long long Cp, 
+        long long Cj, unsigned short Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long Bp, long long Bj, 
+        int Bx, long long Cp, long long Cj, int Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long Bp, long long Bj, 
+        unsigned int Bx, long long Cp, long long Cj, 
+        unsigned int Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Bp, long long Bj, 
+        long long Bx, long long Cp, long long Cj, 
+        long long Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long Bp, 
+        long long Bj, unsigned long long Bx, long long Cp, 
+        long long Cj, unsigned long long Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long Bp, long long Bj, 
+        float Bx, long long Cp, long long Cj, float Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long Bp, long long Bj, 
+        double Bx, long long Cp, long long Cj, double Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long Bp, long long Bj, 
+        long double Bx, long long Cp, long long Cj, 
+        long double Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bj, npy_cfloat_wrapper Bx, long long Cp, 
+        long long Cj, npy_cfloat_wrapper Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Cj, npy_cdouble_wrapper Cx)
+    csr_elmul_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Cj, npy_clongdouble_wrapper Cx)
     """
   return _csr.csr_elmul_csr(*args)
 
@@ -437,6 +1169,58 @@ def csr_eldiv_csr(*args):
     csr_eldiv_csr(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx, 
         int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long Bp, long long Bj, 
+        signed char Bx, long long Cp, long long Cj, 
+        signed char Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long Bp, long long Bj, 
+        unsigned char Bx, long long Cp, long long Cj, 
+        unsigned char Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long Bp, long long Bj, 
+        short Bx, long long Cp, long long Cj, short Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long Bp, long long Bj, 
+        unsigned short Bx, long long Cp, 
+        long long Cj, unsigned short Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long Bp, long long Bj, 
+        int Bx, long long Cp, long long Cj, int Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long Bp, long long Bj, 
+        unsigned int Bx, long long Cp, long long Cj, 
+        unsigned int Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Bp, long long Bj, 
+        long long Bx, long long Cp, long long Cj, 
+        long long Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long Bp, 
+        long long Bj, unsigned long long Bx, long long Cp, 
+        long long Cj, unsigned long long Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long Bp, long long Bj, 
+        float Bx, long long Cp, long long Cj, float Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long Bp, long long Bj, 
+        double Bx, long long Cp, long long Cj, double Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long Bp, long long Bj, 
+        long double Bx, long long Cp, long long Cj, 
+        long double Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bj, npy_cfloat_wrapper Bx, long long Cp, 
+        long long Cj, npy_cfloat_wrapper Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Cj, npy_cdouble_wrapper Cx)
+    csr_eldiv_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Cj, npy_clongdouble_wrapper Cx)
     """
   return _csr.csr_eldiv_csr(*args)
 
@@ -480,6 +1264,58 @@ def csr_plus_csr(*args):
     csr_plus_csr(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx, 
         int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long Bp, long long Bj, 
+        signed char Bx, long long Cp, long long Cj, 
+        signed char Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long Bp, long long Bj, 
+        unsigned char Bx, long long Cp, long long Cj, 
+        unsigned char Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long Bp, long long Bj, 
+        short Bx, long long Cp, long long Cj, short Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long Bp, long long Bj, 
+        unsigned short Bx, long long Cp, 
+        long long Cj, unsigned short Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long Bp, long long Bj, 
+        int Bx, long long Cp, long long Cj, int Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long Bp, long long Bj, 
+        unsigned int Bx, long long Cp, long long Cj, 
+        unsigned int Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Bp, long long Bj, 
+        long long Bx, long long Cp, long long Cj, 
+        long long Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long Bp, 
+        long long Bj, unsigned long long Bx, long long Cp, 
+        long long Cj, unsigned long long Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long Bp, long long Bj, 
+        float Bx, long long Cp, long long Cj, float Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long Bp, long long Bj, 
+        double Bx, long long Cp, long long Cj, double Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long Bp, long long Bj, 
+        long double Bx, long long Cp, long long Cj, 
+        long double Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bj, npy_cfloat_wrapper Bx, long long Cp, 
+        long long Cj, npy_cfloat_wrapper Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Cj, npy_cdouble_wrapper Cx)
+    csr_plus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Cj, npy_clongdouble_wrapper Cx)
     """
   return _csr.csr_plus_csr(*args)
 
@@ -523,9 +1359,521 @@ def csr_minus_csr(*args):
     csr_minus_csr(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx, 
         int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long Bp, long long Bj, 
+        signed char Bx, long long Cp, long long Cj, 
+        signed char Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long Bp, long long Bj, 
+        unsigned char Bx, long long Cp, long long Cj, 
+        unsigned char Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long Bp, long long Bj, 
+        short Bx, long long Cp, long long Cj, short Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long Bp, long long Bj, 
+        unsigned short Bx, long long Cp, 
+        long long Cj, unsigned short Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long Bp, long long Bj, 
+        int Bx, long long Cp, long long Cj, int Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long Bp, long long Bj, 
+        unsigned int Bx, long long Cp, long long Cj, 
+        unsigned int Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long Bp, long long Bj, 
+        long long Bx, long long Cp, long long Cj, 
+        long long Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long Bp, 
+        long long Bj, unsigned long long Bx, long long Cp, 
+        long long Cj, unsigned long long Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long Bp, long long Bj, 
+        float Bx, long long Cp, long long Cj, float Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long Bp, long long Bj, 
+        double Bx, long long Cp, long long Cj, double Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long Bp, long long Bj, 
+        long double Bx, long long Cp, long long Cj, 
+        long double Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long Bp, 
+        long long Bj, npy_cfloat_wrapper Bx, long long Cp, 
+        long long Cj, npy_cfloat_wrapper Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_cdouble_wrapper Bx, long long Cp, 
+        long long Cj, npy_cdouble_wrapper Cx)
+    csr_minus_csr(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long Bp, 
+        long long Bj, npy_clongdouble_wrapper Bx, 
+        long long Cp, long long Cj, npy_clongdouble_wrapper Cx)
     """
   return _csr.csr_minus_csr(*args)
 
+def csr_linear_combination(*args):
+  """
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, signed char Ax, signed char Xx, int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, unsigned char Ax, unsigned char Xx, 
+        int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, short Ax, short Xx, int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, unsigned short Ax, unsigned short Xx, 
+        int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, int Ax, int Xx, int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, unsigned int Ax, unsigned int Xx, 
+        int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, long long Ax, long long Xx, int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, unsigned long long Ax, unsigned long long Xx, 
+        int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, float Ax, float Xx, int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, double Ax, double Xx, int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, long double Ax, long double Xx, int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx, 
+        int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx, 
+        int n_threads)
+    csr_linear_combination(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
+        int n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        signed char Ax, signed char Xx, long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        unsigned char Ax, unsigned char Xx, long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        short Ax, short Xx, long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        unsigned short Ax, unsigned short Xx, long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        int Ax, int Xx, long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        unsigned int Ax, unsigned int Xx, long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        long long Ax, long long Xx, long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        unsigned long long Ax, unsigned long long Xx, 
+        long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        float Ax, float Xx, long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        double Ax, double Xx, long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        long double Ax, long double Xx, long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx, 
+        long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx, 
+        long long n_threads)
+    csr_linear_combination(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
+        long long n_threads)
+    """
+  return _csr.csr_linear_combination(*args)
+
+def csr_linear_combination_elmul(*args):
+  """
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, signed char Ax, signed char Xx, int Bp, 
+        int Bj, signed char Bx, int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, unsigned char Ax, unsigned char Xx, 
+        int Bp, int Bj, unsigned char Bx, int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, short Ax, short Xx, int Bp, int Bj, 
+        short Bx, int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, unsigned short Ax, unsigned short Xx, 
+        int Bp, int Bj, unsigned short Bx, int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, int Ax, int Xx, int Bp, int Bj, int Bx, 
+        int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, unsigned int Ax, unsigned int Xx, 
+        int Bp, int Bj, unsigned int Bx, int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, long long Ax, long long Xx, int Bp, 
+        int Bj, long long Bx, int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, unsigned long long Ax, unsigned long long Xx, 
+        int Bp, int Bj, unsigned long long Bx, 
+        int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, float Ax, float Xx, int Bp, int Bj, 
+        float Bx, int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, double Ax, double Xx, int Bp, int Bj, 
+        double Bx, int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, long double Ax, long double Xx, int Bp, 
+        int Bj, long double Bx, int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx, 
+        int Bp, int Bj, npy_cfloat_wrapper Bx, 
+        int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx, 
+        int Bp, int Bj, npy_cdouble_wrapper Bx, 
+        int n_threads)
+    csr_linear_combination_elmul(int n_row, int n_col, int n_ops, int offsets, int Ap, 
+        int Aj, npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
+        int Bp, int Bj, npy_clongdouble_wrapper Bx, 
+        int n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        signed char Ax, signed char Xx, long long Bp, 
+        long long Bj, signed char Bx, long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        unsigned char Ax, unsigned char Xx, long long Bp, 
+        long long Bj, unsigned char Bx, long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        short Ax, short Xx, long long Bp, long long Bj, 
+        short Bx, long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        unsigned short Ax, unsigned short Xx, long long Bp, 
+        long long Bj, unsigned short Bx, long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        int Ax, int Xx, long long Bp, long long Bj, 
+        int Bx, long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        unsigned int Ax, unsigned int Xx, long long Bp, 
+        long long Bj, unsigned int Bx, long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        long long Ax, long long Xx, long long Bp, long long Bj, 
+        long long Bx, long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        unsigned long long Ax, unsigned long long Xx, 
+        long long Bp, long long Bj, unsigned long long Bx, 
+        long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        float Ax, float Xx, long long Bp, long long Bj, 
+        float Bx, long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        double Ax, double Xx, long long Bp, long long Bj, 
+        double Bx, long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        long double Ax, long double Xx, long long Bp, 
+        long long Bj, long double Bx, long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx, 
+        long long Bp, long long Bj, npy_cfloat_wrapper Bx, 
+        long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx, 
+        long long Bp, long long Bj, npy_cdouble_wrapper Bx, 
+        long long n_threads)
+    csr_linear_combination_elmul(long long n_row, long long n_col, long long n_ops, 
+        long long offsets, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
+        long long Bp, long long Bj, npy_clongdouble_wrapper Bx, 
+        long long n_threads)
+    """
+  return _csr.csr_linear_combination_elmul(*args)
+
+def csr_kron(*args):
+  """
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, signed char Ax, 
+        int n_rowB, int n_colB, int Bp, int Bj, 
+        signed char Bx, int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, unsigned char Ax, 
+        int n_rowB, int n_colB, int Bp, int Bj, 
+        unsigned char Bx, int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, short Ax, int n_rowB, 
+        int n_colB, int Bp, int Bj, short Bx, 
+        int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, unsigned short Ax, 
+        int n_rowB, int n_colB, int Bp, int Bj, 
+        unsigned short Bx, int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, int Ax, int n_rowB, 
+        int n_colB, int Bp, int Bj, int Bx, 
+        int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, unsigned int Ax, 
+        int n_rowB, int n_colB, int Bp, int Bj, 
+        unsigned int Bx, int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, long long Ax, 
+        int n_rowB, int n_colB, int Bp, int Bj, long long Bx, 
+        int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, unsigned long long Ax, 
+        int n_rowB, int n_colB, int Bp, int Bj, 
+        unsigned long long Bx, int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, float Ax, int n_rowB, 
+        int n_colB, int Bp, int Bj, float Bx, 
+        int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, double Ax, 
+        int n_rowB, int n_colB, int Bp, int Bj, double Bx, 
+        int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, long double Ax, 
+        int n_rowB, int n_colB, int Bp, int Bj, 
+        long double Bx, int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int n_rowB, int n_colB, int Bp, int Bj, 
+        npy_cfloat_wrapper Bx, int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int n_rowB, int n_colB, int Bp, 
+        int Bj, npy_cdouble_wrapper Bx, int n_threads)
+    csr_kron(int n_rowA, int n_colA, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int n_rowB, int n_colB, int Bp, 
+        int Bj, npy_clongdouble_wrapper Bx, int n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        signed char Ax, long long n_rowB, 
+        long long n_colB, long long Bp, long long Bj, 
+        signed char Bx, long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        unsigned char Ax, long long n_rowB, 
+        long long n_colB, long long Bp, long long Bj, 
+        unsigned char Bx, long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        short Ax, long long n_rowB, long long n_colB, 
+        long long Bp, long long Bj, short Bx, 
+        long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        unsigned short Ax, long long n_rowB, 
+        long long n_colB, long long Bp, long long Bj, 
+        unsigned short Bx, long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        int Ax, long long n_rowB, long long n_colB, 
+        long long Bp, long long Bj, int Bx, 
+        long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        unsigned int Ax, long long n_rowB, 
+        long long n_colB, long long Bp, long long Bj, 
+        unsigned int Bx, long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        long long Ax, long long n_rowB, 
+        long long n_colB, long long Bp, long long Bj, 
+        long long Bx, long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        unsigned long long Ax, long long n_rowB, 
+        long long n_colB, long long Bp, long long Bj, 
+        unsigned long long Bx, long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        float Ax, long long n_rowB, long long n_colB, 
+        long long Bp, long long Bj, float Bx, 
+        long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        double Ax, long long n_rowB, long long n_colB, 
+        long long Bp, long long Bj, double Bx, 
+        long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        long double Ax, long long n_rowB, 
+        long long n_colB, long long Bp, long long Bj, 
+        long double Bx, long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long n_rowB, 
+        long long n_colB, long long Bp, long long Bj, 
+        npy_cfloat_wrapper Bx, long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long n_rowB, 
+        long long n_colB, long long Bp, long long Bj, 
+        npy_cdouble_wrapper Bx, long long n_threads)
+    csr_kron(long long n_rowA, long long n_colA, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long n_rowB, 
+        long long n_colB, long long Bp, 
+        long long Bj, npy_clongdouble_wrapper Bx, long long n_threads)
+    """
+  return _csr.csr_kron(*args)
+
+def csr_kronsum(*args):
+  """
+    csr_kronsum(int n_A, int Ap, int Aj, signed char Ax, int n_B, int Bp, 
+        int Bj, signed char Bx, int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, unsigned char Ax, int n_B, 
+        int Bp, int Bj, unsigned char Bx, int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, short Ax, int n_B, int Bp, 
+        int Bj, short Bx, int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, unsigned short Ax, int n_B, 
+        int Bp, int Bj, unsigned short Bx, int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, int Ax, int n_B, int Bp, int Bj, 
+        int Bx, int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, unsigned int Ax, int n_B, 
+        int Bp, int Bj, unsigned int Bx, int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, long long Ax, int n_B, int Bp, 
+        int Bj, long long Bx, int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, unsigned long long Ax, int n_B, 
+        int Bp, int Bj, unsigned long long Bx, 
+        int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, float Ax, int n_B, int Bp, 
+        int Bj, float Bx, int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, double Ax, int n_B, int Bp, 
+        int Bj, double Bx, int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, long double Ax, int n_B, int Bp, 
+        int Bj, long double Bx, int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, npy_cfloat_wrapper Ax, int n_B, 
+        int Bp, int Bj, npy_cfloat_wrapper Bx, 
+        int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, npy_cdouble_wrapper Ax, int n_B, 
+        int Bp, int Bj, npy_cdouble_wrapper Bx, 
+        int n_threads)
+    csr_kronsum(int n_A, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int n_B, int Bp, int Bj, npy_clongdouble_wrapper Bx, 
+        int n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, signed char Ax, 
+        long long n_B, long long Bp, long long Bj, 
+        signed char Bx, long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, unsigned char Ax, 
+        long long n_B, long long Bp, long long Bj, 
+        unsigned char Bx, long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, short Ax, 
+        long long n_B, long long Bp, long long Bj, 
+        short Bx, long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, unsigned short Ax, 
+        long long n_B, long long Bp, long long Bj, 
+        unsigned short Bx, long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, int Ax, 
+        long long n_B, long long Bp, long long Bj, int Bx, 
+        long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, unsigned int Ax, 
+        long long n_B, long long Bp, long long Bj, 
+        unsigned int Bx, long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, long long Ax, 
+        long long n_B, long long Bp, long long Bj, 
+        long long Bx, long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, unsigned long long Ax, 
+        long long n_B, long long Bp, long long Bj, 
+        unsigned long long Bx, long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, float Ax, 
+        long long n_B, long long Bp, long long Bj, 
+        float Bx, long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, double Ax, 
+        long long n_B, long long Bp, long long Bj, 
+        double Bx, long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, long double Ax, 
+        long long n_B, long long Bp, long long Bj, 
+        long double Bx, long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        long long n_B, long long Bp, long long Bj, 
+        npy_cfloat_wrapper Bx, long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        long long n_B, long long Bp, 
+        long long Bj, npy_cdouble_wrapper Bx, long long n_threads)
+    csr_kronsum(long long n_A, long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        long long n_B, long long Bp, 
+        long long Bj, npy_clongdouble_wrapper Bx, 
+        long long n_threads)
+    """
+  return _csr.csr_kronsum(*args)
+
+def csr_bmat(*args):
+  """
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, signed char Ax, int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, unsigned char Ax, int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, short Ax, int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, unsigned short Ax, int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, int Ax, int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, unsigned int Ax, int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, long long Ax, int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, unsigned long long Ax, 
+        int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, float Ax, int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, double Ax, int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, long double Ax, int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int n_threads)
+    csr_bmat(int n_brow, int n_bcol, int rows, int cols, int offsets, 
+        int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, signed char Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, unsigned char Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, short Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, unsigned short Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, int Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, unsigned int Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, long long Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, unsigned long long Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, float Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, double Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, long double Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, npy_cfloat_wrapper Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, npy_cdouble_wrapper Ax, long long n_threads)
+    csr_bmat(long long n_brow, long long n_bcol, long long rows, 
+        long long cols, long long offsets, long long Ap, 
+        long long Aj, npy_clongdouble_wrapper Ax, 
+        long long n_threads)
+    """
+  return _csr.csr_bmat(*args)
+
 def csr_sort_indices(*args):
   """
     csr_sort_indices(int n_row, int Ap, int Aj, signed char Ax)
@@ -542,9 +1890,152 @@ def csr_sort_indices(*args):
     csr_sort_indices(int n_row, int Ap, int Aj, npy_cfloat_wrapper Ax)
     csr_sort_indices(int n_row, int Ap, int Aj, npy_cdouble_wrapper Ax)
     csr_sort_indices(int n_row, int Ap, int Aj, npy_clongdouble_wrapper Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, signed char Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, unsigned char Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, short Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, unsigned short Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, int Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, unsigned int Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, long long Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, unsigned long long Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, float Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, double Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, long double Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, npy_cfloat_wrapper Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, npy_cdouble_wrapper Ax)
+    csr_sort_indices(long long n_row, long long Ap, long long Aj, npy_clongdouble_wrapper Ax)
     """
   return _csr.csr_sort_indices(*args)
 
+def csr_sort_indices_threads(*args):
+  """
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, signed char Ax, int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, unsigned char Ax, int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, short Ax, int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, unsigned short Ax, int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, int Ax, int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, unsigned int Ax, int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, long long Ax, int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, unsigned long long Ax, int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, float Ax, int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, double Ax, int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, long double Ax, int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, npy_cfloat_wrapper Ax, int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int n_threads)
+    csr_sort_indices_threads(int n_row, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, signed char Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, unsigned char Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, short Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, unsigned short Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, int Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, unsigned int Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, long long Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, unsigned long long Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, float Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, double Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, long double Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        long long n_threads)
+    csr_sort_indices_threads(long long n_row, long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        long long n_threads)
+    """
+  return _csr.csr_sort_indices_threads(*args)
+
+def csr_symmetric_permute(*args):
+  """
+    csr_symmetric_permute(int n_row, int Ap, int Aj, signed char Ax, int perm, 
+        int Bp, int Bj, signed char Bx, int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, unsigned char Ax, int perm, 
+        int Bp, int Bj, unsigned char Bx, int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, short Ax, int perm, int Bp, 
+        int Bj, short Bx, int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, unsigned short Ax, int perm, 
+        int Bp, int Bj, unsigned short Bx, int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, int Ax, int perm, int Bp, 
+        int Bj, int Bx, int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, unsigned int Ax, int perm, 
+        int Bp, int Bj, unsigned int Bx, int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, long long Ax, int perm, 
+        int Bp, int Bj, long long Bx, int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, unsigned long long Ax, int perm, 
+        int Bp, int Bj, unsigned long long Bx, 
+        int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, float Ax, int perm, int Bp, 
+        int Bj, float Bx, int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, double Ax, int perm, int Bp, 
+        int Bj, double Bx, int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, long double Ax, int perm, 
+        int Bp, int Bj, long double Bx, int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, npy_cfloat_wrapper Ax, int perm, 
+        int Bp, int Bj, npy_cfloat_wrapper Bx, 
+        int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int perm, int Bp, int Bj, npy_cdouble_wrapper Bx, 
+        int n_threads)
+    csr_symmetric_permute(int n_row, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int perm, int Bp, int Bj, npy_clongdouble_wrapper Bx, 
+        int n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, signed char Ax, 
+        long long perm, long long Bp, long long Bj, 
+        signed char Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, unsigned char Ax, 
+        long long perm, long long Bp, long long Bj, 
+        unsigned char Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, short Ax, 
+        long long perm, long long Bp, long long Bj, 
+        short Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, unsigned short Ax, 
+        long long perm, long long Bp, long long Bj, 
+        unsigned short Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, int Ax, 
+        long long perm, long long Bp, long long Bj, 
+        int Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, unsigned int Ax, 
+        long long perm, long long Bp, long long Bj, 
+        unsigned int Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, long long Ax, 
+        long long perm, long long Bp, long long Bj, 
+        long long Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, unsigned long long Ax, 
+        long long perm, long long Bp, 
+        long long Bj, unsigned long long Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, float Ax, 
+        long long perm, long long Bp, long long Bj, 
+        float Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, double Ax, 
+        long long perm, long long Bp, long long Bj, 
+        double Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, long double Ax, 
+        long long perm, long long Bp, long long Bj, 
+        long double Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        long long perm, long long Bp, 
+        long long Bj, npy_cfloat_wrapper Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        long long perm, long long Bp, 
+        long long Bj, npy_cdouble_wrapper Bx, long long n_threads)
+    csr_symmetric_permute(long long n_row, long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        long long perm, long long Bp, 
+        long long Bj, npy_clongdouble_wrapper Bx, 
+        long long n_threads)
+    """
+  return _csr.csr_symmetric_permute(*args)
+
 def csr_eliminate_zeros(*args):
   """
     csr_eliminate_zeros(int n_row, int n_col, int Ap, int Aj, signed char Ax)
@@ -561,6 +2052,34 @@ def csr_eliminate_zeros(*args):
     csr_eliminate_zeros(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax)
     csr_eliminate_zeros(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax)
     csr_eliminate_zeros(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax)
+    csr_eliminate_zeros(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax)
     """
   return _csr.csr_eliminate_zeros(*args)
 
@@ -580,6 +2099,34 @@ def csr_sum_duplicates(*args):
     csr_sum_duplicates(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax)
     csr_sum_duplicates(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax)
     csr_sum_duplicates(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax)
+    csr_sum_duplicates(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax)
     """
   return _csr.csr_sum_duplicates(*args)
 
@@ -613,6 +2160,48 @@ def get_csr_submatrix(*args):
         int ir0, int ir1, int ic0, int ic1)
     get_csr_submatrix(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int ir0, int ir1, int ic0, int ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long ir0, long long ir1, 
+        long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long ir0, long long ir1, 
+        long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long ir0, long long ir1, 
+        long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long ir0, 
+        long long ir1, long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long ir0, long long ir1, 
+        long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long ir0, long long ir1, 
+        long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long ir0, long long ir1, 
+        long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long ir0, 
+        long long ir1, long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long ir0, long long ir1, 
+        long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long ir0, long long ir1, 
+        long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long ir0, long long ir1, 
+        long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long ir0, 
+        long long ir1, long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long ir0, 
+        long long ir1, long long ic0, long long ic1)
+    get_csr_submatrix(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long ir0, 
+        long long ir1, long long ic0, long long ic1)
     """
   return _csr.get_csr_submatrix(*args)
 
@@ -647,6 +2236,952 @@ def csr_sample_values(*args):
     csr_sample_values(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int n_samples, int Bi, int Bj, 
         npy_clongdouble_wrapper Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long n_samples, 
+        long long Bi, long long Bj, signed char Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long n_samples, 
+        long long Bi, long long Bj, unsigned char Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long n_samples, long long Bi, 
+        long long Bj, short Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long n_samples, 
+        long long Bi, long long Bj, unsigned short Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long n_samples, long long Bi, 
+        long long Bj, int Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long n_samples, 
+        long long Bi, long long Bj, unsigned int Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long n_samples, 
+        long long Bi, long long Bj, long long Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long n_samples, 
+        long long Bi, long long Bj, unsigned long long Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long n_samples, long long Bi, 
+        long long Bj, float Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long n_samples, long long Bi, 
+        long long Bj, double Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long n_samples, 
+        long long Bi, long long Bj, long double Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long n_samples, 
+        long long Bi, long long Bj, npy_cfloat_wrapper Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long n_samples, 
+        long long Bi, long long Bj, npy_cdouble_wrapper Bx)
+    csr_sample_values(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long n_samples, 
+        long long Bi, long long Bj, npy_clongdouble_wrapper Bx)
     """
   return _csr.csr_sample_values(*args)
 
+def csr_sample_values_threads(*args):
+  """
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
+        int n_samples, int Bi, int Bj, signed char Bx, 
+        int sorted_indices, int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, unsigned char Ax, 
+        int n_samples, int Bi, int Bj, unsigned char Bx, 
+        int sorted_indices, int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, short Ax, int n_samples, 
+        int Bi, int Bj, short Bx, int sorted_indices, 
+        int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, unsigned short Ax, 
+        int n_samples, int Bi, int Bj, unsigned short Bx, 
+        int sorted_indices, int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, int Ax, int n_samples, 
+        int Bi, int Bj, int Bx, int sorted_indices, 
+        int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, unsigned int Ax, 
+        int n_samples, int Bi, int Bj, unsigned int Bx, 
+        int sorted_indices, int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, long long Ax, 
+        int n_samples, int Bi, int Bj, long long Bx, 
+        int sorted_indices, int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, unsigned long long Ax, 
+        int n_samples, int Bi, int Bj, unsigned long long Bx, 
+        int sorted_indices, int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, float Ax, int n_samples, 
+        int Bi, int Bj, float Bx, int sorted_indices, 
+        int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, double Ax, int n_samples, 
+        int Bi, int Bj, double Bx, int sorted_indices, 
+        int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, long double Ax, 
+        int n_samples, int Bi, int Bj, long double Bx, 
+        int sorted_indices, int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int n_samples, int Bi, int Bj, npy_cfloat_wrapper Bx, 
+        int sorted_indices, int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int n_samples, int Bi, int Bj, npy_cdouble_wrapper Bx, 
+        int sorted_indices, int n_threads)
+    csr_sample_values_threads(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int n_samples, int Bi, int Bj, 
+        npy_clongdouble_wrapper Bx, int sorted_indices, 
+        int n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long n_samples, 
+        long long Bi, long long Bj, signed char Bx, 
+        long long sorted_indices, long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long n_samples, 
+        long long Bi, long long Bj, unsigned char Bx, 
+        long long sorted_indices, long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long n_samples, long long Bi, 
+        long long Bj, short Bx, long long sorted_indices, 
+        long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long n_samples, 
+        long long Bi, long long Bj, unsigned short Bx, 
+        long long sorted_indices, long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long n_samples, long long Bi, 
+        long long Bj, int Bx, long long sorted_indices, 
+        long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long n_samples, 
+        long long Bi, long long Bj, unsigned int Bx, 
+        long long sorted_indices, long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long n_samples, 
+        long long Bi, long long Bj, long long Bx, long long sorted_indices, 
+        long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long n_samples, 
+        long long Bi, long long Bj, unsigned long long Bx, 
+        long long sorted_indices, long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long n_samples, long long Bi, 
+        long long Bj, float Bx, long long sorted_indices, 
+        long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long n_samples, long long Bi, 
+        long long Bj, double Bx, long long sorted_indices, 
+        long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long n_samples, 
+        long long Bi, long long Bj, long double Bx, 
+        long long sorted_indices, long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long n_samples, 
+        long long Bi, long long Bj, npy_cfloat_wrapper Bx, 
+        long long sorted_indices, long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long n_samples, 
+        long long Bi, long long Bj, npy_cdouble_wrapper Bx, 
+        long long sorted_indices, long long n_threads)
+    csr_sample_values_threads(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long n_samples, 
+        long long Bi, long long Bj, npy_clongdouble_wrapper Bx, 
+        long long sorted_indices, 
+        long long n_threads)
+    """
+  return _csr.csr_sample_values_threads(*args)
+
+def csr_row_index(*args):
+  """
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
+        int n_idx, int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, unsigned char Ax, 
+        int n_idx, int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, short Ax, int n_idx, 
+        int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, unsigned short Ax, 
+        int n_idx, int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, int Ax, int n_idx, 
+        int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, unsigned int Ax, 
+        int n_idx, int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, long long Ax, 
+        int n_idx, int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, unsigned long long Ax, 
+        int n_idx, int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, float Ax, int n_idx, 
+        int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, double Ax, int n_idx, 
+        int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, long double Ax, 
+        int n_idx, int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int n_idx, int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int n_idx, int rows, int n_threads)
+    csr_row_index(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int n_idx, int rows, int n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long n_idx, long long rows, 
+        long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long n_idx, 
+        long long rows, long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long n_idx, long long rows, 
+        long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long n_idx, 
+        long long rows, long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long n_idx, long long rows, 
+        long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long n_idx, 
+        long long rows, long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long n_idx, long long rows, 
+        long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long n_idx, 
+        long long rows, long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long n_idx, long long rows, 
+        long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long n_idx, long long rows, 
+        long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long n_idx, long long rows, 
+        long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long n_idx, 
+        long long rows, long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long n_idx, 
+        long long rows, long long n_threads)
+    csr_row_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long n_idx, 
+        long long rows, long long n_threads)
+    """
+  return _csr.csr_row_index(*args)
+
+def csr_column_index(*args):
+  """
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
+        int n_idx, int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, unsigned char Ax, 
+        int n_idx, int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, short Ax, int n_idx, 
+        int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, unsigned short Ax, 
+        int n_idx, int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, int Ax, int n_idx, 
+        int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, unsigned int Ax, 
+        int n_idx, int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, long long Ax, 
+        int n_idx, int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, unsigned long long Ax, 
+        int n_idx, int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, float Ax, int n_idx, 
+        int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, double Ax, int n_idx, 
+        int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, long double Ax, 
+        int n_idx, int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int n_idx, int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int n_idx, int cols, int n_threads)
+    csr_column_index(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int n_idx, int cols, int n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long n_idx, long long cols, 
+        long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long n_idx, 
+        long long cols, long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long n_idx, long long cols, 
+        long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long n_idx, 
+        long long cols, long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long n_idx, long long cols, 
+        long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long n_idx, 
+        long long cols, long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long n_idx, long long cols, 
+        long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long n_idx, 
+        long long cols, long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long n_idx, long long cols, 
+        long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long n_idx, long long cols, 
+        long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long n_idx, long long cols, 
+        long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long n_idx, 
+        long long cols, long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long n_idx, 
+        long long cols, long long n_threads)
+    csr_column_index(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long n_idx, 
+        long long cols, long long n_threads)
+    """
+  return _csr.csr_column_index(*args)
+
+def csr_add_coo(*args):
+  """
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
+        int n_samples, int Bi, int Bj, signed char Bx, 
+        int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, unsigned char Ax, 
+        int n_samples, int Bi, int Bj, unsigned char Bx, 
+        int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, short Ax, int n_samples, 
+        int Bi, int Bj, short Bx, int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, unsigned short Ax, 
+        int n_samples, int Bi, int Bj, unsigned short Bx, 
+        int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, int Ax, int n_samples, 
+        int Bi, int Bj, int Bx, int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, unsigned int Ax, 
+        int n_samples, int Bi, int Bj, unsigned int Bx, 
+        int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, long long Ax, 
+        int n_samples, int Bi, int Bj, long long Bx, 
+        int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, unsigned long long Ax, 
+        int n_samples, int Bi, int Bj, unsigned long long Bx, 
+        int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, float Ax, int n_samples, 
+        int Bi, int Bj, float Bx, int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, double Ax, int n_samples, 
+        int Bi, int Bj, double Bx, int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, long double Ax, 
+        int n_samples, int Bi, int Bj, long double Bx, 
+        int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int n_samples, int Bi, int Bj, npy_cfloat_wrapper Bx, 
+        int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int n_samples, int Bi, int Bj, npy_cdouble_wrapper Bx, 
+        int flag) -> int
+    csr_add_coo(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int n_samples, int Bi, int Bj, 
+        npy_clongdouble_wrapper Bx, int flag) -> int
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        signed char Ax, long long n_samples, 
+        long long Bi, long long Bj, signed char Bx, 
+        long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned char Ax, long long n_samples, 
+        long long Bi, long long Bj, unsigned char Bx, 
+        long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        short Ax, long long n_samples, long long Bi, 
+        long long Bj, short Bx, long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned short Ax, long long n_samples, 
+        long long Bi, long long Bj, unsigned short Bx, 
+        long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        int Ax, long long n_samples, long long Bi, 
+        long long Bj, int Bx, long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned int Ax, long long n_samples, 
+        long long Bi, long long Bj, unsigned int Bx, 
+        long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long long Ax, long long n_samples, 
+        long long Bi, long long Bj, long long Bx, long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        unsigned long long Ax, long long n_samples, 
+        long long Bi, long long Bj, unsigned long long Bx, 
+        long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        float Ax, long long n_samples, long long Bi, 
+        long long Bj, float Bx, long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        double Ax, long long n_samples, long long Bi, 
+        long long Bj, double Bx, long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        long double Ax, long long n_samples, 
+        long long Bi, long long Bj, long double Bx, 
+        long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long n_samples, 
+        long long Bi, long long Bj, npy_cfloat_wrapper Bx, 
+        long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long n_samples, 
+        long long Bi, long long Bj, npy_cdouble_wrapper Bx, 
+        long long flag) -> long long
+    csr_add_coo(long long n_row, long long n_col, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long n_samples, 
+        long long Bi, long long Bj, npy_clongdouble_wrapper Bx, 
+        long long flag) -> long long
+    """
+  return _csr.csr_add_coo(*args)
+
+def csr_tosell(*args):
+  """
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, signed char Ax, 
+        int perm, int Bp, int Bj, signed char Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, unsigned char Ax, 
+        int perm, int Bp, int Bj, unsigned char Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, short Ax, 
+        int perm, int Bp, int Bj, short Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, unsigned short Ax, 
+        int perm, int Bp, int Bj, unsigned short Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, int Ax, 
+        int perm, int Bp, int Bj, int Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, unsigned int Ax, 
+        int perm, int Bp, int Bj, unsigned int Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, long long Ax, 
+        int perm, int Bp, int Bj, long long Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, unsigned long long Ax, 
+        int perm, int Bp, int Bj, unsigned long long Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, float Ax, 
+        int perm, int Bp, int Bj, float Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, double Ax, 
+        int perm, int Bp, int Bj, double Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, long double Ax, 
+        int perm, int Bp, int Bj, long double Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int perm, int Bp, int Bj, npy_cfloat_wrapper Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int perm, int Bp, int Bj, npy_cdouble_wrapper Bx)
+    csr_tosell(int n_row, int n_col, int C, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int perm, int Bp, int Bj, 
+        npy_clongdouble_wrapper Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, signed char Ax, long long perm, 
+        long long Bp, long long Bj, signed char Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, unsigned char Ax, long long perm, 
+        long long Bp, long long Bj, unsigned char Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, short Ax, long long perm, 
+        long long Bp, long long Bj, short Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, unsigned short Ax, long long perm, 
+        long long Bp, long long Bj, unsigned short Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, int Ax, long long perm, 
+        long long Bp, long long Bj, int Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, unsigned int Ax, long long perm, 
+        long long Bp, long long Bj, unsigned int Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, long long Ax, long long perm, 
+        long long Bp, long long Bj, long long Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, unsigned long long Ax, 
+        long long perm, long long Bp, long long Bj, 
+        unsigned long long Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, float Ax, long long perm, 
+        long long Bp, long long Bj, float Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, double Ax, long long perm, 
+        long long Bp, long long Bj, double Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, long double Ax, long long perm, 
+        long long Bp, long long Bj, long double Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, npy_cfloat_wrapper Ax, 
+        long long perm, long long Bp, long long Bj, 
+        npy_cfloat_wrapper Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, npy_cdouble_wrapper Ax, 
+        long long perm, long long Bp, long long Bj, 
+        npy_cdouble_wrapper Bx)
+    csr_tosell(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, npy_clongdouble_wrapper Ax, 
+        long long perm, long long Bp, long long Bj, 
+        npy_clongdouble_wrapper Bx)
+    """
+  return _csr.csr_tosell(*args)
+
+def sell_matvec(*args):
+  """
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, signed char Ax, 
+        int perm, int lengths, signed char Xx, 
+        signed char Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, unsigned char Ax, 
+        int perm, int lengths, unsigned char Xx, 
+        unsigned char Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, short Ax, 
+        int perm, int lengths, short Xx, short Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, unsigned short Ax, 
+        int perm, int lengths, unsigned short Xx, 
+        unsigned short Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, int Ax, 
+        int perm, int lengths, int Xx, int Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, unsigned int Ax, 
+        int perm, int lengths, unsigned int Xx, 
+        unsigned int Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, long long Ax, 
+        int perm, int lengths, long long Xx, 
+        long long Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, unsigned long long Ax, 
+        int perm, int lengths, unsigned long long Xx, 
+        unsigned long long Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, float Ax, 
+        int perm, int lengths, float Xx, float Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, double Ax, 
+        int perm, int lengths, double Xx, double Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, long double Ax, 
+        int perm, int lengths, long double Xx, 
+        long double Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int perm, int lengths, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int perm, int lengths, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    sell_matvec(int n_row, int n_col, int C, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int perm, int lengths, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, signed char Ax, long long perm, 
+        long long lengths, signed char Xx, 
+        signed char Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, unsigned char Ax, long long perm, 
+        long long lengths, unsigned char Xx, 
+        unsigned char Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, short Ax, long long perm, 
+        long long lengths, short Xx, short Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, unsigned short Ax, long long perm, 
+        long long lengths, unsigned short Xx, 
+        unsigned short Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, int Ax, long long perm, 
+        long long lengths, int Xx, int Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, unsigned int Ax, long long perm, 
+        long long lengths, unsigned int Xx, 
+        unsigned int Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, long long Ax, long long perm, 
+        long long lengths, long long Xx, long long Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, unsigned long long Ax, 
+        long long perm, long long lengths, unsigned long long Xx, 
+        unsigned long long Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, float Ax, long long perm, 
+        long long lengths, float Xx, float Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, double Ax, long long perm, 
+        long long lengths, double Xx, double Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, long double Ax, long long perm, 
+        long long lengths, long double Xx, 
+        long double Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, npy_cfloat_wrapper Ax, 
+        long long perm, long long lengths, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, npy_cdouble_wrapper Ax, 
+        long long perm, long long lengths, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    sell_matvec(long long n_row, long long n_col, long long C, long long Ap, 
+        long long Aj, npy_clongdouble_wrapper Ax, 
+        long long perm, long long lengths, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
+    """
+  return _csr.sell_matvec(*args)
+
+def sell_matvecs(*args):
+  """
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        signed char Ax, int perm, int lengths, 
+        signed char Xx, signed char Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        unsigned char Ax, int perm, int lengths, 
+        unsigned char Xx, unsigned char Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        short Ax, int perm, int lengths, short Xx, 
+        short Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        unsigned short Ax, int perm, int lengths, 
+        unsigned short Xx, unsigned short Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        int Ax, int perm, int lengths, int Xx, 
+        int Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        unsigned int Ax, int perm, int lengths, 
+        unsigned int Xx, unsigned int Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        long long Ax, int perm, int lengths, long long Xx, 
+        long long Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        unsigned long long Ax, int perm, int lengths, 
+        unsigned long long Xx, unsigned long long Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        float Ax, int perm, int lengths, float Xx, 
+        float Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        double Ax, int perm, int lengths, double Xx, 
+        double Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        long double Ax, int perm, int lengths, 
+        long double Xx, long double Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        npy_cfloat_wrapper Ax, int perm, int lengths, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        npy_cdouble_wrapper Ax, int perm, int lengths, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    sell_matvecs(int n_row, int n_col, int n_vecs, int C, int Ap, int Aj, 
+        npy_clongdouble_wrapper Ax, int perm, int lengths, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, signed char Ax, 
+        long long perm, long long lengths, 
+        signed char Xx, signed char Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, unsigned char Ax, 
+        long long perm, long long lengths, 
+        unsigned char Xx, unsigned char Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, short Ax, 
+        long long perm, long long lengths, short Xx, 
+        short Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, unsigned short Ax, 
+        long long perm, long long lengths, 
+        unsigned short Xx, unsigned short Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, int Ax, 
+        long long perm, long long lengths, int Xx, 
+        int Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, unsigned int Ax, 
+        long long perm, long long lengths, 
+        unsigned int Xx, unsigned int Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, long long Ax, 
+        long long perm, long long lengths, 
+        long long Xx, long long Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, unsigned long long Ax, 
+        long long perm, long long lengths, 
+        unsigned long long Xx, unsigned long long Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, float Ax, 
+        long long perm, long long lengths, float Xx, 
+        float Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, double Ax, 
+        long long perm, long long lengths, double Xx, 
+        double Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, long double Ax, 
+        long long perm, long long lengths, 
+        long double Xx, long double Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, npy_cfloat_wrapper Ax, 
+        long long perm, long long lengths, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, npy_cdouble_wrapper Ax, 
+        long long perm, long long lengths, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    sell_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long C, long long Ap, long long Aj, npy_clongdouble_wrapper Ax, 
+        long long perm, long long lengths, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
+    """
+  return _csr.sell_matvecs(*args)
+
+def csr_triangular_solve(*args):
+  """
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, signed char Ax, 
+        int lower, int unit_diagonal, int trans, 
+        signed char Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, unsigned char Ax, 
+        int lower, int unit_diagonal, int trans, 
+        unsigned char Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, short Ax, int lower, 
+        int unit_diagonal, int trans, short Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, unsigned short Ax, 
+        int lower, int unit_diagonal, int trans, 
+        unsigned short Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, int Ax, int lower, 
+        int unit_diagonal, int trans, int Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, unsigned int Ax, 
+        int lower, int unit_diagonal, int trans, 
+        unsigned int Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, long long Ax, 
+        int lower, int unit_diagonal, int trans, long long Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, unsigned long long Ax, 
+        int lower, int unit_diagonal, int trans, 
+        unsigned long long Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, float Ax, int lower, 
+        int unit_diagonal, int trans, float Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, double Ax, int lower, 
+        int unit_diagonal, int trans, double Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, long double Ax, 
+        int lower, int unit_diagonal, int trans, 
+        long double Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int lower, int unit_diagonal, int trans, 
+        npy_cfloat_wrapper Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int lower, int unit_diagonal, int trans, 
+        npy_cdouble_wrapper Yx) -> int
+    csr_triangular_solve(int n_row, int n_vecs, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int lower, int unit_diagonal, 
+        int trans, npy_clongdouble_wrapper Yx) -> int
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        signed char Ax, long long lower, 
+        long long unit_diagonal, long long trans, signed char Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        unsigned char Ax, long long lower, 
+        long long unit_diagonal, long long trans, unsigned char Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        short Ax, long long lower, long long unit_diagonal, 
+        long long trans, short Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        unsigned short Ax, long long lower, 
+        long long unit_diagonal, long long trans, 
+        unsigned short Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        int Ax, long long lower, long long unit_diagonal, 
+        long long trans, int Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        unsigned int Ax, long long lower, 
+        long long unit_diagonal, long long trans, unsigned int Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        long long Ax, long long lower, long long unit_diagonal, 
+        long long trans, long long Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        unsigned long long Ax, long long lower, 
+        long long unit_diagonal, long long trans, 
+        unsigned long long Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        float Ax, long long lower, long long unit_diagonal, 
+        long long trans, float Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        double Ax, long long lower, long long unit_diagonal, 
+        long long trans, double Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        long double Ax, long long lower, 
+        long long unit_diagonal, long long trans, long double Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long lower, 
+        long long unit_diagonal, long long trans, 
+        npy_cfloat_wrapper Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long lower, 
+        long long unit_diagonal, long long trans, 
+        npy_cdouble_wrapper Yx) -> long long
+    csr_triangular_solve(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long lower, 
+        long long unit_diagonal, long long trans, 
+        npy_clongdouble_wrapper Yx) -> long long
+    """
+  return _csr.csr_triangular_solve(*args)
+
+def csr_triangular_solve_levels(*args):
+  """
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, signed char Ax, 
+        int lower, int unit_diagonal, int n_levels, 
+        int Bp, int Bj, signed char Yx, int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, unsigned char Ax, 
+        int lower, int unit_diagonal, int n_levels, 
+        int Bp, int Bj, unsigned char Yx, int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, short Ax, int lower, 
+        int unit_diagonal, int n_levels, int Bp, 
+        int Bj, short Yx, int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, unsigned short Ax, 
+        int lower, int unit_diagonal, int n_levels, 
+        int Bp, int Bj, unsigned short Yx, int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, int Ax, int lower, 
+        int unit_diagonal, int n_levels, int Bp, 
+        int Bj, int Yx, int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, unsigned int Ax, 
+        int lower, int unit_diagonal, int n_levels, 
+        int Bp, int Bj, unsigned int Yx, int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, long long Ax, 
+        int lower, int unit_diagonal, int n_levels, 
+        int Bp, int Bj, long long Yx, int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, unsigned long long Ax, 
+        int lower, int unit_diagonal, int n_levels, 
+        int Bp, int Bj, unsigned long long Yx, 
+        int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, float Ax, int lower, 
+        int unit_diagonal, int n_levels, int Bp, 
+        int Bj, float Yx, int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, double Ax, int lower, 
+        int unit_diagonal, int n_levels, int Bp, 
+        int Bj, double Yx, int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, long double Ax, 
+        int lower, int unit_diagonal, int n_levels, 
+        int Bp, int Bj, long double Yx, int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int lower, int unit_diagonal, int n_levels, 
+        int Bp, int Bj, npy_cfloat_wrapper Yx, 
+        int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int lower, int unit_diagonal, int n_levels, 
+        int Bp, int Bj, npy_cdouble_wrapper Yx, 
+        int n_threads) -> int
+    csr_triangular_solve_levels(int n_row, int n_vecs, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int lower, int unit_diagonal, 
+        int n_levels, int Bp, int Bj, npy_clongdouble_wrapper Yx, 
+        int n_threads) -> int
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        signed char Ax, long long lower, 
+        long long unit_diagonal, long long n_levels, 
+        long long Bp, long long Bj, signed char Yx, long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        unsigned char Ax, long long lower, 
+        long long unit_diagonal, long long n_levels, 
+        long long Bp, long long Bj, unsigned char Yx, 
+        long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        short Ax, long long lower, long long unit_diagonal, 
+        long long n_levels, long long Bp, 
+        long long Bj, short Yx, long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        unsigned short Ax, long long lower, 
+        long long unit_diagonal, long long n_levels, 
+        long long Bp, long long Bj, unsigned short Yx, 
+        long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        int Ax, long long lower, long long unit_diagonal, 
+        long long n_levels, long long Bp, 
+        long long Bj, int Yx, long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        unsigned int Ax, long long lower, 
+        long long unit_diagonal, long long n_levels, 
+        long long Bp, long long Bj, unsigned int Yx, 
+        long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        long long Ax, long long lower, long long unit_diagonal, 
+        long long n_levels, long long Bp, 
+        long long Bj, long long Yx, long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        unsigned long long Ax, long long lower, 
+        long long unit_diagonal, long long n_levels, 
+        long long Bp, long long Bj, unsigned long long Yx, 
+        long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        float Ax, long long lower, long long unit_diagonal, 
+        long long n_levels, long long Bp, 
+        long long Bj, float Yx, long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        double Ax, long long lower, long long unit_diagonal, 
+        long long n_levels, long long Bp, 
+        long long Bj, double Yx, long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        long double Ax, long long lower, 
+        long long unit_diagonal, long long n_levels, 
+        long long Bp, long long Bj, long double Yx, long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        npy_cfloat_wrapper Ax, long long lower, 
+        long long unit_diagonal, long long n_levels, 
+        long long Bp, long long Bj, npy_cfloat_wrapper Yx, 
+        long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        npy_cdouble_wrapper Ax, long long lower, 
+        long long unit_diagonal, long long n_levels, 
+        long long Bp, long long Bj, npy_cdouble_wrapper Yx, 
+        long long n_threads) -> long long
+    csr_triangular_solve_levels(long long n_row, long long n_vecs, long long Ap, long long Aj, 
+        npy_clongdouble_wrapper Ax, long long lower, 
+        long long unit_diagonal, long long n_levels, 
+        long long Bp, long long Bj, npy_clongdouble_wrapper Yx, 
+        long long n_threads) -> long long
+    """
+  return _csr.csr_triangular_solve_levels(*args)
+
+def csr_ilu0(*args):
+  """
+    csr_ilu0(int n_row, int Ap, int Aj, float Ax) -> int
+    csr_ilu0(int n_row, int Ap, int Aj, double Ax) -> int
+    csr_ilu0(int n_row, int Ap, int Aj, long double Ax) -> int
+    csr_ilu0(long long n_row, long long Ap, long long Aj, float Ax) -> long long
+    csr_ilu0(long long n_row, long long Ap, long long Aj, double Ax) -> long long
+    csr_ilu0(long long n_row, long long Ap, long long Aj, long double Ax) -> long long
+    """
+  return _csr.csr_ilu0(*args)
+
+def csr_ic0(*args):
+  """
+    csr_ic0(int n_row, int Ap, int Aj, float Ax) -> int
+    csr_ic0(int n_row, int Ap, int Aj, double Ax) -> int
+    csr_ic0(int n_row, int Ap, int Aj, long double Ax) -> int
+    csr_ic0(long long n_row, long long Ap, long long Aj, float Ax) -> long long
+    csr_ic0(long long n_row, long long Ap, long long Aj, double Ax) -> long long
+    csr_ic0(long long n_row, long long Ap, long long Aj, long double Ax) -> long long
+    """
+  return _csr.csr_ic0(*args)
+
+def csr_ilut(*args):
+  """
+    csr_ilut(int n_row, int Ap, int Aj, float Ax, double drop_tol, 
+        int fill) -> int
+    csr_ilut(int n_row, int Ap, int Aj, double Ax, double drop_tol, 
+        int fill) -> int
+    csr_ilut(int n_row, int Ap, int Aj, long double Ax, double drop_tol, 
+        int fill) -> int
+    csr_ilut(long long n_row, long long Ap, long long Aj, float Ax, 
+        double drop_tol, long long fill) -> long long
+    csr_ilut(long long n_row, long long Ap, long long Aj, double Ax, 
+        double drop_tol, long long fill) -> long long
+    csr_ilut(long long n_row, long long Ap, long long Aj, long double Ax, 
+        double drop_tol, long long fill) -> long long
+    """
+  return _csr.csr_ilut(*args)
+
+def krylov_solve(*args):
+  """
+    krylov_solve(int method, int restart, int format, int n_row, int R, 
+        int C, int Ap, int Aj, float Ax, int precond, 
+        int Bp, int Bj, float Bx, float Xx, float Yx, 
+        float work, double atol, int maxiter) -> int
+    krylov_solve(int method, int restart, int format, int n_row, int R, 
+        int C, int Ap, int Aj, double Ax, int precond, 
+        int Bp, int Bj, double Bx, double Xx, double Yx, 
+        double work, double atol, int maxiter) -> int
+    krylov_solve(int method, int restart, int format, int n_row, int R, 
+        int C, int Ap, int Aj, long double Ax, int precond, 
+        int Bp, int Bj, long double Bx, long double Xx, 
+        long double Yx, long double work, 
+        double atol, int maxiter) -> int
+    krylov_solve(long long method, long long restart, long long format, 
+        long long n_row, long long R, long long C, 
+        long long Ap, long long Aj, float Ax, long long precond, 
+        long long Bp, long long Bj, float Bx, 
+        float Xx, float Yx, float work, double atol, 
+        long long maxiter) -> long long
+    krylov_solve(long long method, long long restart, long long format, 
+        long long n_row, long long R, long long C, 
+        long long Ap, long long Aj, double Ax, long long precond, 
+        long long Bp, long long Bj, double Bx, 
+        double Xx, double Yx, double work, double atol, 
+        long long maxiter) -> long long
+    krylov_solve(long long method, long long restart, long long format, 
+        long long n_row, long long R, long long C, 
+        long long Ap, long long Aj, long double Ax, 
+        long long precond, long long Bp, long long Bj, 
+        long double Bx, long double Xx, long double Yx, 
+        long double work, double atol, long long maxiter) -> long long
+    """
+  return _csr.krylov_solve(*args)
+
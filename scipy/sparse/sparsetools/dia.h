@@ -1,8 +1,80 @@
 #ifndef __DIA_H__
 #define __DIA_H__
 
+#include <vector>
 #include <algorithm>
 
+#include "dense.h"
+#include "parallel.h"
+
+
+/*
+ * Rows of Y updated at a time by the DIA products.  A tile of Y is
+ * read and written once per diagonal, so it is sized (about 16KB) to
+ * stay in cache while all the diagonals are applied.
+ */
+template <class I, class T>
+I dia_tile_rows(const I n_vecs)
+{
+    return std::max<I>(64, (I)(16384 / (sizeof(T) * std::max<I>(1, n_vecs))));
+}
+
+
+/*
+ * Y[r0:r1] += A[r0:r1,:]*X for DIA matrix A, one tile at a time.
+ *
+ * For a single vector the loop along each diagonal is unit stride in
+ * diags, Xx and Yx, so the compiler can vectorise it.  With several
+ * vectors each entry updates a contiguous row of Y.
+ */
+template <class I, class T>
+void dia_matvecs_rows(const I r0,
+                      const I r1,
+                      const I n_col,
+                      const I n_vecs,
+                      const I n_diags,
+                      const I L,
+                      const I offsets[],
+                      const T diags[],
+                      const T Xx[],
+                            T Yx[])
+{
+    const I tile  = dia_tile_rows<I,T>(n_vecs);
+    const I j_max = std::min(n_col, L);
+
+    for(I t0 = r0; t0 < r1; t0 += tile){
+        const I t1 = std::min(r1, t0 + tile);
+
+        for(I d = 0; d < n_diags; d++){
+            const I k = offsets[d];  //diagonal offset
+
+            // columns j = i + k of the rows i in [t0,t1)
+            const I j_start = std::max<I>(t0 + k, 0);
+            const I j_end   = std::min<I>(t1 + k, j_max);
+            if(j_start >= j_end) continue;
+
+            const I N = j_end - j_start;  //number of elements to process
+
+            const T * diag = diags + d*L + j_start;
+
+            if(n_vecs == 1){
+                const T * x = Xx + j_start;
+                      T * y = Yx + (j_start - k);
+                for(I n = 0; n < N; n++){
+                    y[n] += diag[n] * x[n];
+                }
+            } else {
+                const T * x = Xx + n_vecs * j_start;
+                      T * y = Yx + n_vecs * (j_start - k);
+                for(I n = 0; n < N; n++){
+                    axpy(n_vecs, diag[n], x + n_vecs * n,
+                                          y + n_vecs * n);
+                }
+            }
+        }
+    }
+}
+
 
 /*
  * Compute Y += A*X for DIA matrix A and dense vectors X,Y
@@ -25,6 +97,9 @@
  *   Negative offsets correspond to lower diagonals
  *   Positive offsets correspond to upper diagonals
  *
+ *   The rows are processed in tiles (see dia_tile_rows), so Yx is
+ *   streamed through memory once rather than once per diagonal.
+ *
  */
 template <class I, class T>
 void dia_matvec(const I n_row,
@@ -36,24 +111,96 @@ void dia_matvec(const I n_row,
 	            const T Xx[],
 	                  T Yx[])
 {
-    for(I i = 0; i < n_diags; i++){
-        const I k = offsets[i];  //diagonal offset
+    dia_matvecs_rows((I) 0, n_row, n_col, (I) 1, n_diags, L, offsets, diags, Xx, Yx);
+}
 
-        const I i_start = std::max(0,-k);
-        const I j_start = std::max(0, k);
-        const I j_end   = std::min(std::min(n_row + k, n_col),L);
 
-        const I N = j_end - j_start;  //number of elements to process
+/*
+ * Compute Y += A*X for DIA matrix A and dense block vectors X,Y
+ *
+ *
+ * Input Arguments:
+ *   I  n_row            - number of rows in A
+ *   I  n_col            - number of columns in A
+ *   I  n_vecs           - number of column vectors in X and Y
+ *   I  n_diags          - number of diagonals
+ *   I  L                - length of each diagonal
+ *   I  offsets[n_diags] - diagonal offsets
+ *   T  diags[n_diags,L] - nonzeros
+ *   T  Xx[n_col,n_vecs] - input vectors
+ *
+ * Output Arguments:
+ *   T  Yx[n_row,n_vecs] - output vectors
+ *
+ * Note:
+ *   Output array Yx must be preallocated
+ *
+ */
+template <class I, class T>
+void dia_matvecs(const I n_row,
+                 const I n_col,
+                 const I n_vecs,
+                 const I n_diags,
+                 const I L,
+                 const I offsets[],
+                 const T diags[],
+                 const T Xx[],
+                       T Yx[])
+{
+    dia_matvecs_rows((I) 0, n_row, n_col, n_vecs, n_diags, L, offsets, diags, Xx, Yx);
+}
+
 
-        const T * diag = diags + i*L + j_start;
-        const T * x = Xx + j_start;
-              T * y = Yx + i_start;
+/*
+ * Compute Y += A*X for DIA matrix A and dense block vectors X,Y using
+ * up to n_threads threads (<= 0 means the default).  Each thread owns
+ * a contiguous range of whole tiles, so the result is the same for any
+ * thread count.  See dia_matvecs.
+ *
+ */
+template <class I, class T>
+void dia_matvecs_threads(const I n_row,
+                         const I n_col,
+                         const I n_vecs,
+                         const I n_diags,
+                         const I L,
+                         const I offsets[],
+                         const T diags[],
+                         const T Xx[],
+                               T Yx[],
+                         const I n_threads)
+{
+    const I tile    = dia_tile_rows<I,T>(n_vecs);
+    const I n_tiles = (n_row + tile - 1) / tile;
+    const I t = sparsetools_num_threads(n_threads, n_tiles);
 
-        for(I n = 0; n < N; n++){
-            y[n] += diag[n] * x[n]; 
-        }
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        const I r0 = std::min(n_row, (I)((double) n_tiles * p / t) * tile);
+        const I r1 = std::min(n_row, (I)((double) n_tiles * (p + 1) / t) * tile);
+        dia_matvecs_rows(r0, r1, n_col, n_vecs, n_diags, L, offsets, diags, Xx, Yx);
     }
 }
 
+/*
+ * Compute Y += A*X for DIA matrix A and dense vectors X,Y using up to
+ * n_threads threads.  See dia_matvecs_threads.
+ *
+ */
+template <class I, class T>
+void dia_matvec_threads(const I n_row,
+                        const I n_col,
+                        const I n_diags,
+                        const I L,
+                        const I offsets[],
+                        const T diags[],
+                        const T Xx[],
+                              T Yx[],
+                        const I n_threads)
+{
+    dia_matvecs_threads(n_row, n_col, (I) 1, n_diags, L, offsets, diags,
+                        Xx, Yx, n_threads);
+}
+
 
 #endif
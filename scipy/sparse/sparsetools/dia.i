@@ -9,4 +9,7 @@
 %include "dia.h" 
 
 INSTANTIATE_ALL(dia_matvec)
+INSTANTIATE_ALL(dia_matvecs)
+INSTANTIATE_ALL(dia_matvec_threads)
+INSTANTIATE_ALL(dia_matvecs_threads)
 
@@ -103,6 +103,333 @@ def dia_matvec(*args):
     dia_matvec(int n_row, int n_col, int n_diags, int L, int offsets, 
         npy_clongdouble_wrapper diags, npy_clongdouble_wrapper Xx, 
         npy_clongdouble_wrapper Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, signed char diags, 
+        signed char Xx, signed char Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, unsigned char diags, 
+        unsigned char Xx, unsigned char Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, short diags, 
+        short Xx, short Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, unsigned short diags, 
+        unsigned short Xx, unsigned short Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, int diags, 
+        int Xx, int Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, unsigned int diags, 
+        unsigned int Xx, unsigned int Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, long long diags, 
+        long long Xx, long long Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, unsigned long long diags, 
+        unsigned long long Xx, unsigned long long Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, float diags, 
+        float Xx, float Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, double diags, 
+        double Xx, double Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, long double diags, 
+        long double Xx, long double Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, npy_cfloat_wrapper diags, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, npy_cdouble_wrapper diags, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    dia_matvec(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, npy_clongdouble_wrapper diags, 
+        npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
     """
   return _dia.dia_matvec(*args)
 
+def dia_matvecs(*args):
+  """
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, signed char diags, signed char Xx, 
+        signed char Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, unsigned char diags, unsigned char Xx, 
+        unsigned char Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, short diags, short Xx, short Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, unsigned short diags, unsigned short Xx, 
+        unsigned short Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, int diags, int Xx, int Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, unsigned int diags, unsigned int Xx, 
+        unsigned int Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, long long diags, long long Xx, 
+        long long Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, unsigned long long diags, unsigned long long Xx, 
+        unsigned long long Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, float diags, float Xx, float Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, double diags, double Xx, double Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, long double diags, long double Xx, 
+        long double Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, npy_cfloat_wrapper diags, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, npy_cdouble_wrapper diags, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    dia_matvecs(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, npy_clongdouble_wrapper diags, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        signed char diags, signed char Xx, signed char Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        unsigned char diags, unsigned char Xx, 
+        unsigned char Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        short diags, short Xx, short Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        unsigned short diags, unsigned short Xx, 
+        unsigned short Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        int diags, int Xx, int Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        unsigned int diags, unsigned int Xx, unsigned int Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        long long diags, long long Xx, long long Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        unsigned long long diags, unsigned long long Xx, 
+        unsigned long long Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        float diags, float Xx, float Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        double diags, double Xx, double Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        long double diags, long double Xx, long double Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        npy_cfloat_wrapper diags, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        npy_cdouble_wrapper diags, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    dia_matvecs(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        npy_clongdouble_wrapper diags, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
+    """
+  return _dia.dia_matvecs(*args)
+
+def dia_matvec_threads(*args):
+  """
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        signed char diags, signed char Xx, signed char Yx, 
+        int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        unsigned char diags, unsigned char Xx, unsigned char Yx, 
+        int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        short diags, short Xx, short Yx, int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        unsigned short diags, unsigned short Xx, 
+        unsigned short Yx, int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        int diags, int Xx, int Yx, int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        unsigned int diags, unsigned int Xx, unsigned int Yx, 
+        int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        long long diags, long long Xx, long long Yx, 
+        int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        unsigned long long diags, unsigned long long Xx, 
+        unsigned long long Yx, int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        float diags, float Xx, float Yx, int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        double diags, double Xx, double Yx, int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        long double diags, long double Xx, long double Yx, 
+        int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        npy_cfloat_wrapper diags, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx, int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        npy_cdouble_wrapper diags, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx, int n_threads)
+    dia_matvec_threads(int n_row, int n_col, int n_diags, int L, int offsets, 
+        npy_clongdouble_wrapper diags, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx, 
+        int n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, signed char diags, 
+        signed char Xx, signed char Yx, long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, unsigned char diags, 
+        unsigned char Xx, unsigned char Yx, 
+        long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, short diags, 
+        short Xx, short Yx, long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, unsigned short diags, 
+        unsigned short Xx, unsigned short Yx, 
+        long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, int diags, 
+        int Xx, int Yx, long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, unsigned int diags, 
+        unsigned int Xx, unsigned int Yx, long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, long long diags, 
+        long long Xx, long long Yx, long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, unsigned long long diags, 
+        unsigned long long Xx, unsigned long long Yx, 
+        long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, float diags, 
+        float Xx, float Yx, long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, double diags, 
+        double Xx, double Yx, long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, long double diags, 
+        long double Xx, long double Yx, long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, npy_cfloat_wrapper diags, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx, 
+        long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, npy_cdouble_wrapper diags, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx, 
+        long long n_threads)
+    dia_matvec_threads(long long n_row, long long n_col, long long n_diags, 
+        long long L, long long offsets, npy_clongdouble_wrapper diags, 
+        npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx, long long n_threads)
+    """
+  return _dia.dia_matvec_threads(*args)
+
+def dia_matvecs_threads(*args):
+  """
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, signed char diags, signed char Xx, 
+        signed char Yx, int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, unsigned char diags, unsigned char Xx, 
+        unsigned char Yx, int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, short diags, short Xx, short Yx, 
+        int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, unsigned short diags, unsigned short Xx, 
+        unsigned short Yx, int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, int diags, int Xx, int Yx, int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, unsigned int diags, unsigned int Xx, 
+        unsigned int Yx, int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, long long diags, long long Xx, 
+        long long Yx, int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, unsigned long long diags, unsigned long long Xx, 
+        unsigned long long Yx, int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, float diags, float Xx, float Yx, 
+        int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, double diags, double Xx, double Yx, 
+        int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, long double diags, long double Xx, 
+        long double Yx, int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, npy_cfloat_wrapper diags, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx, int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, npy_cdouble_wrapper diags, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx, 
+        int n_threads)
+    dia_matvecs_threads(int n_row, int n_col, int n_vecs, int n_diags, int L, 
+        int offsets, npy_clongdouble_wrapper diags, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx, 
+        int n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        signed char diags, signed char Xx, signed char Yx, 
+        long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        unsigned char diags, unsigned char Xx, 
+        unsigned char Yx, long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        short diags, short Xx, short Yx, long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        unsigned short diags, unsigned short Xx, 
+        unsigned short Yx, long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        int diags, int Xx, int Yx, long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        unsigned int diags, unsigned int Xx, unsigned int Yx, 
+        long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        long long diags, long long Xx, long long Yx, 
+        long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        unsigned long long diags, unsigned long long Xx, 
+        unsigned long long Yx, long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        float diags, float Xx, float Yx, long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        double diags, double Xx, double Yx, long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        long double diags, long double Xx, long double Yx, 
+        long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        npy_cfloat_wrapper diags, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx, long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        npy_cdouble_wrapper diags, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx, long long n_threads)
+    dia_matvecs_threads(long long n_row, long long n_col, long long n_vecs, 
+        long long n_diags, long long L, long long offsets, 
+        npy_clongdouble_wrapper diags, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx, 
+        long long n_threads)
+    """
+  return _dia.dia_matvecs_threads(*args)
+
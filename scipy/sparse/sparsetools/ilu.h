@@ -0,0 +1,318 @@
+#ifndef __ILU_H__
+#define __ILU_H__
+
+#include <cmath>
+#include <vector>
+#include <queue>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+/*
+ * Incomplete factorizations of CSR matrices
+ *
+ * The LU factorizations return L and U in one CSR matrix: the strictly
+ * lower part holds L, whose unit diagonal is not stored, and the rest
+ * holds U.  The Cholesky factorization returns the lower triangular L
+ * with A ~= L*L.T.  The factors are applied with the triangular solves
+ * in triangular.h.
+ *
+ * The factorizations are defined for real types only.  They return -1
+ * on success, otherwise the row where a zero (or, for the Cholesky
+ * factorization, nonpositive) pivot was met.
+ */
+
+
+/*
+ * Position of the diagonal entry in each row of a CSR matrix with sorted
+ * indices, or -1 for rows without one.
+ */
+template <class I>
+void csr_diagonal_positions(const I n_row,
+                            const I Ap[],
+                            const I Aj[],
+                                  I diag[])
+{
+    for(I i = 0; i < n_row; i++){
+        const I * pos = std::lower_bound(Aj + Ap[i], Aj + Ap[i+1], i);
+        diag[i] = (pos != Aj + Ap[i+1] && *pos == i) ? (I)(pos - Aj) : -1;
+    }
+}
+
+
+/*
+ * Compute the ILU(0) factorization of a CSR matrix A in place
+ *
+ * Input Arguments:
+ *   I  n_row           - dimension of A
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *
+ * Input/Output Arguments:
+ *   T  Ax[nnz(A)]      - A on entry, L and U on return
+ *
+ * Return Value:
+ *   -1 on success, otherwise the first row with a zero pivot
+ *
+ * Note:
+ *   A must be in canonical format (sorted indices, no duplicates)
+ *   L and U keep the sparsity pattern of A: fill outside of it is
+ *   dropped.
+ *
+ *   Complexity: O(sum over entries A_ik, k < i, of nnz(row k of U))
+ *
+ */
+template <class I, class T>
+I csr_ilu0(const I n_row,
+           const I Ap[],
+           const I Aj[],
+                 T Ax[])
+{
+    std::vector<I> diag(n_row);
+    csr_diagonal_positions(n_row, Ap, Aj, &diag[0]);
+
+    // position of each column in the current row, or -1
+    std::vector<I> pos(n_row, -1);
+
+    for(I i = 0; i < n_row; i++){
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            pos[Aj[jj]] = jj;
+        }
+
+        for(I jj = Ap[i]; jj < Ap[i+1] && Aj[jj] < i; jj++){
+            const I k = Aj[jj];
+            const T l_ik = Ax[jj] / Ax[diag[k]];
+            Ax[jj] = l_ik;
+            for(I kk = diag[k] + 1; kk < Ap[k+1]; kk++){
+                const I p = pos[Aj[kk]];
+                if(p != -1){
+                    Ax[p] -= l_ik * Ax[kk];
+                }
+            }
+        }
+
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            pos[Aj[jj]] = -1;
+        }
+
+        if(diag[i] == -1 || Ax[diag[i]] == 0){
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+
+/*
+ * Compute the IC(0) factorization of a symmetric positive definite
+ * matrix in place
+ *
+ * Input Arguments:
+ *   I  n_row           - dimension of A
+ *   I  Ap[n_row+1]     - row pointer of the lower triangle of A
+ *   I  Aj[nnz]         - column indices of the lower triangle of A
+ *
+ * Input/Output Arguments:
+ *   T  Ax[nnz]         - lower triangle of A on entry, L on return
+ *
+ * Return Value:
+ *   -1 on success, otherwise the first row with a nonpositive pivot
+ *
+ * Note:
+ *   The lower triangle must be in canonical format and include every
+ *   diagonal entry.  L keeps its sparsity pattern.
+ *
+ *   Entry L_ij is computed from the sparse dot product of rows i and j
+ *   of L, by merging their sorted indices.
+ *
+ */
+template <class I, class T>
+I csr_ic0(const I n_row,
+          const I Ap[],
+          const I Aj[],
+                T Ax[])
+{
+    for(I i = 0; i < n_row; i++){
+        const I row_end = Ap[i+1];
+        if(row_end == Ap[i] || Aj[row_end - 1] != i){
+            return i;  // missing diagonal
+        }
+
+        for(I jj = Ap[i]; jj < row_end; jj++){
+            const I j = Aj[jj];
+
+            // sum of L_ik * L_jk over k < j
+            T sum = 0;
+            I a = Ap[i], b = Ap[j];
+            while(a < jj && Aj[b] < j){
+                if(Aj[a] == Aj[b]){
+                    sum += Ax[a] * Ax[b];
+                    a++; b++;
+                } else if(Aj[a] < Aj[b]){
+                    a++;
+                } else {
+                    b++;
+                }
+            }
+
+            if(j < i){
+                Ax[jj] = (Ax[jj] - sum) / Ax[Ap[j+1] - 1];
+            } else {
+                const T d = Ax[jj] - sum;
+                if(!(d > 0)){
+                    return i;
+                }
+                Ax[jj] = std::sqrt(d);
+            }
+        }
+    }
+
+    return -1;
+}
+
+
+/*
+ * Compute the ILUT factorization of a CSR matrix A
+ *
+ * Input Arguments:
+ *   I  n_row           - dimension of A
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   T  Ax[nnz(A)]      - nonzeros
+ *   double drop_tol    - relative drop tolerance
+ *   I  fill            - largest number of entries kept in each row of
+ *                        L and of U, besides the diagonal
+ *
+ * Output Arguments:
+ *   vec<I> Bp          - row pointer of L and U
+ *   vec<I> Bj          - column indices of L and U
+ *   vec<T> Bx          - nonzeros of L and U
+ *
+ * Return Value:
+ *   -1 on success, otherwise the first row with a zero pivot
+ *
+ * Note:
+ *   Output arrays Bp, Bj, and Bx will be allocated within in the method
+ *   This is ILUT(fill, drop_tol) by Saad: row i is eliminated with the
+ *   rows of U computed so far, in increasing column order.  Entries
+ *   smaller than drop_tol times the 2-norm of row i of A divided by its
+ *   length are dropped, and only the fill largest entries of each
+ *   factor are kept.  The rows of the result have sorted indices.
+ *
+ *   Input: rows of A need not have sorted indices, duplicates are summed
+ *
+ */
+template <class I, class T>
+I csr_ilut(const I n_row,
+           const I Ap[],
+           const I Aj[],
+           const T Ax[],
+           const double drop_tol,
+           const I fill,
+           std::vector<I>* Bp,
+           std::vector<I>* Bj,
+           std::vector<T>* Bx)
+{
+    Bp->assign(1, 0);
+    Bj->clear();
+    Bx->clear();
+
+    // first entry of U in each row of the result
+    std::vector<I> diag(n_row);
+
+    // the current row as a dense vector with a list of its nonzeros
+    std::vector<T> w(n_row, 0);
+    std::vector<bool> nonzero(n_row, false);
+    std::vector<I> pattern;
+
+    // lower columns still to be eliminated, smallest first
+    std::priority_queue<I, std::vector<I>, std::greater<I> > lower;
+
+    std::vector< std::pair<double,I> > kept;
+
+    for(I i = 0; i < n_row; i++){
+        double norm = 0;
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            const I j = Aj[jj];
+            if(!nonzero[j]){
+                nonzero[j] = true;
+                pattern.push_back(j);
+                if(j < i) lower.push(j);
+            }
+            w[j] += Ax[jj];
+        }
+        for(I jj = 0; jj < (I) pattern.size(); jj++){
+            const double v = w[pattern[jj]];
+            norm += v * v;
+        }
+        const I len = Ap[i+1] - Ap[i];
+        const double tau = len > 0 ? drop_tol * std::sqrt(norm) / len : 0.0;
+
+        // eliminate with the rows of U above
+        while(!lower.empty()){
+            const I k = lower.top();
+            lower.pop();
+
+            const T l_ik = w[k] / (*Bx)[diag[k]];
+            if(std::fabs((double) l_ik) < tau){
+                w[k] = 0;
+                continue;
+            }
+            w[k] = l_ik;
+            for(I kk = diag[k] + 1; kk < (*Bp)[k+1]; kk++){
+                const I j = (*Bj)[kk];
+                if(!nonzero[j]){
+                    nonzero[j] = true;
+                    pattern.push_back(j);
+                    if(j < i) lower.push(j);
+                }
+                w[j] -= l_ik * (*Bx)[kk];
+            }
+        }
+
+        // keep the fill largest entries of L, then of U
+        for(int part = 0; part < 2; part++){
+            kept.clear();
+            for(I jj = 0; jj < (I) pattern.size(); jj++){
+                const I j = pattern[jj];
+                if(j != i && (j < i) == (part == 0) &&
+                        w[j] != 0 && !(std::fabs((double) w[j]) < tau)){
+                    kept.push_back(std::make_pair(-std::fabs((double) w[j]), j));
+                }
+            }
+            if((I) kept.size() > fill){
+                std::nth_element(kept.begin(), kept.begin() + fill, kept.end());
+                kept.resize(fill);
+            }
+            for(I n = 0; n < (I) kept.size(); n++){
+                kept[n].first = 0;  // sort by column
+            }
+            std::sort(kept.begin(), kept.end());
+
+            if(part == 1){
+                diag[i] = (I) Bj->size();
+                if(w[i] == 0){
+                    return i;
+                }
+                Bj->push_back(i);
+                Bx->push_back(w[i]);
+            }
+            for(I n = 0; n < (I) kept.size(); n++){
+                Bj->push_back(kept[n].second);
+                Bx->push_back(w[kept[n].second]);
+            }
+        }
+        Bp->push_back((I) Bj->size());
+
+        for(I jj = 0; jj < (I) pattern.size(); jj++){
+            w[pattern[jj]] = 0;
+            nonzero[pattern[jj]] = false;
+        }
+        pattern.clear();
+    }
+
+    return -1;
+}
+
+#endif
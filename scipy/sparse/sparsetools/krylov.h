@@ -0,0 +1,499 @@
+#ifndef __KRYLOV_H__
+#define __KRYLOV_H__
+
+#include <cmath>
+#include <algorithm>
+
+#include "dense.h"
+#include "csr.h"
+#include "csc.h"
+#include "bsr.h"
+#include "dia.h"
+#include "triangular.h"
+
+/*
+ * Krylov subspace solvers for sparse linear systems
+ *
+ * The whole iteration runs here: products with A use the sparsetools
+ * matvec of its format and the preconditioner is an incomplete
+ * factorization from ilu.h, applied with the triangular solves.
+ *
+ * The solvers keep their state in a work array, so a solve can be run
+ * in chunks of iterations, e.g. to call back into Python in between.
+ * The work array must be zero on the first call and is laid out as
+ *
+ *   work[0]              - 2-norm of the current residual b - A*x
+ *   work[1..7]           - scalars of the method
+ *   work[8:]             - vectors of the method:
+ *                            CG        4*n
+ *                            BiCGSTAB  7*n
+ *                            GMRES     (restart+4)*n + (restart+1)*restart
+ *                                        + 4*restart + 1
+ */
+
+#define KRYLOV_HEADER 8
+
+
+/*
+ * A square matrix in CSR (format 0), CSC (1), BSR (2) or DIA (3) format
+ *
+ * For BSR matrices R and C are the block sizes.  For DIA matrices Ap
+ * holds the offsets, R the number of diagonals and C their length, and
+ * Aj is not used.
+ */
+template <class I, class T>
+struct krylov_matrix
+{
+    I format, n, R, C;
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+
+    // y = A*x
+    void matvec(const T x[], T y[]) const
+    {
+        std::fill(y, y + n, (T) 0);
+        switch(format){
+            case 0: csr_matvec(n, n, Ap, Aj, Ax, x, y); break;
+            case 1: csc_matvec(n, n, Ap, Aj, Ax, x, y); break;
+            case 2: bsr_matvec(n / R, n / C, R, C, Ap, Aj, Ax, x, y); break;
+            case 3: dia_matvec(n, n, R, C, Ap, Ax, x, y); break;
+        }
+    }
+};
+
+
+/*
+ * No preconditioner (kind 0), or an incomplete LU (1) or Cholesky (2)
+ * factor from ilu.h in CSR format
+ */
+template <class I, class T>
+struct krylov_preconditioner
+{
+    I kind, n;
+    const I * Bp;
+    const I * Bj;
+    const T * Bx;
+
+    // z = M*r, where M approximates the inverse of A.  Returns false
+    // if the factor has a zero or missing diagonal entry.
+    bool apply(const T r[], T z[]) const
+    {
+        std::copy(r, r + n, z);
+        if(kind == 1){
+            return csr_triangular_solve(n, (I) 1, Bp, Bj, Bx, (I) 1, (I) 1, (I) 0, z) == -1
+                && csr_triangular_solve(n, (I) 1, Bp, Bj, Bx, (I) 0, (I) 0, (I) 0, z) == -1;
+        } else if(kind == 2){
+            return csr_triangular_solve(n, (I) 1, Bp, Bj, Bx, (I) 1, (I) 0, (I) 0, z) == -1
+                && csr_triangular_solve(n, (I) 1, Bp, Bj, Bx, (I) 1, (I) 0, (I) 1, z) == -1;
+        }
+        return true;
+    }
+};
+
+
+template <class I, class T>
+T krylov_norm(const I n, const T x[])
+{
+    return std::sqrt(dot(n, x, x));
+}
+
+
+/*
+ * Preconditioned conjugate gradients
+ *
+ * Returns the number of iterations done, or -1 on breakdown.
+ */
+template <class I, class T>
+I krylov_cg(const krylov_matrix<I,T>& A,
+            const krylov_preconditioner<I,T>& M,
+            const T b[],
+                  T x[],
+                  T work[],
+            const double atol,
+            const I maxiter)
+{
+    const I n = A.n;
+    T& resid = work[0];
+    T& rho   = work[2];
+    T * r = work + KRYLOV_HEADER;
+    T * z = r + n;
+    T * p = z + n;
+    T * q = p + n;
+
+    if(work[1] == 0){
+        A.matvec(x, q);
+        for(I i = 0; i < n; i++){
+            r[i] = b[i] - q[i];
+        }
+        if(!M.apply(r, z)){
+            return -1;
+        }
+        std::copy(z, z + n, p);
+        rho   = dot(n, r, z);
+        resid = krylov_norm(n, r);
+        work[1] = 1;
+    }
+
+    I it = 0;
+    while(it < maxiter && !(resid <= atol)){
+        A.matvec(p, q);
+        const T pq = dot(n, p, q);
+        if(rho == 0 || pq == 0){
+            return -1;
+        }
+        const T alpha = rho / pq;
+        axpy(n, alpha, p, x);
+        axpy(n, (T) -alpha, q, r);
+        resid = krylov_norm(n, r);
+        it++;
+        if(resid <= atol){
+            break;
+        }
+
+        if(!M.apply(r, z)){
+            return -1;
+        }
+        const T rho_next = dot(n, r, z);
+        const T beta = rho_next / rho;
+        for(I i = 0; i < n; i++){
+            p[i] = z[i] + beta * p[i];
+        }
+        rho = rho_next;
+    }
+    return it;
+}
+
+
+/*
+ * Right preconditioned BiCGSTAB
+ *
+ * Returns the number of iterations done, or -1 on breakdown.
+ */
+template <class I, class T>
+I krylov_bicgstab(const krylov_matrix<I,T>& A,
+                  const krylov_preconditioner<I,T>& M,
+                  const T b[],
+                        T x[],
+                        T work[],
+                  const double atol,
+                  const I maxiter)
+{
+    const I n = A.n;
+    T& resid = work[0];
+    T& rho   = work[2];
+    T& alpha = work[3];
+    T& omega = work[4];
+    T * r    = work + KRYLOV_HEADER;
+    T * rhat = r + n;
+    T * p    = rhat + n;
+    T * v    = p + n;
+    T * phat = v + n;
+    T * shat = phat + n;
+    T * t    = shat + n;
+
+    if(work[1] == 0){
+        A.matvec(x, t);
+        for(I i = 0; i < n; i++){
+            r[i] = b[i] - t[i];
+        }
+        std::copy(r, r + n, rhat);
+        std::fill(p, p + n, (T) 0);
+        std::fill(v, v + n, (T) 0);
+        rho = alpha = omega = 1;
+        resid = krylov_norm(n, r);
+        work[1] = 1;
+    }
+
+    I it = 0;
+    while(it < maxiter && !(resid <= atol)){
+        const T rho_next = dot(n, rhat, r);
+        if(rho_next == 0 || omega == 0){
+            return -1;
+        }
+        const T beta = (rho_next / rho) * (alpha / omega);
+        for(I i = 0; i < n; i++){
+            p[i] = r[i] + beta * (p[i] - omega * v[i]);
+        }
+        if(!M.apply(p, phat)){
+            return -1;
+        }
+        A.matvec(phat, v);
+        const T rv = dot(n, rhat, v);
+        if(rv == 0){
+            return -1;
+        }
+        rho   = rho_next;
+        alpha = rho / rv;
+        axpy(n, (T) -alpha, v, r);      // r is now s
+        axpy(n, alpha, phat, x);
+        resid = krylov_norm(n, r);
+        it++;
+        if(resid <= atol){
+            break;
+        }
+
+        if(!M.apply(r, shat)){
+            return -1;
+        }
+        A.matvec(shat, t);
+        const T tt = dot(n, t, t);
+        if(tt == 0){
+            return -1;
+        }
+        omega = dot(n, t, r) / tt;
+        axpy(n, omega, shat, x);
+        axpy(n, (T) -omega, t, r);
+        resid = krylov_norm(n, r);
+    }
+    return it;
+}
+
+
+/*
+ * x = x0 + M*V*y, where y solves the first j rows of the triangular
+ * system H*y = g left by the Givens rotations
+ *
+ * Returns false if the preconditioner fails.
+ */
+template <class I, class T>
+bool krylov_gmres_update(const krylov_matrix<I,T>& A,
+                         const krylov_preconditioner<I,T>& M,
+                         const I m,
+                         const I j,
+                         const T V[],
+                         const T x0[],
+                         const T H[],
+                         const T g[],
+                               T y[],
+                               T w[],
+                               T z[],
+                               T x[])
+{
+    const I n = A.n;
+    for(I k = j - 1; k >= 0; k--){
+        T sum = g[k];
+        for(I l = k + 1; l < j; l++){
+            sum -= H[m * k + l] * y[l];
+        }
+        y[k] = sum / H[m * k + k];
+    }
+    std::fill(w, w + n, (T) 0);
+    for(I k = 0; k < j; k++){
+        axpy(n, y[k], V + n * k, w);
+    }
+    if(!M.apply(w, z)){
+        return false;
+    }
+    for(I i = 0; i < n; i++){
+        x[i] = x0[i] + z[i];
+    }
+    return true;
+}
+
+
+/*
+ * Right preconditioned GMRES restarted every m iterations
+ *
+ * The residual norm is updated every iteration from the Givens
+ * rotations, and recomputed from b - A*x at each restart.  The current
+ * solution is written to x on return, also in the middle of a cycle.
+ *
+ * Returns the number of iterations done, or -1 on breakdown.
+ */
+template <class I, class T>
+I krylov_gmres(const krylov_matrix<I,T>& A,
+               const krylov_preconditioner<I,T>& M,
+               const I m,
+               const T b[],
+                     T x[],
+                     T work[],
+               const double atol,
+               const I maxiter)
+{
+    const I n = A.n;
+    T& resid = work[0];
+    T * V  = work + KRYLOV_HEADER;      // Krylov basis, (m+1) x n
+    T * x0 = V + n * (m + 1);           // solution at the start of the cycle
+    T * w  = x0 + n;
+    T * z  = w + n;
+    T * H  = z + n;                     // Hessenberg matrix, (m+1) x m
+    T * cs = H + m * (m + 1);
+    T * sn = cs + m;
+    T * g  = sn + m;
+    T * y  = g + m + 1;
+
+    I j = (I) work[5];                  // column of H in the current cycle
+    I it = 0;
+
+    for(;;){
+        if(j == 0){
+            A.matvec(x, w);
+            for(I i = 0; i < n; i++){
+                V[i] = b[i] - w[i];
+            }
+            const T beta = krylov_norm(n, V);
+            resid = beta;
+            if(resid <= atol || it == maxiter){
+                break;
+            }
+            std::copy(x, x + n, x0);
+            scal(n, (T) (1 / beta), V);
+            std::fill(g, g + m + 1, (T) 0);
+            g[0] = beta;
+        } else if(it == maxiter){
+            if(!krylov_gmres_update(A, M, m, j, V, x0, H, g, y, w, z, x)){
+                work[5] = 0;
+                return -1;
+            }
+            break;
+        }
+
+        // Arnoldi step with modified Gram-Schmidt
+        T * v_next = V + n * (j + 1);
+        if(!M.apply(V + n * j, z)){
+            work[5] = 0;
+            return -1;
+        }
+        A.matvec(z, v_next);
+        for(I k = 0; k <= j; k++){
+            const T h = dot(n, v_next, V + n * k);
+            H[m * k + j] = h;
+            axpy(n, (T) -h, V + n * k, v_next);
+        }
+        const T h_next = krylov_norm(n, v_next);
+        H[m * (j + 1) + j] = h_next;
+        if(h_next != 0){
+            scal(n, (T) (1 / h_next), v_next);
+        }
+
+        // apply the previous rotations and eliminate H[j+1,j]
+        for(I k = 0; k < j; k++){
+            const T a = H[m * k + j];
+            const T c = H[m * (k + 1) + j];
+            H[m * k + j]       =  cs[k] * a + sn[k] * c;
+            H[m * (k + 1) + j] = -sn[k] * a + cs[k] * c;
+        }
+        const T a = H[m * j + j];
+        const T c = H[m * (j + 1) + j];
+        if(c == 0){
+            cs[j] = 1;
+            sn[j] = 0;
+        } else if(std::fabs((double) c) > std::fabs((double) a)){
+            const T tau = a / c;
+            sn[j] = 1 / std::sqrt(1 + tau * tau);
+            cs[j] = tau * sn[j];
+        } else {
+            const T tau = c / a;
+            cs[j] = 1 / std::sqrt(1 + tau * tau);
+            sn[j] = tau * cs[j];
+        }
+        H[m * j + j]       = cs[j] * a + sn[j] * c;
+        H[m * (j + 1) + j] = 0;
+        if(H[m * j + j] == 0){
+            work[5] = 0;
+            return -1;
+        }
+        g[j + 1] = -sn[j] * g[j];
+        g[j]     =  cs[j] * g[j];
+
+        j++;
+        it++;
+        resid = std::fabs(g[j]);
+
+        if(resid <= atol || j == m || h_next == 0){
+            // end of the cycle: update x and restart
+            if(!krylov_gmres_update(A, M, m, j, V, x0, H, g, y, w, z, x)){
+                work[5] = 0;
+                return -1;
+            }
+            j = 0;
+        }
+    }
+
+    work[5] = (T) j;
+    return it;
+}
+
+
+/*
+ * Solve A*x = b with a Krylov subspace method
+ *
+ * Input Arguments:
+ *   I  method          - CG (0), BiCGSTAB (1) or GMRES (2)
+ *   I  restart         - GMRES restart length
+ *   I  format          - format of A, see krylov_matrix
+ *   I  n_row           - dimension of A
+ *   I  R, C            - BSR block size, or DIA number and length of
+ *                        the diagonals
+ *   I  Ap, Aj          - index arrays of A (Ap holds the DIA offsets)
+ *   T  Ax              - nonzeros of A
+ *   I  precond         - preconditioner kind, see krylov_preconditioner
+ *   I  Bp, Bj          - index arrays of the preconditioner factor
+ *   T  Bx              - nonzeros of the preconditioner factor
+ *   T  Xx[n_row]       - right-hand side b
+ *   double atol        - stop when the residual norm is at most atol
+ *   I  maxiter         - largest number of iterations in this call
+ *
+ * Input/Output Arguments:
+ *   T  Yx[n_row]       - initial guess on entry, solution on return
+ *   T  work[]          - solver state, zero on the first call
+ *
+ * Return Value:
+ *   number of iterations done, or -1 on breakdown (including a zero or
+ *   missing diagonal entry in the preconditioner factor)
+ *
+ * Note:
+ *   The solve has converged when work[0] <= atol.  Otherwise it can be
+ *   continued by calling again with the same arguments, which gives the
+ *   same iterates as one call with a larger maxiter.
+ *
+ *   The preconditioner factor has canonical format, as returned by the
+ *   factorizations in ilu.h.  For BSR matrices n_row must be a multiple
+ *   of R and C.
+ *
+ */
+template <class I, class T>
+I krylov_solve(const I method,
+               const I restart,
+               const I format,
+               const I n_row,
+               const I R,
+               const I C,
+               const I Ap[],
+               const I Aj[],
+               const T Ax[],
+               const I precond,
+               const I Bp[],
+               const I Bj[],
+               const T Bx[],
+               const T Xx[],
+                     T Yx[],
+                     T work[],
+               const double atol,
+               const I maxiter)
+{
+    krylov_matrix<I,T> A;
+    A.format = format;
+    A.n  = n_row;
+    A.R  = R;
+    A.C  = C;
+    A.Ap = Ap;
+    A.Aj = Aj;
+    A.Ax = Ax;
+
+    krylov_preconditioner<I,T> M;
+    M.kind = precond;
+    M.n  = n_row;
+    M.Bp = Bp;
+    M.Bj = Bj;
+    M.Bx = Bx;
+
+    switch(method){
+        case 0:  return krylov_cg(A, M, Xx, Yx, work, atol, maxiter);
+        case 1:  return krylov_bicgstab(A, M, Xx, Yx, work, atol, maxiter);
+        default: return krylov_gmres(A, M, restart, Xx, Yx, work, atol, maxiter);
+    }
+}
+
+#endif
@@ -0,0 +1,467 @@
+#ifndef __MMIO_H__
+#define __MMIO_H__
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "parallel.h"
+
+/*
+ * MatrixMarket text parsing and formatting
+ *
+ * The body of a MatrixMarket file is a sequence of entry lines.  An
+ * entry holds the 1-based row and column index (coordinate format only)
+ * followed by its values: none for pattern matrices, one for integer
+ * and real matrices and two for complex matrices.  Blank lines and
+ * lines starting with '%' are skipped.
+ *
+ * The text is split at line boundaries into one chunk per thread.  Each
+ * thread counts the entries of its chunk, then parses them into their
+ * place in the output, so the entries keep their order in the file.
+ */
+
+
+inline bool mm_is_space(const char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline const char * mm_skip_space(const char * p, const char * end)
+{
+    while(p < end && mm_is_space(*p)){
+        p++;
+    }
+    return p;
+}
+
+inline bool mm_at_token_end(const char * p, const char * end)
+{
+    return p == end || *p == '\n' || mm_is_space(*p);
+}
+
+
+/*
+ * Parse a decimal integer.  Returns the position after it, or 0 if
+ * there is none or it does not fit in a long long.
+ */
+inline const char * mm_parse_integer(const char * p,
+                                     const char * end,
+                                     long long * value)
+{
+    bool negative = false;
+    if(p < end && (*p == '-' || *p == '+')){
+        negative = (*p == '-');
+        p++;
+    }
+
+    const char * digits = p;
+    unsigned long long n = 0;
+    const unsigned long long max = std::numeric_limits<long long>::max();
+    while(p < end && *p >= '0' && *p <= '9'){
+        const unsigned long long d = *p - '0';
+        if(n > (max - d) / 10){
+            return 0;
+        }
+        n = 10 * n + d;
+        p++;
+    }
+    if(p == digits){
+        return 0;
+    }
+
+    *value = negative ? -(long long) n : (long long) n;
+    return p;
+}
+
+
+/*
+ * Parse a floating point number.  Returns the position after it, or 0 if
+ * there is none.
+ *
+ * Numbers with at most 19 significant digits whose value is an integer
+ * below 2^53 times a power of ten up to 10^22 are converted with one
+ * multiplication or division, which is exact (Clinger's fast path).
+ * Other numbers, and inf and nan, are passed to strtod.
+ */
+inline const char * mm_parse_double(const char * p,
+                                    const char * end,
+                                    double * value)
+{
+    static const double powers[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    const char * start = p;
+    bool negative = false;
+    if(p < end && (*p == '-' || *p == '+')){
+        negative = (*p == '-');
+        p++;
+    }
+
+    unsigned long long mantissa = 0;
+    int n_digits = 0;           // significant digits in mantissa
+    int exponent = 0;
+    bool any = false;
+    bool exact = true;
+
+    for(; p < end && *p >= '0' && *p <= '9'; p++){
+        any = true;
+        if(n_digits < 19){
+            mantissa = 10 * mantissa + (*p - '0');
+            if(mantissa != 0) n_digits++;
+        } else {
+            exponent++;
+            exact = exact && *p == '0';
+        }
+    }
+    if(p < end && *p == '.'){
+        for(p++; p < end && *p >= '0' && *p <= '9'; p++){
+            any = true;
+            if(n_digits < 19){
+                mantissa = 10 * mantissa + (*p - '0');
+                if(mantissa != 0) n_digits++;
+                exponent--;
+            } else {
+                exact = exact && *p == '0';
+            }
+        }
+    }
+
+    if(any && p < end && (*p == 'e' || *p == 'E')){
+        const char * q = p + 1;
+        bool exp_negative = false;
+        if(q < end && (*q == '-' || *q == '+')){
+            exp_negative = (*q == '-');
+            q++;
+        }
+        if(q < end && *q >= '0' && *q <= '9'){
+            int e = 0;
+            for(; q < end && *q >= '0' && *q <= '9'; q++){
+                if(e < 100000) e = 10 * e + (*q - '0');
+            }
+            exponent += exp_negative ? -e : e;
+            p = q;
+        }
+    }
+
+    if(any && mm_at_token_end(p, end)){
+        if(mantissa == 0){
+            *value = negative ? -0.0 : 0.0;
+            return p;
+        }
+        if(exact && mantissa < (1ULL << 53) && exponent >= -22 && exponent <= 22){
+            double v = (double) mantissa;
+            v = exponent < 0 ? v / powers[-exponent] : v * powers[exponent];
+            *value = negative ? -v : v;
+            return p;
+        }
+    }
+
+    // slow path: strtod on a null-terminated copy of the token
+    const char * token_end = start;
+    while(!mm_at_token_end(token_end, end)){
+        token_end++;
+    }
+    if(token_end == start){
+        return 0;
+    }
+    const std::string token(start, token_end);
+    char * parsed;
+    *value = std::strtod(token.c_str(), &parsed);
+    if(parsed != token.c_str() + token.size()){
+        return 0;
+    }
+    return token_end;
+}
+
+
+/*
+ * Parse one value of type T, as an integer for integer types
+ */
+template <class T>
+const char * mm_parse_value(const char * p, const char * end, T * value)
+{
+    if(std::numeric_limits<T>::is_integer){
+        long long v = 0;
+        p = mm_parse_integer(p, end, &v);
+        *value = (T) v;
+    } else {
+        double v = 0;
+        p = mm_parse_double(p, end, &v);
+        *value = (T) v;
+    }
+    return p;
+}
+
+
+/*
+ * Find the first line of the text starting at or after pos
+ */
+template <class I>
+I mm_line_start(const I n_text, const char * text, I pos)
+{
+    while(pos > 0 && pos < n_text && text[pos - 1] != '\n'){
+        pos++;
+    }
+    return std::min(pos, n_text);
+}
+
+
+/*
+ * Position after the end of the line containing p
+ */
+inline const char * mm_next_line(const char * p, const char * end)
+{
+    const char * newline = (const char *) std::memchr(p, '\n', end - p);
+    return newline ? newline + 1 : end;
+}
+
+
+/*
+ * Whether the line at p holds an entry, rather than being blank or a
+ * comment.  Sets p to the first non-blank character of the line.
+ */
+inline bool mm_is_entry(const char *& p, const char * end)
+{
+    p = mm_skip_space(p, end);
+    return p < end && *p != '\n' && *p != '%';
+}
+
+
+/*
+ * Parse MatrixMarket entry lines
+ *
+ * Input Arguments:
+ *   I  n_row               - number of rows of the matrix
+ *   I  n_col               - number of columns of the matrix
+ *   I  n_indices           - 2 for coordinate format, 0 for array format
+ *   I  n_values            - values per entry (0, 1 or 2)
+ *   I  max_entries         - room for entries in Ai, Aj and Ax
+ *   I  n_text              - length of the text
+ *   uchar text[n_text]     - entry lines
+ *   I  n_threads           - number of threads (<= 0 means the default)
+ *
+ * Output Arguments:
+ *   I  Ai[max_entries]             - row indices (0-based)
+ *   I  Aj[max_entries]             - column indices (0-based)
+ *   T  Ax[max_entries*n_values]    - values
+ *
+ * Return Value:
+ *   the number of entries parsed, or -1 - k if entry k is invalid, has
+ *   an index out of range, or does not fit in max_entries
+ *
+ * Note:
+ *   Ai and Aj are not used for the array format.
+ *
+ *   Complexity: O(n_text)
+ *
+ */
+template <class I, class T>
+I mm_parse_entries(const I n_row,
+                   const I n_col,
+                   const I n_indices,
+                   const I n_values,
+                   const I max_entries,
+                   const I n_text,
+                   const unsigned char text[],
+                         I Ai[],
+                         I Aj[],
+                         T Ax[],
+                   const I n_threads)
+{
+    const char * const chars = (const char *) text;
+
+    // roughly 64KB of text per thread at least
+    const I t = sparsetools_num_threads(n_threads, n_text / 65536);
+
+    std::vector<I> bounds(t + 1);
+    for(I p = 0; p <= t; p++){
+        bounds[p] = mm_line_start(n_text, chars, (I)(((double) n_text * p) / t));
+    }
+
+    // count the entries of each chunk
+    std::vector<I> offsets(t + 1, 0);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        const char * q = chars + bounds[p];
+        const char * chunk_end = chars + bounds[p+1];
+        I count = 0;
+        while(q < chunk_end){
+            if(mm_is_entry(q, chunk_end)){
+                count++;
+            }
+            q = mm_next_line(q, chunk_end);
+        }
+        offsets[p+1] = count;
+    }
+    for(I p = 0; p < t; p++){
+        offsets[p+1] += offsets[p];
+    }
+
+    // parse the entries of each chunk, recording the first invalid one
+    std::vector<I> failed(t, offsets[t]);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        const char * q = chars + bounds[p];
+        const char * chunk_end = chars + bounds[p+1];
+        I k = offsets[p];
+        while(q < chunk_end){
+            if(!mm_is_entry(q, chunk_end)){
+                q = mm_next_line(q, chunk_end);
+                continue;
+            }
+            if(k >= max_entries){
+                failed[p] = k;
+                break;
+            }
+
+            bool valid = true;
+            for(I n = 0; n < n_indices && valid; n++){
+                long long index;
+                q = mm_parse_integer(q, chunk_end, &index);
+                const I bound = n == 0 ? n_row : n_col;
+                valid = q != 0 && mm_at_token_end(q, chunk_end)
+                        && index >= 1 && index <= bound;
+                if(valid){
+                    (n == 0 ? Ai : Aj)[k] = (I) (index - 1);
+                    q = mm_skip_space(q, chunk_end);
+                }
+            }
+            for(I n = 0; n < n_values && valid; n++){
+                q = mm_parse_value(q, chunk_end, Ax + n_values * k + n);
+                valid = q != 0;
+                if(valid){
+                    q = mm_skip_space(q, chunk_end);
+                }
+            }
+            if(!valid || (q < chunk_end && *q != '\n')){
+                failed[p] = k;
+                break;
+            }
+
+            q = mm_next_line(q, chunk_end);
+            k++;
+        }
+    }
+
+    const I k = *std::min_element(failed.begin(), failed.end());
+    return k < offsets[t] ? -1 - k : offsets[t];
+}
+
+
+/*
+ * Append the decimal digits of n to the buffer
+ */
+inline void mm_append_integer(std::vector<char>& buffer, long long n)
+{
+    char digits[24];
+    int len = 0;
+    unsigned long long u = n < 0 ? 0ULL - (unsigned long long) n : (unsigned long long) n;
+    do {
+        digits[len++] = (char) ('0' + u % 10);
+        u /= 10;
+    } while(u != 0);
+    if(n < 0){
+        buffer.push_back('-');
+    }
+    while(len > 0){
+        buffer.push_back(digits[--len]);
+    }
+}
+
+
+/*
+ * Format MatrixMarket entry lines
+ *
+ * Input Arguments:
+ *   I  n_entries           - number of entries
+ *   I  n_indices           - 2 for coordinate format, 0 for array format
+ *   I  n_values            - values per entry (0, 1 or 2)
+ *   I  Ai[n_entries]       - row indices (0-based)
+ *   I  Aj[n_entries]       - column indices (0-based)
+ *   T  Ax[n_entries*n_values] - values
+ *   I  precision           - significant digits of floating point values
+ *   I  scientific          - format floating point values with %e rather
+ *                            than %g
+ *   I  n_threads           - number of threads (<= 0 means the default)
+ *
+ * Output Arguments:
+ *   vec<uchar> text        - one line per entry
+ *
+ * Note:
+ *   Output array text will be allocated within in the method
+ *   Indices are written 1-based, integer values as integers.
+ *
+ */
+template <class I, class T>
+void mm_format_entries(const I n_entries,
+                       const I n_indices,
+                       const I n_values,
+                       const I Ai[],
+                       const I Aj[],
+                       const T Ax[],
+                       const I precision,
+                       const I scientific,
+                       std::vector<unsigned char>* text,
+                       const I n_threads)
+{
+    const I t = sparsetools_num_threads(n_threads, n_entries / 4096);
+    const int digits = (int) std::max((I) 0, std::min(precision, (I) 40));
+    const char * format = scientific ? "%.*e" : "%.*g";
+
+    std::vector< std::vector<char> > parts(t);
+
+    SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+    for(I p = 0; p < t; p++){
+        const I begin = (I)(((double) n_entries * p) / t);
+        const I end   = (I)(((double) n_entries * (p + 1)) / t);
+        std::vector<char>& buffer = parts[p];
+        buffer.reserve((size_t) (end - begin) * (12 * n_indices + n_values * (digits + 8) + 1));
+
+        char number[64];
+        for(I k = begin; k < end; k++){
+            for(I n = 0; n < n_indices; n++){
+                mm_append_integer(buffer, (long long) (n == 0 ? Ai : Aj)[k] + 1);
+                buffer.push_back(' ');
+            }
+            for(I n = 0; n < n_values; n++){
+                const T v = Ax[n_values * k + n];
+                if(std::numeric_limits<T>::is_integer){
+                    mm_append_integer(buffer, (long long) v);
+                } else {
+                    const int len = std::sprintf(number, format, digits, (double) v);
+                    buffer.insert(buffer.end(), number, number + len);
+                }
+                buffer.push_back(' ');
+            }
+            if(n_indices + n_values > 0){
+                buffer.back() = '\n';
+            } else {
+                buffer.push_back('\n');
+            }
+        }
+    }
+
+    size_t size = 0;
+    for(I p = 0; p < t; p++){
+        size += parts[p].size();
+    }
+    text->resize(size);
+    size_t pos = 0;
+    for(I p = 0; p < t; p++){
+        if(!parts[p].empty()){
+            std::memcpy(&(*text)[pos], &parts[p][0], parts[p].size());
+            pos += parts[p].size();
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef __PARALLEL_H__
+#define __PARALLEL_H__
+
+/*
+ * Helpers for the multithreaded kernels.
+ *
+ * Threading uses OpenMP when the extensions are compiled with it (see
+ * setup.py); otherwise SPARSETOOLS_PRAGMA_OMP expands to nothing and
+ * every kernel runs its chunks one after the other.  Work is always split
+ * into the same chunks for a given thread count, so results do not depend
+ * on scheduling.
+ */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+
+
+/*
+ * SPARSETOOLS_PRAGMA_OMP(parallel for ...) expands to
+ * "#pragma omp parallel for ..." when compiling with OpenMP and to nothing
+ * otherwise, so compilers without OpenMP do not warn about unknown pragmas.
+ */
+#define SPARSETOOLS_PRAGMA(x) _Pragma(#x)
+#ifdef _OPENMP
+#define SPARSETOOLS_PRAGMA_OMP(x) SPARSETOOLS_PRAGMA(omp x)
+#else
+#define SPARSETOOLS_PRAGMA_OMP(x)
+#endif
+
+
+/*
+ * Number of threads to use when a kernel is passed n_threads <= 0
+ */
+inline int sparsetools_default_threads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+inline int sparsetools_thread_id()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+/*
+ * Resolve the requested thread count for a loop of n items.
+ */
+template <class I>
+I sparsetools_num_threads(const I n_threads, const I n)
+{
+    I t = n_threads > 0 ? n_threads : (I) sparsetools_default_threads();
+    return std::max((I) 1, std::min(t, n));
+}
+
+
+/*
+ * Split rows 0..n_row-1 of a compressed matrix into n_parts contiguous
+ * chunks of roughly equal cost, where a row costs one unit plus the
+ * number of entries in it.
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows (major axis length)
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  n_parts         - number of chunks
+ *
+ * Output Arguments:
+ *   I  bounds[n_parts+1] - chunk p is rows bounds[p] to bounds[p+1]-1
+ *
+ * Note:
+ *   Complexity: O(n_parts * log(n_row))
+ */
+template <class I>
+void balanced_row_partition(const I n_row,
+                            const I Ap[],
+                            const I n_parts,
+                                  I bounds[])
+{
+    const double total = (double)(Ap[n_row] - Ap[0]) + n_row;
+
+    bounds[0] = 0;
+    for(I p = 1; p < n_parts; p++){
+        const double target = total * p / n_parts;
+
+        // first row i such that (Ap[i] - Ap[0]) + i >= target
+        I lo = bounds[p-1], hi = n_row;
+        while(lo < hi){
+            I mid = lo + (hi - lo) / 2;
+            if((double)(Ap[mid] - Ap[0]) + mid < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        bounds[p] = lo;
+    }
+    bounds[n_parts] = n_row;
+}
+
+#endif
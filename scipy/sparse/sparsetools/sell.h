@@ -0,0 +1,246 @@
+#ifndef __SELL_H__
+#define __SELL_H__
+
+#include <vector>
+#include <algorithm>
+
+#include "dense.h"
+
+/*
+ * Sliced ELLPACK (SELL-C-sigma) format
+ *
+ * Rows are permuted (perm[k] is the row of A stored at position k) so
+ * that rows of similar length are neighbours, then cut into slices of
+ * C consecutive stored rows.  Each slice is padded to the length of its
+ * longest row and stored column-major: entry j of stored row k = s*C + r
+ * is at Bp[s] + j*C + r.  The last slice is padded with empty rows.
+ *
+ * Padding entries are explicit zeros whose column index repeats the
+ * last column of their row (0 for empty rows).  The products skip them
+ * using the row lengths, so inf or NaN entries of X cannot leak into
+ * rows that do not reference them.
+ */
+
+
+/*
+ * Compute B = A for CSR matrix A, SELL matrix B
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows in A
+ *   I  n_col           - number of columns in A
+ *   I  C               - slice height
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   T  Ax[nnz(A)]      - nonzeros
+ *   I  perm[n_row]     - row stored at each position
+ *   I  Bp[n_slice+1]   - slice pointer, C times the cumulative
+ *                        maximum row lengths of the slices
+ *
+ * Output Arguments:
+ *   I  Bj[Bp[n_slice]] - column indices
+ *   T  Bx[Bp[n_slice]] - nonzeros
+ *
+ * Note:
+ *   Output arrays Bj, Bx must be preallocated
+ *   n_slice = ceil(n_row / C)
+ *   Duplicate entries in A are not merged.
+ *
+ */
+template <class I, class T>
+void csr_tosell(const I n_row,
+	            const I n_col,
+                const I C,
+	            const I Ap[],
+	            const I Aj[],
+	            const T Ax[],
+	            const I perm[],
+	            const I Bp[],
+	                  I Bj[],
+	                  T Bx[])
+{
+    const I n_slice = (n_row + C - 1) / C;
+
+    for(I s = 0; s < n_slice; s++){
+        const I width = (Bp[s+1] - Bp[s]) / C;
+        for(I r = 0; r < C; r++){
+            const I k = C * s + r;
+            I * Bj_row = Bj + Bp[s] + r;
+            T * Bx_row = Bx + Bp[s] + r;
+
+            I j = 0, pad = 0;
+            if(k < n_row){
+                const I i = perm[k];
+                for(I jj = Ap[i]; jj < Ap[i+1]; jj++, j++){
+                    Bj_row[C * j] = pad = Aj[jj];
+                    Bx_row[C * j] = Ax[jj];
+                }
+            }
+            for(; j < width; j++){
+                Bj_row[C * j] = pad;
+                Bx_row[C * j] = 0;
+            }
+        }
+    }
+}
+
+
+/*
+ * Y += A*X for SELL matrix A with slice height C known at compile time.
+ *
+ * The loop over the rows of a slice is unit stride in Aj and Ax, so the
+ * compiler can vectorise it (with gathers from X where available).
+ */
+template <class I, class T, int C>
+void sell_matvec_fixed(const I n_row,
+	                   const I Ap[],
+	                   const I Aj[],
+	                   const T Ax[],
+	                   const I perm[],
+	                   const I lengths[],
+	                   const T Xx[],
+	                         T Yx[])
+{
+    const I n_slice = (n_row + C - 1) / C;
+
+    for(I s = 0; s < n_slice; s++){
+        const I rows = std::min((I) C, n_row - C * s);
+        T sums[C];
+        I lens[C];
+        for(int r = 0; r < C; r++){
+            sums[r] = 0;
+            lens[r] = (r < rows) ? lengths[C * s + r] : 0;
+        }
+        I j = 0;
+        for(I jj = Ap[s]; jj < Ap[s+1]; jj += C, j++){
+            const I * cols = Aj + jj;
+            const T * vals = Ax + jj;
+            for(int r = 0; r < C; r++){
+                if(j < lens[r]){
+                    sums[r] += vals[r] * Xx[cols[r]];
+                }
+            }
+        }
+        for(I r = 0; r < rows; r++){
+            Yx[perm[C * s + r]] += sums[r];
+        }
+    }
+}
+
+
+/*
+ * Compute Y += A*X for SELL matrix A and dense vectors X,Y
+ *
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows in A
+ *   I  n_col           - number of columns in A
+ *   I  C               - slice height
+ *   I  Ap[n_slice+1]   - slice pointer
+ *   I  Aj[Ap[n_slice]] - column indices
+ *   T  Ax[Ap[n_slice]] - nonzeros
+ *   I  perm[n_row]     - row stored at each position
+ *   I  lengths[n_row]  - number of entries of each stored row
+ *   T  Xx[n_col]       - input vector
+ *
+ * Output Arguments:
+ *   T  Yx[n_row]       - output vector
+ *
+ * Note:
+ *   Output array Yx must be preallocated
+ *   Slice heights 4, 8, 16 and 32 use unrolled kernels
+ *
+ *   Complexity: Linear.  Specifically O(Ap[n_slice] + n_row)
+ *
+ */
+template <class I, class T>
+void sell_matvec(const I n_row,
+	             const I n_col,
+                 const I C,
+	             const I Ap[],
+	             const I Aj[],
+	             const T Ax[],
+	             const I perm[],
+	             const I lengths[],
+	             const T Xx[],
+	                   T Yx[])
+{
+    switch(C){
+        case  4: sell_matvec_fixed<I,T, 4>(n_row, Ap, Aj, Ax, perm, lengths, Xx, Yx); return;
+        case  8: sell_matvec_fixed<I,T, 8>(n_row, Ap, Aj, Ax, perm, lengths, Xx, Yx); return;
+        case 16: sell_matvec_fixed<I,T,16>(n_row, Ap, Aj, Ax, perm, lengths, Xx, Yx); return;
+        case 32: sell_matvec_fixed<I,T,32>(n_row, Ap, Aj, Ax, perm, lengths, Xx, Yx); return;
+    }
+
+    const I n_slice = (n_row + C - 1) / C;
+    std::vector<T> sums(C);
+    std::vector<I> lens(C);
+
+    for(I s = 0; s < n_slice; s++){
+        const I rows = std::min(C, n_row - C * s);
+        std::fill(sums.begin(), sums.end(), 0);
+        std::fill(lens.begin(), lens.end(), 0);
+        std::copy(lengths + C * s, lengths + C * s + rows, lens.begin());
+        I j = 0;
+        for(I jj = Ap[s]; jj < Ap[s+1]; jj += C, j++){
+            for(I r = 0; r < C; r++){
+                if(j < lens[r]){
+                    sums[r] += Ax[jj + r] * Xx[Aj[jj + r]];
+                }
+            }
+        }
+        for(I r = 0; r < rows; r++){
+            Yx[perm[C * s + r]] += sums[r];
+        }
+    }
+}
+
+
+/*
+ * Compute Y += A*X for SELL matrix A and dense block vectors X,Y
+ *
+ *
+ * Input Arguments:
+ *   I  n_row            - number of rows in A
+ *   I  n_col            - number of columns in A
+ *   I  n_vecs           - number of column vectors in X and Y
+ *   I  C                - slice height
+ *   I  Ap[n_slice+1]    - slice pointer
+ *   I  Aj[Ap[n_slice]]  - column indices
+ *   T  Ax[Ap[n_slice]]  - nonzeros
+ *   I  perm[n_row]      - row stored at each position
+ *   I  lengths[n_row]   - number of entries of each stored row
+ *   T  Xx[n_col,n_vecs] - input vector
+ *
+ * Output Arguments:
+ *   T  Yx[n_row,n_vecs] - output vector
+ *
+ */
+template <class I, class T>
+void sell_matvecs(const I n_row,
+	              const I n_col,
+                  const I n_vecs,
+                  const I C,
+	              const I Ap[],
+	              const I Aj[],
+	              const T Ax[],
+	              const I perm[],
+	              const I lengths[],
+	              const T Xx[],
+	                    T Yx[])
+{
+    const I n_slice = (n_row + C - 1) / C;
+
+    for(I s = 0; s < n_slice; s++){
+        const I rows = std::min(C, n_row - C * s);
+        for(I r = 0; r < rows; r++){
+            const I k = C * s + r;
+            T * y = Yx + n_vecs * perm[k];
+            for(I j = 0; j < lengths[k]; j++){
+                const I jj = Ap[s] + C * j + r;
+                axpy(n_vecs, Ax[jj], Xx + n_vecs * Aj[jj], y);
+            }
+        }
+    }
+}
+
+#endif
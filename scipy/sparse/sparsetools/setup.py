@@ -4,13 +4,28 @@ def configuration(parent_package='',top_path=None):
     import numpy
     from numpy.distutils.misc_util import Configuration
 
+    import os
     config = Configuration('sparsetools',parent_package,top_path)
 
+    # The *_threads kernels run in parallel only when built with OpenMP,
+    # e.g. SPARSETOOLS_OPENMP=-fopenmp for gcc or /openmp for MSVC
+    openmp = os.environ.get('SPARSETOOLS_OPENMP', '').split()
+
     for fmt in ['csr','csc','coo','bsr','dia','csgraph']:
         sources = [ fmt + '_wrap.cxx' ]
-        depends = [ fmt + '.h' ]
+        depends = [ fmt + '.h', 'parallel.h' ]
+        if fmt == 'csr':
+            depends += ['sell.h', 'ilu.h', 'krylov.h', 'csc.h', 'bsr.h', 'dia.h']
+        if fmt in ['csr','bsr']:
+            depends.append('fixed_size.h')
+        if fmt in ['csr','csc']:
+            depends.append('triangular.h')
+        if fmt == 'coo':
+            depends.append('mmio.h')
         config.add_extension('_' + fmt, sources=sources,
             define_macros=[('__STDC_FORMAT_MACROS', 1)],
+            extra_compile_args=openmp,
+            extra_link_args=openmp,
             depends=depends)
 
     return config
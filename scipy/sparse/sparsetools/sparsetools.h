@@ -13,6 +13,7 @@
  *  coo.h - COOrdinate format
  *  bsr.h - Block Sparse Row format
  *  dia.h - DIAgonal format
+ *  sell.h - Sliced ELLpack format
  *
  */
 
@@ -21,5 +22,6 @@
 #include "coo.h"
 #include "bsr.h"
 #include "dia.h"
+#include "sell.h"
 
 #endif
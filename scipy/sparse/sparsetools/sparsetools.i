@@ -37,7 +37,11 @@
     const ctype Cp [ ],
     const ctype Ci [ ],	
     const ctype Cj [ ],
-    const ctype offsets [ ]
+    const ctype offsets [ ],
+    const ctype perm [ ],
+    const ctype lengths [ ],
+    const ctype rows [ ],
+    const ctype cols [ ]
 };
 %enddef
 
@@ -47,7 +51,8 @@
     const ctype Bx [ ],
     const ctype Cx [ ],
     const ctype Xx [ ],
-    const ctype Yx [ ]
+    const ctype Yx [ ],
+    const ctype text [ ]
 };
 %enddef
 
@@ -82,7 +87,8 @@
     std::vector<ctype>* Bx,
     std::vector<ctype>* Cx, 
     std::vector<ctype>* Xx,
-    std::vector<ctype>* Yx 
+    std::vector<ctype>* Yx,
+    std::vector<ctype>* text
 };
 %enddef
 
@@ -103,7 +109,12 @@
   ctype Cp [ ],
   ctype Ci [ ],
   ctype Cj [ ],
-  ctype flag [ ]
+  ctype flag [ ],
+  ctype labels [ ],
+  ctype order [ ],
+  ctype predecessors [ ],
+  ctype levels [ ],
+  ctype perm [ ]
 };
 %enddef
 
@@ -112,7 +123,9 @@
   ctype Ax [ ],
   ctype Bx [ ],
   ctype Cx [ ],
-  ctype Yx [ ]
+  ctype Yx [ ],
+  ctype dist [ ],
+  ctype work [ ]
 };
 %enddef
 
@@ -145,6 +158,7 @@ T_INPLACE_ARRAY2( ctype )
  * Create all desired index and data types here
  */
 DECLARE_INDEX_TYPE( int       )
+DECLARE_INDEX_TYPE( long long )
 
 DECLARE_DATA_TYPE( signed char             )
 DECLARE_DATA_TYPE( unsigned char           )
@@ -169,6 +183,10 @@ DECLARE_DATA_TYPE( npy_clongdouble_wrapper )
  /*
   * Order is important here, list int before float, float before 
   * double, scalar before complex, etc.
+  *
+  * 32-bit indices come first so that they are preferred when both
+  * match.  Python only uses 64-bit indices when the dimensions or nnz
+  * require them (see get_index_dtype in sputils.py).
   */
 
 %define INSTANTIATE_ALL( f_name )
@@ -187,13 +205,40 @@ DECLARE_DATA_TYPE( npy_clongdouble_wrapper )
 %template(f_name)   f_name<int,npy_cfloat_wrapper>;
 %template(f_name)   f_name<int,npy_cdouble_wrapper>;
 %template(f_name)   f_name<int,npy_clongdouble_wrapper>;
-/* 64-bit indices would go here */
+/* 64-bit indices */
+%template(f_name)   f_name<long long,signed char>;
+%template(f_name)   f_name<long long,unsigned char>;
+%template(f_name)   f_name<long long,short>;
+%template(f_name)   f_name<long long,unsigned short>;
+%template(f_name)   f_name<long long,int>;
+%template(f_name)   f_name<long long,unsigned int>;
+%template(f_name)   f_name<long long,long long>;
+%template(f_name)   f_name<long long,unsigned long long>;
+%template(f_name)   f_name<long long,float>;
+%template(f_name)   f_name<long long,double>;
+%template(f_name)   f_name<long long,long double>;
+%template(f_name)   f_name<long long,npy_cfloat_wrapper>;
+%template(f_name)   f_name<long long,npy_cdouble_wrapper>;
+%template(f_name)   f_name<long long,npy_clongdouble_wrapper>;
+%enddef
+
+
+%define INSTANTIATE_REAL( f_name )
+/* 32-bit indices */
+%template(f_name)   f_name<int,float>;
+%template(f_name)   f_name<int,double>;
+%template(f_name)   f_name<int,long double>;
+/* 64-bit indices */
+%template(f_name)   f_name<long long,float>;
+%template(f_name)   f_name<long long,double>;
+%template(f_name)   f_name<long long,long double>;
 %enddef
 
 
 %define INSTANTIATE_INDEX( f_name )
 /* 32-bit indices */
 %template(f_name)   f_name<int>;
-/* 64-bit indices would go here */
+/* 64-bit indices */
+%template(f_name)   f_name<long long>;
 %enddef
 
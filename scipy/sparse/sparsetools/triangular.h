@@ -0,0 +1,290 @@
+#ifndef __TRIANGULAR_H__
+#define __TRIANGULAR_H__
+
+#include <vector>
+#include <algorithm>
+
+#include "dense.h"
+#include "parallel.h"
+
+/*
+ * Sparse triangular solves
+ *
+ * The solves use only the lower (or upper) triangle of the matrix,
+ * including the diagonal unless the diagonal is taken to be one, and
+ * ignore all other entries.  This lets L and U of an incomplete
+ * factorization share one CSR matrix.  Duplicate entries are summed.
+ *
+ * Rows can be solved in parallel once every row they depend on is
+ * solved.  csr_triangular_levels groups the rows into level sets for
+ * this, and csr_triangular_solve_levels solves one level at a time.
+ */
+
+
+/*
+ * Row i of a triangular solve on the rows of Y.  Subtracts the
+ * off-diagonal products of row i of A from row i of Y and divides by
+ * the diagonal.
+ *
+ * Returns false if the diagonal entry is zero or missing.
+ */
+template <class I, class T>
+bool csr_triangular_solve_row(const I i,
+                              const I n_vecs,
+                              const I Ap[],
+                              const I Aj[],
+                              const T Ax[],
+                              const bool lower,
+                              const bool unit_diagonal,
+                                    T Yx[])
+{
+    T * y = Yx + n_vecs * i;
+    T diag = 0;
+
+    for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+        const I j = Aj[jj];
+        if(j == i){
+            diag += Ax[jj];
+        } else if((j < i) == lower){
+            axpy(n_vecs, (T) -Ax[jj], Yx + n_vecs * j, y);
+        }
+    }
+
+    if(!unit_diagonal){
+        if(diag == 0){
+            return false;
+        }
+        for(I v = 0; v < n_vecs; v++){
+            y[v] /= diag;
+        }
+    }
+    return true;
+}
+
+
+/*
+ * Solve A*X = B or A.T*X = B for a triangular CSR matrix A
+ *
+ * Input Arguments:
+ *   I  n_row               - dimension of A
+ *   I  n_vecs              - number of column vectors in X and B
+ *   I  Ap[n_row+1]         - row pointer
+ *   I  Aj[nnz(A)]          - column indices
+ *   T  Ax[nnz(A)]          - nonzeros
+ *   I  lower               - use the lower (1) or upper (0) triangle of A
+ *   I  unit_diagonal       - take the diagonal of A to be one
+ *   I  trans               - solve with A.T (not conjugated) instead of A
+ *
+ * Input/Output Arguments:
+ *   T  Yx[n_row,n_vecs]    - B on entry, X on return
+ *
+ * Return Value:
+ *   -1 on success, otherwise a row whose diagonal entry is zero or
+ *   missing (Yx is then left partially solved)
+ *
+ * Note:
+ *   The solve with A.T runs over the rows of A and scatters each
+ *   solved row, so no transpose is formed.
+ *
+ *   Complexity: O(n_vecs * (nnz(A) + n_row))
+ *
+ */
+template <class I, class T>
+I csr_triangular_solve(const I n_row,
+                       const I n_vecs,
+                       const I Ap[],
+                       const I Aj[],
+                       const T Ax[],
+                       const I lower,
+                       const I unit_diagonal,
+                       const I trans,
+                             T Yx[])
+{
+    if(!trans){
+        for(I n = 0; n < n_row; n++){
+            const I i = lower ? n : n_row - 1 - n;
+            if(!csr_triangular_solve_row(i, n_vecs, Ap, Aj, Ax, (bool) lower,
+                                         (bool) unit_diagonal, Yx)){
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // A.T is upper triangular when A is lower triangular
+    for(I n = 0; n < n_row; n++){
+        const I i = lower ? n_row - 1 - n : n;
+        T * y = Yx + n_vecs * i;
+
+        if(!unit_diagonal){
+            T diag = 0;
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                if(Aj[jj] == i){
+                    diag += Ax[jj];
+                }
+            }
+            if(diag == 0){
+                return i;
+            }
+            for(I v = 0; v < n_vecs; v++){
+                y[v] /= diag;
+            }
+        }
+
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            const I j = Aj[jj];
+            if(j != i && (j < i) == (bool) lower){
+                axpy(n_vecs, (T) -Ax[jj], y, Yx + n_vecs * j);
+            }
+        }
+    }
+    return -1;
+}
+
+
+/*
+ * Level sets of the rows of a triangular CSR matrix A
+ *
+ * Input Arguments:
+ *   I  n_row               - dimension of A
+ *   I  Ap[n_row+1]         - row pointer
+ *   I  Aj[nnz(A)]          - column indices
+ *   I  lower               - use the lower (1) or upper (0) triangle of A
+ *
+ * Output Arguments:
+ *   vec<I> Bp              - level pointer, Bp[n_levels] == n_row
+ *   vec<I> Bj              - rows of level l are Bj[Bp[l]:Bp[l+1]]
+ *
+ * Note:
+ *   Output arrays Bp and Bj will be allocated within in the method
+ *   Level 0 holds the rows that depend on no other row, and a row is one
+ *   level above the highest row it depends on.  Rows of a level are in
+ *   increasing order.
+ *
+ *   Complexity: O(nnz(A) + n_row)
+ *
+ */
+template <class I>
+void csr_triangular_levels(const I n_row,
+                           const I Ap[],
+                           const I Aj[],
+                           const I lower,
+                           std::vector<I>* Bp,
+                           std::vector<I>* Bj)
+{
+    std::vector<I> level(n_row, 0);
+    I n_levels = 0;
+
+    for(I n = 0; n < n_row; n++){
+        const I i = lower ? n : n_row - 1 - n;
+        I l = 0;
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            const I j = Aj[jj];
+            if(j != i && (j < i) == (bool) lower){
+                l = std::max(l, level[j] + 1);
+            }
+        }
+        level[i] = l;
+        n_levels = std::max(n_levels, l + 1);
+    }
+
+    // counting sort of the rows by level
+    Bp->assign(n_levels + 1, 0);
+    Bj->resize(n_row);
+    I * bp = &(*Bp)[0];
+    for(I i = 0; i < n_row; i++){
+        bp[level[i] + 1]++;
+    }
+    for(I l = 0; l < n_levels; l++){
+        bp[l+1] += bp[l];
+    }
+    if(n_row == 0) return;
+
+    std::vector<I> next(bp, bp + n_levels);
+    I * bj = &(*Bj)[0];
+    for(I i = 0; i < n_row; i++){
+        bj[next[level[i]]++] = i;
+    }
+}
+
+
+/*
+ * Solve A*X = B for a triangular CSR matrix A using its level sets
+ *
+ * Input Arguments:
+ *   I  n_row               - dimension of A
+ *   I  n_vecs              - number of column vectors in X and B
+ *   I  Ap[n_row+1]         - row pointer
+ *   I  Aj[nnz(A)]          - column indices
+ *   T  Ax[nnz(A)]          - nonzeros
+ *   I  lower               - use the lower (1) or upper (0) triangle of A
+ *   I  unit_diagonal       - take the diagonal of A to be one
+ *   I  n_levels            - number of level sets
+ *   I  Bp[n_levels+1]      - level pointer from csr_triangular_levels
+ *   I  Bj[n_row]           - rows by level from csr_triangular_levels
+ *   I  n_threads           - number of threads (<= 0 means the default)
+ *
+ * Input/Output Arguments:
+ *   T  Yx[n_row,n_vecs]    - B on entry, X on return
+ *
+ * Return Value:
+ *   -1 on success, otherwise the smallest row of the first failing
+ *   level whose diagonal entry is zero or missing
+ *
+ * Note:
+ *   The rows of a level are split over the threads.  Levels too small
+ *   to be worth splitting are solved by one thread.  Every row is
+ *   computed the same way as in csr_triangular_solve, so the result does
+ *   not depend on the thread count.  Solves with A.T use the levels of
+ *   the transpose of A, in CSR format.
+ *
+ *   Complexity: O(n_vecs * (nnz(A) + n_row))
+ *
+ */
+template <class I, class T>
+I csr_triangular_solve_levels(const I n_row,
+                              const I n_vecs,
+                              const I Ap[],
+                              const I Aj[],
+                              const T Ax[],
+                              const I lower,
+                              const I unit_diagonal,
+                              const I n_levels,
+                              const I Bp[],
+                              const I Bj[],
+                                    T Yx[],
+                              const I n_threads)
+{
+    // rows per thread below which a level is not split
+    const I min_rows = 64;
+
+    for(I l = 0; l < n_levels; l++){
+        const I start = Bp[l];
+        const I size  = Bp[l+1] - start;
+        const I t = sparsetools_num_threads(n_threads, size / min_rows);
+
+        std::vector<I> failed(t, n_row);
+
+        SPARSETOOLS_PRAGMA_OMP(parallel for num_threads(t) schedule(static,1))
+        for(I p = 0; p < t; p++){
+            const I begin = start + (I)(((double) size * p) / t);
+            const I end   = start + (I)(((double) size * (p + 1)) / t);
+            for(I n = begin; n < end; n++){
+                const I i = Bj[n];
+                if(!csr_triangular_solve_row(i, n_vecs, Ap, Aj, Ax,
+                                             (bool) lower,
+                                             (bool) unit_diagonal, Yx)){
+                    failed[p] = std::min(failed[p], i);
+                }
+            }
+        }
+
+        const I i = *std::min_element(failed.begin(), failed.end());
+        if(i < n_row){
+            return i;
+        }
+    }
+    return -1;
+}
+
+#endif
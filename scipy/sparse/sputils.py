@@ -1,7 +1,7 @@
 """ Utility functions for sparse matrix module
 """
 
-__all__ = ['upcast','getdtype','isscalarlike','isintlike',
+__all__ = ['upcast','getdtype','get_index_dtype','isscalarlike','isintlike',
             'isshape','issequence','isdense']
 
 import numpy as np
@@ -47,6 +47,27 @@ def upcast(*args):
     raise TypeError('no supported conversion for types: %s' % args)
 
 
+def get_index_dtype(maxval=None):
+    """Returns the index dtype used by sparsetools for a matrix whose
+    indices and index pointers are at most maxval.
+
+    32-bit indices are used whenever they suffice, since they halve the
+    memory traffic of the index arrays.
+
+    Examples
+    --------
+
+    >>> get_index_dtype(1000)
+    <type 'numpy.int32'>
+    >>> get_index_dtype(2**40)
+    <type 'numpy.int64'>
+
+    """
+    if maxval is not None and maxval > np.iinfo(np.intc).max:
+        return np.int64
+    return np.intc
+
+
 def to_native(A):
     return np.asarray(A,dtype=A.dtype.newbyteorder('native'))
 
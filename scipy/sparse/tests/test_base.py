@@ -27,7 +27,7 @@ from numpy.testing import assert_raises, assert_equal, assert_array_equal, \
 
 import scipy.sparse as sparse
 from scipy.sparse import csc_matrix, csr_matrix, dok_matrix, \
-        coo_matrix, lil_matrix, dia_matrix, bsr_matrix, \
+        coo_matrix, lil_matrix, dia_matrix, bsr_matrix, sell_matrix, \
         eye, isspmatrix, SparseEfficiencyWarning
 from scipy.sparse.sputils import supported_dtypes
 from scipy.sparse.linalg import splu
@@ -1086,6 +1086,56 @@ class TestCSR(_TestCommon, _TestGetSet, _TestSolve,
         bsp = csr_matrix( (data, indices, indptr), shape=(2,10) )
         assert_equal((asp + bsp).todense(), asp.todense() + bsp.todense())
 
+    def test_fancy_indexing_boolean(self):
+        B = asmatrix(arange(50).reshape(5,10))
+        A = csr_matrix(B)
+        I = array([True,False,True,True,False])
+        J = B.A[0] % 3 == 0
+        assert_equal(A[I].todense(),     B[I.nonzero()[0]])
+        assert_equal(A[I,:].todense(),   B[I.nonzero()[0],:])
+        assert_equal(A[:,J].todense(),   B[:,J.nonzero()[0]])
+        assert_equal(A[1:3,J].todense(), B[1:3,J.nonzero()[0]])
+        assert_equal(A[I,arange(10) < 3], B[I.nonzero()[0],[0,1,2]])
+        assert_raises(IndexError, A.__getitem__, (I[:4],slice(None)))
+
+    def test_matmat_empty(self):
+        # operands without stored entries, zero-sized dimensions are
+        # rejected by the constructor
+        for M, K, N in [(3,1,4), (1,3,4), (3,4,1), (1,1,1)]:
+            A = csr_matrix((M,K))
+            B = csr_matrix((K,N))
+            C = A * B
+            assert_equal(C.format, 'csr')
+            assert_equal(C.shape, (M,N))
+            assert_equal(C.nnz, 0)
+        assert_raises(ValueError, csr_matrix, (3,0))
+
+    def test_sample_values(self):
+        # unsorted rows with duplicates, few and many samples per row
+        np.random.seed(0)
+        M, N = 20, 500
+        row = np.random.randint(0, M, 3000)
+        col = np.random.randint(0, N, 3000)
+        data = np.random.rand(3000)
+        D = coo_matrix((data,(row,col)), shape=(M,N)).todense()
+        for order in [np.argsort(row, kind='mergesort'),   # unsorted rows
+                      np.lexsort((col,row))]:              # sorted rows
+            indptr = np.searchsorted(row[order], np.arange(M + 1))
+            A = csr_matrix((data[order], col[order], indptr), shape=(M,N))
+            for n in [1, 5, 100, 50000]:
+                I = np.random.randint(-M, M, n)
+                J = np.random.randint(-N, N, n)
+                assert_array_almost_equal(A[I,J], D[I,J])
+
+    def test_symmetric_permute(self):
+        D = array([[1,2,0,0],[0,3,0,4],[5,0,6,0],[0,7,0,8]])
+        perm = [2,0,3,1]
+        A = csr_matrix(D).symmetric_permute(perm)
+        assert_equal(A.format, 'csr')
+        assert_equal(A.has_sorted_indices, True)
+        assert_array_equal(A.todense(), D[perm][:,perm])
+        assert_raises(ValueError, csr_matrix(D).symmetric_permute, [0,1,1,2])
+
 
 
 
@@ -1176,6 +1226,36 @@ class TestCSC(_TestCommon, _TestGetSet, _TestSolve,
         bsp = csc_matrix( (data, indices, indptr), shape=(10,2) )
         assert_equal((asp + bsp).todense(), asp.todense() + bsp.todense())
 
+    def test_fancy_indexing_boolean(self):
+        B = asmatrix(arange(50).reshape(5,10))
+        A = csc_matrix(B)
+        I = array([True,False,True,True,False])
+        J = B.A[0] % 3 == 0
+        assert_equal(A[I,:].todense(), B[I.nonzero()[0],:])
+        assert_equal(A[:,J].todense(), B[:,J.nonzero()[0]])
+        assert_equal(A[I,arange(10) < 3], B[I.nonzero()[0],[0,1,2]])
+
+    def test_matmat_empty(self):
+        # operands without stored entries, zero-sized dimensions are
+        # rejected by the constructor
+        for M, K, N in [(3,1,4), (1,3,4), (3,4,1), (1,1,1)]:
+            A = csc_matrix((M,K))
+            B = csc_matrix((K,N))
+            C = A * B
+            assert_equal(C.format, 'csc')
+            assert_equal(C.shape, (M,N))
+            assert_equal(C.nnz, 0)
+        assert_raises(ValueError, csc_matrix, (3,0))
+
+    def test_symmetric_permute(self):
+        D = array([[1,2,0,0],[0,3,0,4],[5,0,6,0],[0,7,0,8]])
+        perm = [2,0,3,1]
+        A = csc_matrix(D).symmetric_permute(perm)
+        assert_equal(A.format, 'csc')
+        assert_equal(A.has_sorted_indices, True)
+        assert_array_equal(A.todense(), D[perm][:,perm])
+        assert_raises(ValueError, csc_matrix(D).symmetric_permute, [0,1,1,2])
+
 class TestDOK(_TestCommon, _TestGetSet, _TestSolve, TestCase):
     spmatrix = dok_matrix
 
@@ -1636,5 +1716,67 @@ class TestBSR(_TestCommon, _TestArithmetic, _TestInplaceArithmetic, TestCase):
         assert_equal(A*x, A.todense()*x)
 
 
+class TestSELL(_TestCommon, TestCase):
+    spmatrix = sell_matrix
+
+    def test_constructor1(self):
+        # rows 2 and 1 are stored in slice 0, row 0 and padding in slice 1
+        data        = array([4, 2, 5, 3, 6, 0, 1, 0])
+        indices     = array([0, 1, 1, 2, 2, 2, 0, 0])
+        slice_ptr   = array([0, 6, 8])
+        perm        = array([2, 1, 0])
+        row_lengths = array([3, 2, 1])
+        A = sell_matrix((data, indices, slice_ptr, perm, row_lengths),
+                        shape=(3,3), slice_height=2)
+        D = matrix([[1,0,0],[0,2,3],[4,5,6]])
+        assert_equal(A.todense(), D)
+        assert_equal(A.nnz, 6)
+        assert_equal(sell_matrix(D, slice_height=2).slice_ptr, slice_ptr)
+        assert_equal(sell_matrix(D, slice_height=2).perm, perm)
+
+    def test_sell_matvec(self):
+        np.random.seed(1234)
+        D = np.random.rand(70, 50) * (np.random.rand(70, 50) < 0.1)
+        D[5] = 1
+        x = np.random.rand(50)
+        X = np.random.rand(50, 3)
+        for C in [1, 3, 4, 8, 16, 32]:
+            for sigma in [1, 4, 256]:
+                A = sell_matrix(D, slice_height=C, sigma=sigma)
+                assert_equal(A.todense(), D)
+                assert_array_almost_equal(A*x, dot(D, x))
+                assert_array_almost_equal(A*X, dot(D, X))
+
+    def test_padding(self):
+        # padding of the empty row 0 points at column 0, which is never read
+        D = array([[0, 0], [1, 1], [0, 2]], dtype=float)
+        x = array([np.inf, 1])
+        X = array([[np.nan, np.inf], [1, 2]])
+        for C in [2, 3, 4]:
+            A = sell_matrix(D, slice_height=C)
+            assert_equal(A*x, [0, np.inf, 2])
+            assert_equal(A*X, [[0, 0], [np.nan, np.inf], [2, 4]])
+
+    def test_resort(self):
+        D = array([[1,0,0,0],[1,1,0,0],[1,1,1,0],[1,1,1,1]])
+        A = sell_matrix(D, slice_height=2, sigma=1)
+        assert_equal(A.sigma, 1)
+        assert_equal(A.perm, [0,1,2,3])
+        for B in [sell_matrix(A, sigma=4), A.tosell(sigma=4)]:
+            assert_equal(B.sigma, 4)
+            assert_equal(B.slice_height, 2)
+            assert_equal(B.perm, [3,2,1,0])
+            assert_equal(B.todense(), D)
+        assert_(sell_matrix(A, sigma=1).perm is A.perm)
+        assert_(A.tosell(sigma=1) is A)
+        assert_equal(A.copy().sigma, 1)
+
+    def test_linear_operator(self):
+        from scipy.sparse.linalg import aslinearoperator
+        D = array([[4,1,0],[1,4,1],[0,1,4]], dtype='d')
+        A = aslinearoperator(sell_matrix(D))
+        assert_array_almost_equal(A.matvec([1,2,3]), dot(D, [1,2,3]))
+
+
 if __name__ == "__main__":
     run_module_suite()
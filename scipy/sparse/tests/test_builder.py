@@ -0,0 +1,71 @@
+"""test incremental sparse matrix assembly"""
+
+import numpy as np
+from numpy.testing import TestCase, run_module_suite, assert_equal, \
+        assert_array_almost_equal, assert_raises
+
+from scipy.sparse import csr_builder, csr_matrix
+
+
+class TestCSRBuilder(TestCase):
+    def test_add(self):
+        B = csr_builder((3,4))
+        B.add([0,1,2,0], [0,1,3,0], 1.0)
+        B.add(2, [0,1], [5.0,6.0])
+        B.add(-1, -1, 2.0)
+        assert_equal(B.tocsr().todense(), [[2,0,0,0],
+                                           [0,1,0,0],
+                                           [5,6,0,3]])
+        assert_equal(B.nnz, 5)
+
+    def test_random(self):
+        np.random.seed(1234)
+        M, N = 50, 40
+        B = csr_builder((M,N))
+        D = np.zeros((M,N))
+        for step in range(5):
+            i = np.random.randint(0, M, 3000)
+            j = np.random.randint(0, N, 3000)
+            v = np.random.rand(3000)
+            B.add(i, j, v)
+            for ii, jj, vv in zip(i, j, v):
+                D[ii,jj] += vv
+        A = B.tocsr()
+        assert_equal(A.has_sorted_indices, True)
+        assert_array_almost_equal(A.todense(), D)
+        assert_equal(A.nnz, (D != 0).sum())
+
+    def test_reassemble(self):
+        # same pattern each step: values go straight into the pattern
+        i = np.array([0,0,1,2,2,2])
+        j = np.array([0,1,1,0,2,2])
+        B = csr_builder((3,3))
+        B.add(i, j, 1.0)
+        B.zero()
+        B.add(i, j, 2.0)
+        assert_equal(B._n_pending, 0)
+        A = B.tocsr(copy=False)
+        assert_equal(A.todense(), [[2,2,0],[0,2,0],[2,0,4]])
+
+    def test_from_matrix(self):
+        S = csr_matrix([[1,0,2],[0,0,3]])
+        B = csr_builder(S)
+        B.add([0,1], [0,0], [10,20])
+        assert_equal(B.tocsr().todense(), [[11,0,2],[20,0,3]])
+        assert_equal(B.dtype, S.dtype)
+
+        # duplicates are summed in the builder, not in S
+        S = csr_matrix((np.array([1,2,3]), np.array([2,0,2]),
+                        np.array([0,3,3])), shape=(2,3))
+        B = csr_builder(S)
+        assert_equal(S.indices, [2,0,2])
+        assert_equal(S.data, [1,2,3])
+        assert_equal(B.tocsr().todense(), [[2,0,4],[0,0,0]])
+
+    def test_bounds(self):
+        B = csr_builder((3,3))
+        assert_raises(IndexError, B.add, 3, 0, 1.0)
+        assert_raises(IndexError, B.add, 0, -4, 1.0)
+
+if __name__ == "__main__":
+    run_module_suite()
@@ -113,6 +113,24 @@ class TestConstructUtils(TestCase):
                 expected = np.kron(a,b)
                 assert_array_equal(result,expected)
 
+    def test_kron_formats(self):
+        a = array([[0,2,-6],[8,0,14]])
+        b = array([[5,4],[0,0],[6,0]])
+        expected = np.kron(a,b)
+
+        for fmt in sparse_formats:
+            result = construct.kron(coo_matrix(a), coo_matrix(b), format=fmt)
+            assert_equal(result.format, fmt)
+            assert_array_equal(result.todense(), expected)
+
+        # operands with unsorted indices
+        A = csr_matrix((array([2,-6,8,14]), array([2,1,2,0]),
+                        array([0,2,4])), shape=(2,3))
+        B = csr_matrix((array([4,5,6]), array([1,0,0]),
+                        array([0,2,2,3])), shape=(3,2))
+        assert_array_equal(construct.kron(A,B,format='csr').todense(),
+                           np.kron(A.todense(), B.todense()))
+
     def test_kronsum(self):
         cases = []
 
@@ -132,6 +150,14 @@ class TestConstructUtils(TestCase):
                         np.kron(b, np.eye(len(a)))
                 assert_array_equal(result,expected)
 
+        a = array([[0,2,-6],[8,0,14],[0,3,0]])
+        b = array([[1,2],[3,4]])
+        expected = np.kron(np.eye(2), a) + np.kron(b, np.eye(3))
+        for fmt in sparse_formats:
+            result = construct.kronsum(csr_matrix(a), csr_matrix(b), format=fmt)
+            assert_equal(result.format, fmt)
+            assert_array_equal(result.todense(), expected)
+
     def test_vstack(self):
 
         A = coo_matrix([[1,2],[3,4]])
@@ -173,7 +199,29 @@ class TestConstructUtils(TestCase):
                            [7, 0]])
         assert_equal( construct.bmat( [[None,B],[C,None]] ).todense(), expected )
 
-        #TODO test failure cases
+        for fmt in sparse_formats:
+            result = construct.bmat( [[A,B],[None,C]], format=fmt )
+            assert_equal( result.format, fmt )
+            assert_equal( result.todense(), matrix([[1, 2, 5],
+                                                    [3, 4, 6],
+                                                    [0, 0, 7]]) )
+
+        result = construct.bmat( [[A,B],[None,C]], dtype=np.float32 )
+        assert_equal( result.dtype, np.float32 )
+
+        # blocks with unsorted indices
+        D = csr_matrix((array([1,2,3]), array([1,0,0]), array([0,2,3])),
+                       shape=(2,2))
+        expected = matrix([[2, 1, 5],
+                           [3, 0, 6],
+                           [0, 0, 7]])
+        assert_equal( construct.bmat( [[D,B],[None,C]] ).todense(), expected )
+        assert_equal( construct.bmat( [[D,B],[None,C]],
+                                      format='csc' ).todense(), expected )
+
+        assert_raises(ValueError, construct.bmat, [[A,C]])
+        assert_raises(ValueError, construct.bmat, [[A],[B]])
+        assert_raises(ValueError, construct.bmat, [[A,None],[None,None]])
 
     def test_rand(self):
         # Simple sanity checks for sparse.rand
@@ -0,0 +1,162 @@
+"""test graph algorithms on compressed sparse graphs"""
+
+import numpy as np
+from numpy.testing import TestCase, run_module_suite, assert_equal, \
+        assert_array_almost_equal, assert_raises
+
+from scipy.sparse import csr_matrix, csc_matrix, cs_graph_components, \
+        cs_graph_connected_components, cs_graph_breadth_first_order, \
+        cs_graph_depth_first_order, cs_graph_shortest_path, \
+        cs_graph_reverse_cuthill_mckee, cs_graph_nested_dissection
+
+
+def _path_graph(n):
+    """directed path 0 -> 1 -> ... -> n-1"""
+    row = np.arange(n - 1)
+    return csr_matrix((np.ones(n - 1), (row, row + 1)), shape=(n,n))
+
+def _shuffled_grid(nx, ny):
+    """5-point stencil on an nx by ny grid with randomly numbered nodes"""
+    from scipy.sparse import kron, eye, spdiags
+    def path(n):
+        e = np.ones(n)
+        return spdiags([e, e], [-1, 1], n, n)
+    A = (kron(path(nx), eye(ny,ny)) + kron(eye(nx,nx), path(ny))).tocsr()
+    A = A + csr_matrix(np.eye(nx * ny))
+    return A.symmetric_permute(np.random.permutation(nx * ny))
+
+def _bandwidth(A):
+    A = A.tocoo()
+    return abs(A.row - A.col).max()
+
+def _is_permutation(perm, n):
+    return (np.sort(perm) == np.arange(n)).all()
+
+
+class TestComponents(TestCase):
+    def test_weak(self):
+        D = np.zeros((5,5))
+        D[0,1] = D[1,2] = D[4,3] = 1
+        for fmt in [csr_matrix, csc_matrix, np.asarray]:
+            n_comp, labels = cs_graph_connected_components(fmt(D))
+            assert_equal(n_comp, 2)
+            assert_equal(labels, [0,0,0,1,1])
+
+    def test_strong(self):
+        D = np.zeros((5,5))
+        D[0,1] = D[1,2] = D[2,1] = D[3,4] = D[4,3] = 1
+        D[2,3] = 1
+        n_comp, labels = cs_graph_connected_components(D, connection='strong')
+        assert_equal(n_comp, 3)
+        assert_equal(labels, [2,1,1,0,0])
+        assert_raises(ValueError, cs_graph_connected_components, D, 'medium')
+
+    def test_legacy_agrees(self):
+        np.random.seed(1234)
+        A = csr_matrix(np.random.rand(60,60) > 0.97)
+        A = A + A.T + csr_matrix(np.eye(60))
+        n_old, old = cs_graph_components(A)
+        n_new, new = cs_graph_connected_components(A)
+        assert_equal(n_old, n_new)
+        assert_equal(old, new)
+
+    def test_long_path(self):
+        # traversals must not recurse
+        A = _path_graph(100000)
+        assert_equal(cs_graph_connected_components(A)[0], 1)
+        assert_equal(cs_graph_connected_components(A, 'strong')[0], 100000)
+
+
+class TestTraversal(TestCase):
+    def test_orders(self):
+        D = np.array([[0,1,1,0],[0,0,0,1],[0,0,0,0],[0,0,0,0]])
+        order, pred = cs_graph_breadth_first_order(D, 0)
+        assert_equal(order, [0,1,2,3])
+        assert_equal(pred, [-1,0,0,1])
+
+        order, pred = cs_graph_depth_first_order(D, 0)
+        assert_equal(order, [0,1,3,2])
+        assert_equal(pred, [-1,0,0,1])
+
+        order, pred = cs_graph_breadth_first_order(D, 1)
+        assert_equal(order, [1,3])
+        assert_equal(pred, [-1,-1,-1,1])
+
+    def test_long_path(self):
+        A = _path_graph(100000)
+        order, pred = cs_graph_depth_first_order(A, 0)
+        assert_equal(order, np.arange(100000))
+        assert_equal(pred[1:], np.arange(99999))
+
+    def test_bad_node(self):
+        D = np.eye(3)
+        assert_raises(ValueError, cs_graph_breadth_first_order, D, 3)
+        assert_raises(ValueError, cs_graph_depth_first_order, np.ones((2,3)), 0)
+
+
+class TestOrdering(TestCase):
+    def test_rcm(self):
+        np.random.seed(0)
+        A = _shuffled_grid(20, 30)
+        perm = cs_graph_reverse_cuthill_mckee(A, symmetric_mode=True)
+        assert_equal(_is_permutation(perm, 600), True)
+        assert_equal(_bandwidth(A.symmetric_permute(perm)) <= 25, True)
+
+    def test_rcm_unsymmetric(self):
+        # structure of x + x.T: a path 0 - 3 - 1 - 2
+        D = np.zeros((4,4))
+        D[0,3] = D[1,3] = D[1,2] = 1
+        perm = cs_graph_reverse_cuthill_mckee(D)
+        assert_equal(perm, [0,3,1,2])
+
+    def test_disconnected(self):
+        D = np.eye(5)
+        D[0,4] = D[4,0] = 1
+        for order in [cs_graph_reverse_cuthill_mckee,
+                      cs_graph_nested_dissection]:
+            assert_equal(_is_permutation(order(D), 5), True)
+            assert_equal(_is_permutation(order(np.zeros((1,1))), 1), True)
+
+    def test_nested_dissection(self):
+        np.random.seed(0)
+        A = _shuffled_grid(40, 40)
+        perm = cs_graph_nested_dissection(A)
+        assert_equal(_is_permutation(perm, 1600), True)
+
+        # the last nodes form a separator: removing them splits the grid
+        B = A.symmetric_permute(perm).tocsr()
+        n_comp, labels = cs_graph_connected_components(B[:1560,:1560])
+        assert_equal(n_comp > 1, True)
+
+
+class TestShortestPath(TestCase):
+    def test_weighted(self):
+        D = np.array([[0,4,1,0,0],[0,0,0,1,0],[0,2,0,0,0],[0,0,0,0,0],
+                      [1,0,0,0,0]])
+        dist, pred = cs_graph_shortest_path(D, 0)
+        assert_array_almost_equal(dist, [0,3,1,4,np.inf])
+        assert_equal(pred, [-1,2,0,1,-1])
+
+        dist, pred = cs_graph_shortest_path(D, 0, unweighted=True)
+        assert_array_almost_equal(dist, [0,1,1,2,np.inf])
+        assert_equal(pred, [-1,0,0,1,-1])
+
+    def test_random(self):
+        # compare with Floyd-Warshall on dense matrices
+        np.random.seed(0)
+        n = 30
+        W = np.random.rand(n,n) * (np.random.rand(n,n) > 0.85)
+        F = np.where(W > 0, W, np.inf)
+        np.fill_diagonal(F, 0)
+        for k in range(n):
+            F = np.minimum(F, F[:,k:k+1] + F[k:k+1,:])
+        for i in [0, 7, 29]:
+            dist, pred = cs_graph_shortest_path(csr_matrix(W), i)
+            assert_array_almost_equal(dist, F[i])
+
+    def test_negative(self):
+        D = np.array([[0,-1],[1,0]])
+        assert_raises(ValueError, cs_graph_shortest_path, D, 0)
+
+if __name__ == "__main__":
+    run_module_suite()
@@ -0,0 +1,73 @@
+"""test lazy evaluation of sparse matrix expressions"""
+
+import numpy as np
+from numpy.testing import TestCase, run_module_suite, assert_equal, \
+        assert_array_almost_equal, assert_raises
+
+from scipy.sparse import csr_expression, csr_matrix, csc_matrix
+
+
+def _random(M, N, density, seed):
+    np.random.seed(seed)
+    D = np.random.rand(M, N) * (np.random.rand(M, N) < density)
+    return csr_matrix(D)
+
+
+class TestCSRExpression(TestCase):
+    def test_linear_combination(self):
+        A = _random(30, 40, 0.2, 0)
+        B = _random(30, 40, 0.1, 1)
+        C = _random(30, 40, 0.3, 2)
+        E = csr_expression(A) + 2.5*csr_expression(B) - C
+        assert_equal(len(E._terms), 3)
+        X = E.tocsr()
+        assert_array_almost_equal(X.todense(),
+                (A + 2.5*B - C).todense())
+        assert_equal(X.has_sorted_indices, True)
+
+        X = (-csr_expression(A) / 2 + 0).tocsr()
+        assert_array_almost_equal(X.todense(), -A.todense() / 2)
+
+    def test_multiply(self):
+        A = _random(20, 20, 0.3, 3)
+        B = csc_matrix(_random(20, 20, 0.3, 4))
+        C = _random(20, 20, 0.5, 5)
+        E = (csr_expression(A) + 3*csr_expression(B)).multiply(C)
+        assert_array_almost_equal(E.tocsr().todense(),
+                (A + 3*B).multiply(C).todense())
+
+        # a product followed by a sum
+        F = E - A
+        assert_array_almost_equal(F.tocsr().todense(),
+                ((A + 3*B).multiply(C) - A).todense())
+
+    def test_cancellation(self):
+        # exact zeros are not stored
+        A = _random(10, 10, 0.5, 6)
+        X = (csr_expression(A) - A).tocsr()
+        assert_equal(X.nnz, 0)
+
+    def test_unsorted_duplicates(self):
+        data = np.array([1.0,2.0,3.0,4.0,5.0])
+        col  = np.array([2,0,2,1,1])
+        A = csr_matrix((data, col, [0,3,5]), shape=(2,3))
+        X = (csr_expression(A) + A).tocsr()
+        assert_array_almost_equal(X.todense(), [[4,0,8],[0,18,0]])
+        assert_equal(A.indices, col)   # operands are not modified
+
+    def test_dtypes(self):
+        A = csr_matrix(np.array([[1,0],[0,2]], dtype=np.int32))
+        assert_equal((2*csr_expression(A)).tocsr().dtype, np.int32)
+        assert_equal((csr_expression(A) * 0.5).tocsr().dtype, np.float64)
+        assert_equal((csr_expression(A) * 1j).tocsr().todense(),
+                     [[1j,0],[0,2j]])
+
+    def test_errors(self):
+        A = _random(3, 3, 0.5, 7)
+        B = _random(3, 4, 0.5, 8)
+        assert_raises(ValueError, csr_expression, np.eye(3))
+        assert_raises(ValueError, lambda: csr_expression(A) + B)
+        assert_raises(NotImplementedError, lambda: csr_expression(A) + 1)
+
+if __name__ == "__main__":
+    run_module_suite()
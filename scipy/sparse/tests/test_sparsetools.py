@@ -0,0 +1,341 @@
+import numpy as np
+from numpy import array, zeros
+from numpy.testing import TestCase, run_module_suite, assert_equal, \
+        assert_array_almost_equal
+
+from scipy.sparse import csr_matrix, csc_matrix, bsr_matrix, coo_matrix, \
+        dia_matrix, rand
+from scipy.sparse import sparsetools
+from scipy.sparse.sparsetools import csr_matvec_threads, \
+        csr_matvecs_threads, csc_matvec_threads, csc_matvecs_threads, \
+        csr_matmat_pass1, csr_matmat_pass2, csr_matmat_pass1_threads, \
+        csr_matmat_pass2_threads, coo_tocsr_canonical, coo_tocsc_canonical, \
+        csr_sort_indices_threads, csr_tocsc, csr_tocsc_threads, \
+        csc_tocsr_threads, csr_matvec, coo_tocsr, dia_matvec, dia_matvecs, \
+        dia_matvec_threads, dia_matvecs_threads
+
+class TestThreadedMatvec(TestCase):
+    def setUp(self):
+        np.random.seed(1234)
+        A = rand(300, 200, density=0.05, format='lil')
+        A[7,:] = 1      # one heavy row
+        A[:,3] = 2      # one heavy column
+        self.A = A.tocsr()
+
+    def test_csr(self):
+        A = self.A
+        x = np.random.rand(200)
+        X = np.random.rand(200, 3)
+        for n_threads in [0, 1, 2, 3, 8, 1000]:
+            y = zeros(300)
+            csr_matvec_threads(300, 200, A.indptr, A.indices, A.data, x, y,
+                               n_threads)
+            assert_equal(y, A*x)
+            Y = zeros((300, 3))
+            csr_matvecs_threads(300, 200, 3, A.indptr, A.indices, A.data,
+                                X.ravel(), Y.ravel(), n_threads)
+            assert_equal(Y, A*X)
+
+    def test_csc(self):
+        A = self.A.tocsc()
+        x = np.random.rand(200)
+        X = np.random.rand(200, 3)
+        for n_threads in [0, 1, 2, 3, 8, 1000]:
+            y = zeros(300)
+            csc_matvec_threads(300, 200, A.indptr, A.indices, A.data, x, y,
+                               n_threads)
+            assert_array_almost_equal(y, A*x)
+            Y = zeros((300, 3))
+            csc_matvecs_threads(300, 200, 3, A.indptr, A.indices, A.data,
+                                X.ravel(), Y.ravel(), n_threads)
+            assert_array_almost_equal(Y, A*X)
+
+    def test_deterministic(self):
+        A = self.A.tocsc()
+        x = np.random.rand(200)
+        y1 = zeros(300)
+        y2 = zeros(300)
+        csc_matvec_threads(300, 200, A.indptr, A.indices, A.data, x, y1, 4)
+        csc_matvec_threads(300, 200, A.indptr, A.indices, A.data, x, y2, 4)
+        assert_equal(y1, y2)
+
+    def test_set_num_threads(self):
+        A = self.A
+        x = np.random.rand(200)
+        expected = A*x
+        old = sparsetools.set_num_threads(4)
+        try:
+            assert_equal(sparsetools.get_num_threads(), 4)
+            assert_equal(A*x, expected)
+            assert_array_almost_equal(A.tocsc()*x, expected)
+            assert_array_almost_equal(A.T*np.ones(300), A.T.todense().sum(1).A.ravel())
+        finally:
+            sparsetools.set_num_threads(old)
+        self.assertRaises(ValueError, sparsetools.set_num_threads, -1)
+
+class TestThreadedMatmat(TestCase):
+    def _product(self, A, B, n_threads):
+        M, N = A.shape[0], B.shape[1]
+        Cp = np.empty(M + 1, dtype=np.intc)
+        if n_threads is None:
+            csr_matmat_pass1(M, N, A.indptr, A.indices, B.indptr, B.indices,
+                             Cp)
+        else:
+            csr_matmat_pass1_threads(M, N, A.indptr, A.indices, B.indptr,
+                                     B.indices, Cp, n_threads)
+        Cj = np.empty(Cp[-1], dtype=np.intc)
+        Cx = np.empty(Cp[-1], dtype=A.dtype)
+        if n_threads is None:
+            csr_matmat_pass2(M, N, A.indptr, A.indices, A.data, B.indptr,
+                             B.indices, B.data, Cp, Cj, Cx)
+        else:
+            csr_matmat_pass2_threads(M, N, A.indptr, A.indices, A.data,
+                                     B.indptr, B.indices, B.data, Cp, Cj,
+                                     Cx, n_threads)
+        return Cp, Cj[:Cp[-1]], Cx[:Cp[-1]]
+
+    def test_identical(self):
+        np.random.seed(1234)
+        # narrow and very wide products use the dense and hash accumulators
+        for N, density in [(50, 0.05), (100000, 0.001)]:
+            A = rand(200, 80, density=0.05, format='csr')
+            B = rand(80, N, density=density, format='csr')
+            A.data = np.round(4*A.data) - 2  # explicit zeros in the product
+            B.data = np.round(4*B.data) - 2
+            expected = self._product(A, B, None)
+            for n_threads in [0, 1, 2, 3, 16]:
+                result = self._product(A, B, n_threads)
+                for r, e in zip(result, expected):
+                    assert_equal(r, e)
+
+    def test_set_num_threads(self):
+        np.random.seed(1234)
+        A = rand(100, 60, density=0.1, format='csr')
+        B = rand(60, 70, density=0.1, format='csr')
+        expected = (A*B).todense()
+        old = sparsetools.set_num_threads(3)
+        try:
+            assert_array_almost_equal((A*B).todense(), expected)
+            assert_array_almost_equal((A.tocsc()*B.tocsc()).todense(),
+                                      expected)
+        finally:
+            sparsetools.set_num_threads(old)
+
+class TestCanonicalCOO(TestCase):
+    def setUp(self):
+        np.random.seed(1234)
+        nnz = 5000
+        # many duplicates, one heavy row and explicit zeros
+        self.row = np.random.randint(0, 40, nnz).astype(np.intc)
+        self.col = np.random.randint(0, 30, nnz).astype(np.intc)
+        self.row[:500] = 7
+        self.data = np.round(4*np.random.rand(nnz)) - 2
+        self.A = coo_matrix((self.data, (self.row, self.col)), shape=(40, 30))
+
+    def test_tocsr(self):
+        expected = self.A.tocsr()
+        for n_threads in [0, 1, 2, 3, 8, 1000]:
+            indptr  = np.empty(41, dtype=np.intc)
+            indices = np.empty(5000, dtype=np.intc)
+            data    = np.empty(5000)
+            coo_tocsr_canonical(40, 30, 5000, self.row, self.col, self.data,
+                                indptr, indices, data, n_threads)
+            nnz = indptr[-1]
+            assert_equal(indptr, expected.indptr)
+            assert_equal(indices[:nnz], expected.indices)
+            assert_equal(data[:nnz], expected.data)
+
+    def test_tocsc(self):
+        expected = self.A.tocsc()
+        for n_threads in [0, 1, 4]:
+            indptr  = np.empty(31, dtype=np.intc)
+            indices = np.empty(5000, dtype=np.intc)
+            data    = np.empty(5000)
+            coo_tocsc_canonical(40, 30, 5000, self.row, self.col, self.data,
+                                indptr, indices, data, n_threads)
+            nnz = indptr[-1]
+            assert_equal(indptr, expected.indptr)
+            assert_equal(indices[:nnz], expected.indices)
+            assert_equal(data[:nnz], expected.data)
+
+    def test_sort_indices(self):
+        A = rand(50, 400, density=0.2, format='lil')
+        A[3,:] = 1   # long row
+        A = A.tocsr()
+        for n_threads in [0, 1, 3]:
+            B = A.copy()
+            for i in range(50):
+                row = slice(B.indptr[i], B.indptr[i+1])
+                B.indices[row] = B.indices[row][::-1].copy()
+                B.data[row] = B.data[row][::-1].copy()
+            csr_sort_indices_threads(50, B.indptr, B.indices, B.data,
+                                     n_threads)
+            assert_equal(B.indices, A.indices)
+            assert_equal(B.data, A.data)
+
+    def test_set_num_threads(self):
+        expected = self.A.todense()
+        old = sparsetools.set_num_threads(3)
+        try:
+            B = self.A.tocsr()
+            assert_equal(B.todense(), expected)
+            assert_equal(B.has_sorted_indices, True)
+            assert_equal(self.A.tocsc().todense(), expected)
+        finally:
+            sparsetools.set_num_threads(old)
+
+class TestThreadedTranspose(TestCase):
+    def test_identical(self):
+        np.random.seed(1234)
+        for M, N in [(300, 200), (300, 4), (5, 300)]:
+            A = rand(M, N, density=0.1, format='lil')
+            A[M//2,:] = 1   # one heavy row
+            A = A.tocsr()
+            Bp = np.empty(N + 1, dtype=np.intc)
+            Bi = np.empty(A.nnz, dtype=np.intc)
+            Bx = np.empty(A.nnz)
+            csr_tocsc(M, N, A.indptr, A.indices, A.data, Bp, Bi, Bx)
+            for n_threads in [0, 1, 2, 3, 16]:
+                Cp = np.empty(N + 1, dtype=np.intc)
+                Ci = np.empty(A.nnz, dtype=np.intc)
+                Cx = np.empty(A.nnz)
+                csr_tocsc_threads(M, N, A.indptr, A.indices, A.data,
+                                  Cp, Ci, Cx, n_threads)
+                assert_equal(Cp, Bp)
+                assert_equal(Ci, Bi)
+                assert_equal(Cx, Bx)
+                Dp = np.empty(M + 1, dtype=np.intc)
+                Dj = np.empty(A.nnz, dtype=np.intc)
+                Dx = np.empty(A.nnz)
+                csc_tocsr_threads(M, N, Cp, Ci, Cx, Dp, Dj, Dx, n_threads)
+                assert_equal(Dp, A.indptr)
+                assert_equal(Dj, A.indices)
+                assert_equal(Dx, A.data)
+
+    def test_set_num_threads(self):
+        np.random.seed(1234)
+        A = rand(100, 60, density=0.1, format='csr')
+        expected = A.todense()
+        old = sparsetools.set_num_threads(3)
+        try:
+            assert_equal(A.tocsc().todense(), expected)
+            assert_equal(A.tocsc().tocsr().todense(), expected)
+        finally:
+            sparsetools.set_num_threads(old)
+
+class TestDIAMatvec(TestCase):
+    def setUp(self):
+        np.random.seed(1234)
+        # a 27 point stencil, long enough to span several row tiles
+        n = 15
+        offsets = [i*n*n + j*n + k for i in (-1,0,1)
+                                   for j in (-1,0,1) for k in (-1,0,1)]
+        data = np.random.rand(len(offsets), n**3)
+        self.A = dia_matrix((data, offsets), shape=(n**3, n**3 + 40))
+
+    def test_matvec(self):
+        A = self.A
+        M,N = A.shape
+        L = A.data.shape[1]
+        offsets = A.offsets.astype(np.intc)
+        x = np.random.rand(N)
+        X = np.random.rand(N, 3)
+        expected = A.tocsr() * x
+        Expected = A.tocsr() * X
+
+        y = zeros(M)
+        dia_matvec(M, N, len(offsets), L, offsets, A.data, x, y)
+        assert_array_almost_equal(y, expected)
+        Y = zeros((M, 3))
+        dia_matvecs(M, N, 3, len(offsets), L, offsets, A.data, X.ravel(),
+                    Y.ravel())
+        assert_array_almost_equal(Y, Expected)
+
+        for n_threads in [0, 1, 2, 3, 8, 1000]:
+            z = zeros(M)
+            dia_matvec_threads(M, N, len(offsets), L, offsets, A.data, x, z,
+                               n_threads)
+            assert_equal(z, y)
+            Z = zeros((M, 3))
+            dia_matvecs_threads(M, N, 3, len(offsets), L, offsets, A.data,
+                                X.ravel(), Z.ravel(), n_threads)
+            assert_equal(Z, Y)
+
+    def test_set_num_threads(self):
+        X = np.random.rand(self.A.shape[1], 2)
+        expected = self.A.tocsr() * X
+        old = sparsetools.set_num_threads(3)
+        try:
+            assert_array_almost_equal(self.A * X, expected)
+            assert_array_almost_equal(self.A * X[:,0], expected[:,0])
+        finally:
+            sparsetools.set_num_threads(old)
+
+class TestInt64Indices(TestCase):
+    def test_kernels(self):
+        np.random.seed(1234)
+        A = rand(40, 30, density=0.2, format='csr')
+        B = rand(30, 20, density=0.2, format='csr')
+        indptr  = A.indptr.astype(np.int64)
+        indices = A.indices.astype(np.int64)
+
+        x = np.random.rand(30)
+        y = zeros(40)
+        csr_matvec(40, 30, indptr, indices, A.data, x, y)
+        assert_equal(y, A*x)
+
+        Bp = np.empty(31, dtype=np.int64)
+        Bi = np.empty(A.nnz, dtype=np.int64)
+        Bx = np.empty(A.nnz)
+        csr_tocsc(40, 30, indptr, indices, A.data, Bp, Bi, Bx)
+        assert_equal(Bp, A.tocsc().indptr)
+        assert_equal(Bi, A.tocsc().indices)
+
+        C = A.tocoo()
+        Cp = np.empty(41, dtype=np.int64)
+        Cj = np.empty(A.nnz, dtype=np.int64)
+        Cx = np.empty(A.nnz)
+        coo_tocsr(40, 30, C.nnz, C.row.astype(np.int64),
+                  C.col.astype(np.int64), C.data, Cp, Cj, Cx)
+        assert_equal(Cp, A.indptr)
+
+        Dp = np.empty(41, dtype=np.int64)
+        csr_matmat_pass1(40, 20, indptr, indices, B.indptr.astype(np.int64),
+                         B.indices.astype(np.int64), Dp)
+        Dj = np.empty(Dp[-1], dtype=np.int64)
+        Dx = np.empty(Dp[-1])
+        csr_matmat_pass2(40, 20, indptr, indices, A.data,
+                         B.indptr.astype(np.int64), B.indices.astype(np.int64),
+                         B.data, Dp, Dj, Dx)
+        D = csr_matrix((Dx, Dj, Dp), shape=(40, 20))
+        assert_array_almost_equal(D.todense(), (A*B).todense())
+
+    def test_downcast(self):
+        # 64-bit input indices are stored as 32-bit when they fit
+        A = csr_matrix((np.ones(3), np.array([0, 1, 2], dtype=np.int64),
+                        np.array([0, 1, 2, 3], dtype=np.int64)), shape=(3,3))
+        assert_equal(A.indptr.dtype, np.intc)
+        assert_equal(A.indices.dtype, np.intc)
+        B = coo_matrix((np.ones(3), (np.arange(3, dtype=np.int64),
+                                     np.arange(3, dtype=np.int64))))
+        assert_equal(B.row.dtype, np.intc)
+        assert_equal(B.col.dtype, np.intc)
+        assert_equal((A*B).todense(), np.eye(3))
+
+class TestBSRBlockSizes(TestCase):
+    def test_products(self):
+        np.random.seed(1234)
+        # square blocks of size 2, 3, 4, 6 and 8 have specialised kernels
+        for R in [2, 3, 4, 5, 6, 8]:
+            D = rand(8*R, 6*R, density=0.2).todense()
+            A = bsr_matrix(D, blocksize=(R,R))
+            x = np.random.rand(6*R)
+            X = np.random.rand(6*R, 3)
+            assert_array_almost_equal(A*x, np.dot(D, x))
+            assert_array_almost_equal(A*X, np.dot(D, X))
+            E = rand(6*R, 4*R, density=0.2).todense()
+            B = bsr_matrix(E, blocksize=(R,R))
+            assert_array_almost_equal((A*B).todense(), np.dot(D, E))
+
+if __name__ == "__main__":
+    run_module_suite()
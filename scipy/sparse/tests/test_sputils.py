@@ -19,6 +19,11 @@ class TestSparseUtils(TestCase):
         assert_equal(sputils.getdtype(None,default=float),np.float)
         assert_equal(sputils.getdtype(None,a=A),np.int8)
 
+    def test_get_index_dtype(self):
+        assert_equal(sputils.get_index_dtype(),np.intc)
+        assert_equal(sputils.get_index_dtype(2**31 - 1),np.intc)
+        assert_equal(sputils.get_index_dtype(2**31),np.int64)
+
     def test_isscalarlike(self):
         assert_equal(sputils.isscalarlike(3.0),True)
         assert_equal(sputils.isscalarlike(-4),True)